@@ -72,6 +72,7 @@ class FieldFace;
 #include "data_FieldData.hpp"
 #include "data_Field.hpp"
 #include "data_FieldFace.hpp"
+#include "data_FieldCompress.hpp"
 
 #include "data_ItIndex.hpp"
 #include "data_ItIndexList.hpp"
@@ -43,6 +43,7 @@ enum meta_type {
 
 #include "io_Output.hpp"
 #include "io_OutputImage.hpp"
+#include "io_OutputProjection.hpp"
 #include "io_OutputData.hpp"
 #include "io_OutputCheckpoint.hpp"
 
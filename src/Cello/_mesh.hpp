@@ -88,6 +88,8 @@ enum adapt_type {
 #include <sstream>
 #include <vector>
 #include <memory>
+#include <map>
+#include <tuple>
 
 //----------------------------------------------------------------------
 // Component class includes
@@ -98,6 +100,7 @@ enum adapt_type {
 class Tree;
 
 #include "mesh_Index.hpp"
+#include "mesh_FieldVersion.hpp"
 
 #include "mesh_Block.hpp"
 #include "mesh_Hierarchy.hpp"
@@ -34,6 +34,7 @@
 #ifdef CONFIG_USE_PAPI  
 #include "performance_Papi.hpp"
 #endif
+#include "performance_EventTrace.hpp"
 #include "performance_Performance.hpp"
 
 
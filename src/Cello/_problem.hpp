@@ -27,12 +27,23 @@ enum neighbor_enum {
   neighbor_level,   // neighbors is in same level, maybe not leaves
   neighbor_tree     // neighbors that are leaves, but only if in same octree
 };
+
+/// @enum     value_dependence_enum
+/// @brief    variables an expression depends on (space and time bits)
+enum value_dependence_enum {
+  value_constant   = 0, // depends on neither t nor x,y,z
+  value_time       = 1, // depends on t only
+  value_space      = 2, // depends on x,y,z but not t
+  value_space_time = 3  // depends on x,y,z and t
+};
   
 //----------------------------------------------------------------------
 // System includes
 //----------------------------------------------------------------------
 
+#include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <limits>
 #include <algorithm>
@@ -66,6 +77,7 @@ enum neighbor_enum {
 #include "problem_Prolong.hpp"
 #include "problem_ProlongInject.hpp"
 #include "problem_ProlongLinear.hpp"
+#include "problem_ProlongQuadratic.hpp"
 #include "problem_Restrict.hpp"
 #include "problem_RestrictLinear.hpp"
 #include "problem_Units.hpp"
@@ -6,6 +6,8 @@
 
 namespace cello {
 
+  MessageCounters message_counter_list[CONFIG_NODE_SIZE];
+
   // @@@ KEEP IN SYNCH WITH precision_enum in cello.hpp
   const char * precision_name[7] = {
     "unknown",
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <math.h>
 
+#include <array>
 #include <map>
 #include <memory>
 #include <set>
@@ -106,7 +107,8 @@ enum refresh_type {
 };
 
 /// @enum     reduce_enum
-/// @brief    Reduction operator, used for image projections
+/// @brief    Reduction operator, used for image projections and
+///           ReduceCombine
 enum reduce_enum {
   reduce_unknown, /// Unknown reduction
   reduce_min,     /// Minimal value along the axis
@@ -235,6 +237,30 @@ enum type_enum {
 /// from Block(int)
 typedef unsigned process_type;
 
+/// @struct   MessageCounters
+/// @brief    Number of existing message and face objects on a PE,
+///           used to detect leaks, and the PE's message performance
+///           counters.  Aligned to a cache line so that counters for
+///           different PEs in an SMP process do not share one.
+struct alignas(64) MessageCounters {
+  long msg_coarsen;
+  long msg_refine;
+  long msg_refresh;
+  long data_msg;
+  long field_face;
+  int64_t particle_data;
+  /// FieldFacePlan objects created
+  long field_face_plan;
+  /// Coarsening messages from Blocks on the same and remote processes
+  long long coarsen_local;
+  long long coarsen_remote;
+  /// Compressed field data: uncompressed and compressed bytes, and
+  /// time spent compressing and decompressing in usec
+  long long compress_bytes_raw;
+  long long compress_bytes;
+  long long compress_usec;
+};
+
 /// Namespace for global constants and functions
 namespace cello {
 
@@ -347,6 +373,15 @@ namespace cello {
   inline int index_static()
   { return CkMyPe() % CONFIG_NODE_SIZE; }
 
+  /// Message counters for each PE in the process
+  extern MessageCounters message_counter_list[CONFIG_NODE_SIZE];
+
+  /// Return the message counters for the given or current PE
+  inline MessageCounters & message_counters(int in)
+  { return message_counter_list[in]; }
+  inline MessageCounters & message_counters()
+  { return message_counter_list[index_static()]; }
+
   /// Return a pointer to the Simulation object on this process
   Simulation *    simulation();
   /// Return a proxy for the Block chare array of Blocks
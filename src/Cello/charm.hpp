@@ -11,6 +11,7 @@
 
 #include "_error.hpp"
 #include "mesh_Index.hpp"
+#include "charm_ReduceCombine.hpp"
 #include "charm_reductions.hpp"
 #include "charm_Sync.hpp"
 #include "charm_MappingArray.hpp"
@@ -11,7 +11,6 @@
 
 //----------------------------------------------------------------------
 
-long MsgCoarsen::counter[CONFIG_NODE_SIZE] = {0};
 
 //----------------------------------------------------------------------
 
@@ -20,11 +19,12 @@ MsgCoarsen::MsgCoarsen()
     is_local_(true),
     data_msg_(NULL),
     buffer_(NULL),
+    trace_id_(0),
     num_face_level_(0),
     face_level_(NULL)
 {
   ic3_[0] = ic3_[1] = ic3_[2] = -1;
-  ++counter[cello::index_static()]; 
+  ++cello::message_counters().msg_coarsen; 
 }
 
 //----------------------------------------------------------------------
@@ -34,11 +34,12 @@ MsgCoarsen::MsgCoarsen(int num_face_level, std::vector<int> & face_level, int ic
     is_local_(true),
     data_msg_(NULL),
     buffer_(NULL),
+    trace_id_(0),
     num_face_level_(num_face_level),
     face_level_(new int[num_face_level])
 {
 
-  ++counter[cello::index_static()]; 
+  ++cello::message_counters().msg_coarsen; 
 
   for (int i=0; i<num_face_level_; i++) {
     face_level_[i] = face_level[i];
@@ -52,7 +53,7 @@ MsgCoarsen::MsgCoarsen(int num_face_level, std::vector<int> & face_level, int ic
 
 MsgCoarsen::~MsgCoarsen()
 {
-  --counter[cello::index_static()];
+  --cello::message_counters().msg_coarsen;
 
   delete data_msg_;
   data_msg_ = 0;
@@ -80,6 +81,9 @@ void * MsgCoarsen::pack (MsgCoarsen * msg)
 
   int size = 0;
 
+  // trace_id_ (first to keep alignment)
+  size += sizeof(long long);
+
   // have_data
   size += sizeof(int); 
 
@@ -110,10 +114,14 @@ void * MsgCoarsen::pack (MsgCoarsen * msg)
   union {
     char * pc;
     int  * pi;
+    long long * pl;
   };
 
   pc = buffer;
 
+  // trace_id_
+  (*pl++) = msg->trace_id_;
+
   have_data = (msg->data_msg_ != NULL);
 
   // have_data
@@ -169,10 +177,14 @@ MsgCoarsen * MsgCoarsen::unpack(void * buffer)
   union {
     char * pc;
     int  * pi;
+    long long * pl;
   };
 
   pc = (char *) buffer;
 
+  // trace_id_
+  msg->trace_id_ = (*pl++);
+
   // have_data
   int have_data = (*pi++);
 
@@ -226,14 +238,22 @@ void MsgCoarsen::update (Data * data)
   FieldFace    * ff = data_msg_->field_face();
   char         * fa = data_msg_->field_array();
 
+  if (is_local_) {
+    ++cello::message_counters().coarsen_local;
+  } else {
+    ++cello::message_counters().coarsen_remote;
+  }
+
   if (pd != NULL) {
 
-    // Insert new particles 
+    // Insert new particles, moving batches instead of copying since
+    // the child Block is deleted after coarsening and pd is not
+    // otherwise used
 
     Particle particle = data->particle();
     
     for (int it=0; it<particle.num_types(); it++) {
-      particle.gather (it, 1, &pd);
+      particle.splice (it, pd);
     }
     
     // Don't delete particle data if local--done by child Block::data_
@@ -20,8 +20,6 @@ class MsgCoarsen : public CMessage_MsgCoarsen {
 
 public: // interface
 
-  static long counter[CONFIG_NODE_SIZE];
-
   MsgCoarsen();
 
   MsgCoarsen( int num_face_level, std::vector<int> & face_level, int ic3[3]);
@@ -31,7 +29,7 @@ public: // interface
   /// Copy constructor
   MsgCoarsen(const MsgCoarsen & data_msg) throw()
   {
-    ++counter[cello::index_static()]; 
+    ++cello::message_counters().msg_coarsen; 
   };
 
   /// Assignment operator
@@ -50,6 +48,15 @@ public: // interface
   /// Return the face_level_ attribute
   int * face_level() { return face_level_; }
 
+  /// Set the identifier used to match send and receive events in
+  /// the EventTrace
+  void set_trace_id (long long trace_id)
+  { trace_id_ = trace_id; }
+
+  /// Return the EventTrace message identifier, or 0 if not traced
+  long long trace_id () const
+  { return trace_id_; }
+
 public: // static methods
 
   /// Pack data to serialize
@@ -69,6 +76,9 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// EventTrace message identifier
+  long long trace_id_;
+
   /// MsgRefine-specific attributes
 
   int num_face_level_;
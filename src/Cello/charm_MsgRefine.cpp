@@ -13,8 +13,6 @@
 
 //----------------------------------------------------------------------
 
-long MsgRefine::counter[CONFIG_NODE_SIZE] = {0};
-
 //----------------------------------------------------------------------
 
 MsgRefine::MsgRefine()
@@ -31,7 +29,7 @@ MsgRefine::MsgRefine()
     refresh_type_(refresh_unknown),
     num_face_level_(0), face_level_(NULL)
 {
-  ++counter[cello::index_static()]; 
+  ++cello::message_counters().msg_refine; 
 #ifdef DEBUG_MSG_REFINE  
   CkPrintf ("%d %s:%d DEBUG_MSG_REFINE creating %p\n",CkMyPe(),__FILE__,__LINE__,this);
 #endif  
@@ -59,7 +57,7 @@ MsgRefine::MsgRefine
   num_face_level_(num_face_level),
   face_level_(new int[num_face_level])
 {  
-  ++counter[cello::index_static()]; 
+  ++cello::message_counters().msg_refine; 
 #ifdef DEBUG_MSG_REFINE  
   CkPrintf ("%d %s:%d DEBUG_MSG_REFINE creating %p\n",CkMyPe(),__FILE__,__LINE__,this);
 #endif  
@@ -73,7 +71,7 @@ MsgRefine::MsgRefine
 
 MsgRefine::~MsgRefine()
 {
-  --counter[cello::index_static()];
+  --cello::message_counters().msg_refine;
 #ifdef DEBUG_MSG_REFINE  
   CkPrintf ("%d %s:%d DEBUG_MSG_REFINE destroying %p\n",CkMyPe(),__FILE__,__LINE__,this);
 #endif  
@@ -315,13 +313,14 @@ void MsgRefine::update (Data * data)
 
   if (pd != NULL) {
 
-    // Insert new particles 
+    // Insert new particles, moving batches instead of copying since
+    // pd is owned by the message
 
     Particle particle = data->particle();
 
     int count = 0;
     for (int it=0; it<particle.num_types(); it++) {
-      count += particle.gather (it, 1, &pd);
+      count += particle.splice (it, pd);
     }
     simulation->data_insert_particles(count);
 
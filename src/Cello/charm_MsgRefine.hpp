@@ -22,7 +22,6 @@ class MsgRefine : public CMessage_MsgRefine {
 public: // interface
 
   friend class Block;
-  static long counter[CONFIG_NODE_SIZE];
 
   MsgRefine();
 
@@ -43,7 +42,7 @@ public: // interface
 #ifdef DEBUG_MSG_REFINE  
     CkPrintf ("%d %s:%d DEBUG_MSG_REFINE creating %p(%p)\n",CkMyPe(),__FILE__,__LINE__,this,&data_msg);
 #endif  
-    ++counter[cello::index_static()]; 
+    ++cello::message_counters().msg_refine; 
   };
 
   /// Assignment operator
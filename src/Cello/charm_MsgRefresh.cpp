@@ -13,24 +13,23 @@
 
 //----------------------------------------------------------------------
 
-long MsgRefresh::counter[CONFIG_NODE_SIZE] = {0};
-
 //----------------------------------------------------------------------
 
 MsgRefresh::MsgRefresh()
     : CMessage_MsgRefresh(),
       is_local_(true),
       data_msg_(NULL),
-      buffer_(NULL)
+      buffer_(NULL),
+      trace_id_(0)
 {
-  ++counter[cello::index_static()]; 
+  ++cello::message_counters().msg_refresh; 
 }
 
 //----------------------------------------------------------------------
 
 MsgRefresh::~MsgRefresh()
 {
-  --counter[cello::index_static()];
+  --cello::message_counters().msg_refresh;
   delete data_msg_;
   data_msg_ = 0;
 }
@@ -58,6 +57,9 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   if (msg->buffer_ != NULL) return msg->buffer_;
   int size = 0;
 
+  // trace_id_ (first to keep alignment)
+  size += sizeof(long long);
+
   size += sizeof(int); // have_data
 
   int have_data = (msg->data_msg_ != NULL);
@@ -79,10 +81,14 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   union {
     char * pc;
     int  * pi;
+    long long * pl;
   };
 
   pc = buffer;
 
+  // trace_id_
+  (*pl++) = msg->trace_id_;
+
   have_data = (msg->data_msg_ != NULL);
   (*pi++) = have_data;
   if (have_data) {
@@ -126,10 +132,14 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
   union {
     char * pc;
     int  * pi;
+    long long * pl;
   };
 
   pc = (char *) buffer;
 
+  // trace_id_
+  msg->trace_id_ = (*pl++);
+
   int have_data = (*pi++);
   if (have_data) {
     msg->data_msg_ = new DataMsg;
@@ -17,8 +17,6 @@ class MsgRefresh : public CMessage_MsgRefresh {
 
 public: // interface
 
-  static long counter[CONFIG_NODE_SIZE];
-
   MsgRefresh() ;
 
   virtual ~MsgRefresh();
@@ -26,7 +24,7 @@ public: // interface
   /// Copy constructor
   MsgRefresh(const MsgRefresh & data_msg) throw()
   {
-    ++counter[cello::index_static()]; 
+    ++cello::message_counters().msg_refresh; 
   };
 
   /// Assignment operator
@@ -39,6 +37,15 @@ public: // interface
   /// Update the Data with data stored in this message
   void update (Data * data);
 
+  /// Set the identifier used to match send and receive events in
+  /// the EventTrace
+  void set_trace_id (long long trace_id)
+  { trace_id_ = trace_id; }
+
+  /// Return the EventTrace message identifier, or 0 if not traced
+  long long trace_id () const
+  { return trace_id_; }
+
 public: // static methods
 
   /// Pack data to serialize
@@ -57,6 +64,9 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// EventTrace message identifier
+  long long trace_id_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
@@ -0,0 +1,193 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_ReduceCombine.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Charm] Implementation of the ReduceCombine class
+
+#include "cello.hpp"
+#include "charm.hpp"
+
+//----------------------------------------------------------------------
+
+struct alignas(64) ReduceCombine::Result {
+  ReduceCombine value;
+};
+
+ReduceCombine::Result ReduceCombine::result_[CONFIG_NODE_SIZE];
+
+namespace {
+
+  // Names of keys returned by key() on each process, to detect hash
+  // collisions, which would otherwise silently combine two values.
+  // Aligned to a cache line so that tables for different PEs in an
+  // SMP process do not share one
+
+  struct alignas(64) KeyNames {
+    std::map<int,std::string> name;
+  };
+
+  KeyNames key_names[CONFIG_NODE_SIZE];
+
+}
+
+//----------------------------------------------------------------------
+
+ReduceCombine & ReduceCombine::result() throw()
+{
+  return result_[cello::index_static()].value;
+}
+
+//----------------------------------------------------------------------
+
+int ReduceCombine::key (const std::string & name) throw()
+{
+  // 32-bit FNV-1a hash, so that keys agree across processes
+
+  unsigned int hash = 2166136261u;
+  for (size_t i=0; i<name.size(); i++) {
+    hash ^= (unsigned char)(name[i]);
+    hash *= 16777619u;
+  }
+  const int k = (int)(hash & 0x7fffffff);
+
+  std::map<int,std::string> & names = key_names[cello::index_static()].name;
+  std::map<int,std::string>::const_iterator it = names.find(k);
+  if (it == names.end()) {
+    names[k] = name;
+  } else {
+    ASSERT3 ("ReduceCombine::key",
+	     "Values %s and %s have the same key %d",
+	     it->second.c_str(),name.c_str(),k,
+	     (it->second == name));
+  }
+
+  return k;
+}
+
+//----------------------------------------------------------------------
+
+void ReduceCombine::deposit
+(const std::string & name, int op, long double value) throw()
+{
+  ASSERT2 ("ReduceCombine::deposit",
+	   "Unsupported reduction operation %d for value %s",
+	   op,name.c_str(),
+	   (op == reduce_min || op == reduce_max || op == reduce_sum));
+
+  const int k = key(name);
+
+  std::map< int, std::pair<int,long double> >::iterator it =
+    records_.find(k);
+
+  if (it == records_.end()) {
+    records_[k] = std::pair<int,long double> (op,value);
+  } else {
+    ASSERT3 ("ReduceCombine::deposit",
+	     "Value %s deposited with operation %d but previously %d",
+	     name.c_str(),op,it->second.first,
+	     (it->second.first == op));
+    it->second.second = combine(op,it->second.second,value);
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool ReduceCombine::value
+(const std::string & name, long double * value) const throw()
+{
+  std::map< int, std::pair<int,long double> >::const_iterator it =
+    records_.find(key(name));
+  if (it == records_.end()) return false;
+  if (value) *value = it->second.second;
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+int ReduceCombine::data_size () const throw()
+{
+  return records_.size()*sizeof(record_type);
+}
+
+//----------------------------------------------------------------------
+
+void ReduceCombine::save_data (char * buffer) const throw()
+{
+  // std::map is ordered, so records are written sorted by key
+
+  record_type * records = (record_type *) buffer;
+  int i = 0;
+  std::map< int, std::pair<int,long double> >::const_iterator it;
+  for (it = records_.begin(); it != records_.end(); ++it, ++i) {
+    records[i].key   = it->first;
+    records[i].op    = it->second.first;
+    records[i].value = it->second.second;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ReduceCombine::load_data (const char * buffer, int size) throw()
+{
+  ASSERT2 ("ReduceCombine::load_data",
+	   "Buffer size %d is not a multiple of the record size %d",
+	   size,int(sizeof(record_type)),
+	   (size % sizeof(record_type) == 0));
+
+  records_.clear();
+
+  const record_type * records = (const record_type *) buffer;
+  const int n = size / sizeof(record_type);
+  for (int i=0; i<n; i++) {
+    records_[records[i].key] =
+      std::pair<int,long double> (records[i].op,records[i].value);
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool ReduceCombine::merge (const char * buffer, int size) throw()
+{
+  ASSERT2 ("ReduceCombine::merge",
+	   "Buffer size %d is not a multiple of the record size %d",
+	   size,int(sizeof(record_type)),
+	   (size % sizeof(record_type) == 0));
+
+  // Contributions may hold different subsets of keys, e.g. if only
+  // some Blocks deposited a value
+
+  bool consistent = true;
+  const record_type * records = (const record_type *) buffer;
+  const int n = size / sizeof(record_type);
+  for (int i=0; i<n; i++) {
+    std::map< int, std::pair<int,long double> >::iterator it =
+      records_.find(records[i].key);
+    if (it == records_.end()) {
+      records_[records[i].key] =
+	std::pair<int,long double> (records[i].op,records[i].value);
+    } else if (it->second.first != records[i].op) {
+      consistent = false;
+    } else {
+      it->second.second = combine
+	(records[i].op,it->second.second,records[i].value);
+    }
+  }
+  return consistent;
+}
+
+//----------------------------------------------------------------------
+
+long double ReduceCombine::combine
+(int op, long double a, long double b) throw()
+{
+  switch (op) {
+  case reduce_min: return std::min(a,b);
+  case reduce_max: return std::max(a,b);
+  case reduce_sum: return a + b;
+  default:
+    ERROR1 ("ReduceCombine::combine",
+	    "Unsupported reduction operation %d",op);
+  }
+  return 0.0;
+}
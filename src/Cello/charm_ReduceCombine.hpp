@@ -0,0 +1,99 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_ReduceCombine.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Charm] Declaration of the ReduceCombine class
+
+#ifndef CHARM_REDUCE_COMBINE_HPP
+#define CHARM_REDUCE_COMBINE_HPP
+
+class ReduceCombine {
+
+  /// @class    ReduceCombine
+  /// @ingroup  Charm
+  /// @brief    [\ref Charm] Keyed values combined in a single reduction
+  ///
+  /// Blocks deposit named values together with a reduction operation
+  /// (reduce_min, reduce_max, or reduce_sum), which are accumulated
+  /// as long double and packed into a single contribution sorted by
+  /// key.  The r_reduce_combine reducer merges contributions by key,
+  /// so any number of independent global reductions issued in the
+  /// same phase cost a single reduction latency.
+
+public: // interface
+
+  /// Reduction record: hashed name, operation, and value
+  struct record_type {
+    int key;
+    int op;
+    long double value;
+  };
+
+  /// Constructor
+  ReduceCombine() throw()
+    : records_()
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    p | records_;
+  }
+
+  /// Return the key used for the given name, asserting that no other
+  /// name used on this process has the same key
+  static int key (const std::string & name) throw();
+
+  /// Deposit a value, combining it with any earlier value of the
+  /// same name using the given operation
+  void deposit (const std::string & name, int op, long double value) throw();
+
+  /// Return whether the named value is defined, and if so its value
+  bool value (const std::string & name, long double * value) const throw();
+
+  /// Number of values deposited
+  int num_values() const throw()
+  { return records_.size(); }
+
+  /// Clear all values
+  void clear() throw()
+  { records_.clear(); }
+
+  /// Size in bytes of the packed records
+  int data_size () const throw();
+
+  /// Pack the records, sorted by key, into the given buffer
+  void save_data (char * buffer) const throw();
+
+  /// Replace the records with those in the given packed buffer
+  void load_data (const char * buffer, int size) throw();
+
+  /// Merge the records in the given packed buffer by key, combining
+  /// values with matching keys; return false if any operations differ
+  bool merge (const char * buffer, int size) throw();
+
+  /// Combine two values using the given reduction operation
+  static long double combine (int op, long double a, long double b) throw();
+
+  /// Most recent combined result on this process
+  static ReduceCombine & result() throw();
+
+private: // static attributes
+
+  /// Combined result on each process, aligned to a cache line so that
+  /// results for different PEs in an SMP process do not share one
+  struct Result;
+  static Result result_[CONFIG_NODE_SIZE];
+
+private: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Operation and value indexed by key
+  std::map< int, std::pair<int,long double> > records_;
+
+};
+
+#endif /* CHARM_REDUCE_COMBINE_HPP */
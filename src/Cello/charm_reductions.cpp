@@ -304,3 +304,36 @@ CkReductionMsg * sum_long_double_n(int n, CkReductionMsg ** msgs)
 
 //======================================================================
 
+
+CkReduction::reducerType r_reduce_combine_type;
+
+void register_reduce_combine(void)
+{ r_reduce_combine_type = CkReduction::addReducer(r_reduce_combine); }
+
+CkReductionMsg * r_reduce_combine(int n, CkReductionMsg ** msgs)
+{
+  ReduceCombine merged;
+
+  for (int i=0; i<n; i++) {
+
+    ASSERT2("r_reduce_combine()",
+	    "CkReductionMsg actual size %d is not a multiple of %d",
+	    msgs[i]->getSize(),sizeof(ReduceCombine::record_type),
+	    (msgs[i]->getSize() % sizeof(ReduceCombine::record_type) == 0));
+
+    const bool consistent = merged.merge
+      ((const char *) msgs[i]->getData(), msgs[i]->getSize());
+
+    ASSERT1("r_reduce_combine()",
+	    "Contribution %d reduces a key with a different operation",
+	    i, consistent);
+  }
+
+  const int size = merged.data_size();
+  std::vector<char> buffer (size);
+  if (size > 0) merged.save_data(&buffer[0]);
+
+  return CkReductionMsg::buildNew (size, size ? &buffer[0] : NULL);
+}
+
+//======================================================================
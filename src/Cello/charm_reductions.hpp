@@ -38,3 +38,7 @@ extern CkReductionMsg * sum_long_double_n(int n, CkReductionMsg ** msgs);
 extern CkReduction::reducerType sum_long_double_n_type;
 extern void register_sum_long_double_n(void);
 
+
+extern CkReductionMsg * r_reduce_combine(int n, CkReductionMsg ** msgs);
+extern CkReduction::reducerType r_reduce_combine_type;
+extern void register_reduce_combine(void);
@@ -43,7 +43,8 @@ Solver::Solver (std::string name,
   min_level_(min_level),
   max_level_(max_level),
   id_sync_(0),
-  solve_type_(solve_type)
+  solve_type_(solve_type),
+  use_guess_(false)
 {
   FieldDescr * field_descr = cello::field_descr();
   ix_ = field_descr->field_id(field_x);
@@ -42,7 +42,8 @@ public: // interface
     min_level_(0),
     max_level_(std::numeric_limits<int>::max()),
     id_sync_(0),
-    solve_type_(solve_leaf)
+    solve_type_(solve_leaf),
+    use_guess_(false)
   {}
 
   /// Destructor
@@ -63,7 +64,8 @@ public: // interface
     min_level_(- std::numeric_limits<int>::max()),
     max_level_(  std::numeric_limits<int>::max()),
     id_sync_(0),
-    solve_type_(solve_leaf)
+    solve_type_(solve_leaf),
+    use_guess_(false)
   { }
   
   /// CHARM++ Pack / Unpack function
@@ -85,6 +87,7 @@ public: // interface
     p | max_level_;
     p | id_sync_;
     p | solve_type_;
+    p | use_guess_;
   }
 
   Refresh * refresh(size_t index=0) ;
@@ -104,6 +107,14 @@ public: // interface
   void set_field_b (int ib)
   { ib_ = ib;  }
 
+  /// Set whether the current values of the solution field X are used
+  /// as the initial guess instead of zero for the next call to apply()
+  void set_use_guess (bool use_guess)
+  { use_guess_ = use_guess; }
+
+  bool use_guess() const
+  { return use_guess_; }
+
   void set_min_level (int min_level)
   { min_level_ = min_level; }
 
@@ -256,6 +267,9 @@ protected: // attributes
   /// Type of solver; see enum solve_type for supported types
   int solve_type_;
 
+  /// Whether X on input is the initial guess (otherwise X = 0)
+  bool use_guess_;
+
 };
 
 #endif /* COMPUTE_SOLVER_HPP */
@@ -193,6 +193,11 @@ void Block::adapt_end_()
   for (size_t i=0; i<face_level_last_.size(); i++)
     face_level_last_[i] = -1;
 
+  // Neighbors may have changed, including from refining or
+  // coarsening after update_levels_()
+
+  neighbor_table_.clear();
+
   const int rank = cello::rank();
   sync_coarsen_.set_stop(NUM_CHILDREN(rank));
   sync_coarsen_.reset();
@@ -218,7 +223,13 @@ bool Block::do_adapt_()
 {
   int adapt_interval = cello::config()->adapt_interval;
 
-  return ((adapt_interval && ((cycle_ % adapt_interval) == 0)));
+  // Always adapt in the initial cycle, which may not be a multiple
+  // of the interval when restarting
+
+  const bool is_first_cycle = (cycle_ == cello::config()->initial_cycle);
+
+  return ((adapt_interval &&
+	   (is_first_cycle || (cycle_ % adapt_interval) == 0)));
 }
 
 //----------------------------------------------------------------------
@@ -246,19 +257,55 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   Problem * problem = cello::problem();
   Refine * refine;
 
-  int index_refine = 0;
-  while ((refine = problem->refine(index_refine++))) {
+  const bool use_cache =
+    (adapt_cache_cycle_ == cycle_) && (adapt_cache_time_ == time_);
+
+  if (use_cache) {
+
+    // Field data have not changed since the last evaluation (e.g. the
+    // repeated adapt steps of the initial cycle), so reuse the result
+
+    adapt_ = adapt_cache_;
+
+  } else {
+
+    int index_refine = 0;
+    while ((refine = problem->refine(index_refine++))) {
+
+      // Once any criteria requests refinement the outcome is fixed,
+      // so remaining criteria are only needed to write output fields
+
+      if (adapt_ == adapt_refine && ! refine->has_output()) continue;
 
-    Schedule * schedule = refine->schedule();
+      Schedule * schedule = refine->schedule();
+
+      if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
+	adapt_ = std::max(adapt_,refine->apply(this));
+      }
 
-    if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
-      adapt_ = std::max(adapt_,refine->apply(this));
     }
 
+    adapt_cache_cycle_ = cycle_;
+    adapt_cache_time_  = time_;
+    adapt_cache_       = adapt_;
   }
+
   const int initial_cycle = cello::config()->initial_cycle;
   const bool is_first_cycle = (initial_cycle == cycle());
 
+  if (is_first_cycle) {
+
+    // Initial conditions may determine the mesh, e.g. when rebuilding
+    // the hierarchy of a data dump, in which case they override the
+    // refinement criteria
+
+    int index_initial = 0;
+    while (Initial * initial = problem->initial(index_initial++)) {
+      const int adapt = initial->adapt_block(this);
+      if (adapt != adapt_unknown) adapt_ = adapt;
+    }
+  }
+
   if (adapt_ == adapt_coarsen && level > 0 && ! is_first_cycle) 
     level_desired = level - 1;
   else if (adapt_ == adapt_refine  && level < level_maximum) 
@@ -353,8 +400,12 @@ void Block::adapt_refine_()
 
       data_msg -> set_field_face (field_face,false);
       data_msg -> set_field_data (data()->field_data(),false);
-      ParticleData * p_data = new ParticleData(*particle_list[IC3(ic3)]);
-      data_msg -> set_particle_data (p_data,true);
+
+      // Hand the child's scattered particles to the message instead
+      // of copying them
+
+      data_msg -> set_particle_data (particle_list[IC3(ic3)],true);
+      particle_list[IC3(ic3)] = NULL;
 
       const Factory * factory = cello::simulation()->factory();
 
@@ -846,6 +897,7 @@ void Block::adapt_coarsen_()
   const int nf = face_level_curr_.size();
   MsgCoarsen * msg = new MsgCoarsen (nf,face_level_curr_,ic3);
   msg->set_data_msg (data_msg);
+  msg->set_trace_id (trace_send_());
 
   thisProxy[index_parent].p_adapt_recv_child (msg);
   
@@ -857,10 +909,17 @@ void Block::adapt_coarsen_()
 void Block::p_adapt_recv_child (MsgCoarsen * msg)
 {
 
+  trace_recv_(msg->trace_id());
+
   performance_start_(perf_adapt_update);
 
   msg->update(data());
 
+  // Field data changed: invalidate cached refinement criteria result
+  // and derived fields
+  adapt_cache_cycle_ = -1;
+  field_modified();
+
   int * ic3 = msg->ic3();
   int * child_face_level_curr = msg->face_level();
 
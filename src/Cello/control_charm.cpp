@@ -39,6 +39,8 @@ void Block::initial_exit_()
   performance_start_(perf_initial);
   TRACE_CONTROL("initial_exit");
 
+  field_modified();
+
 #ifdef TRACE_CONTRIBUTE  
   CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE calling r_adapt_enter\n",
 	    name().c_str(),__FILE__,__LINE__); fflush(stdout);
@@ -71,11 +73,12 @@ void Block::output_exit_()
 
   performance_stop_(perf_output);
 
-#ifdef TRACE_CONTRIBUTE  
-  CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE calling r_stopping_enter()\n",
-	    name().c_str(),__FILE__,__LINE__); fflush(stdout);
-#endif  
-  control_sync_barrier (CkIndex_Block::r_stopping_enter(NULL));
+  // The stopping phase reduction also synchronizes the output phase,
+  // so no separate barrier is needed
+
+  performance_start_(perf_stopping);
+  stopping_enter_();
+  performance_stop_(perf_stopping);
 
 }
 
@@ -128,6 +131,8 @@ void Block::refresh_exit_()
 
   update_boundary_();
 
+  field_modified();
+
   // CkCallback (refresh_.back()->callback(),thisProxy).send(NULL);
 
   control_sync (refresh_.back()->callback(),
@@ -230,14 +235,14 @@ void Block::control_sync_neighbor(int entry_point, int id_sync,
 
   const int min_level = cello::config()->mesh_min_level;
   
-  ItNeighbor it_neighbor = this->it_neighbor(min_face_rank,index_,neighbor_type,min_level,root_level);
+  const std::vector<BlockNeighbor> & neighbors =
+    this->neighbors(min_face_rank,neighbor_type,min_level,root_level);
 
-  int of3[3];  // ignored
-  while (it_neighbor.next(of3)) {
+  for (size_t in=0; in<neighbors.size(); in++) {
 
     ++num_neighbors;
 
-    Index index_neighbor = it_neighbor.index();
+    Index index_neighbor = neighbors[in].index;
 
 #ifdef DEBUG_CONTROL
     CkPrintf ("%s DEBUG_CONTROL calling p_control_sync_count (%d %d 0)\n",
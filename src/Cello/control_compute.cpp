@@ -107,6 +107,7 @@ void Block::compute_continue_ ()
 #endif
     // Apply the method to the Block
 
+    field_modified();
     method -> compute (this);
     performance_stop_(perf_compute,__FILE__,__LINE__);
 
@@ -126,6 +127,7 @@ void Block::compute_done ()
   if (cycle() >= CYCLE)
     CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_done_()\n", CkMyPe(),name().c_str());
 #endif
+  field_modified();
   index_method_++;
   compute_next_();
 }
@@ -146,6 +148,7 @@ void Block::compute_end_ ()
 
   // Push back fields if saving old ones
   data()->field().save_history(time_);
+  field_modified();
 
   // Update block cycle and time
   set_cycle (cycle_ + 1);
@@ -283,40 +283,9 @@ void Simulation::r_write_checkpoint()
 void Problem::output_wait(Simulation * simulation) throw()
 {
   TRACE_OUTPUT("Problem::output_wait()");
-  
-  Output * output = this->output(index_output_);
-
-  const int ip = CkMyPe();
-  const int np = CkNumPes();
-  const int ip_write = output->process_writer();
-
-  if (ip == ip_write) {
-
-    output_write(simulation,0,0);
-
-  } else {
 
-    int n=0;  char * buffer = 0;
-
-    // Copy / alias buffer array of data to send
-    output->prepare_remote(&n,&buffer);
-
-    // Send data to writing process
-    proxy_simulation[ip_write].p_output_write (n, buffer);
-
-    // Deallocate buffer
-    output->cleanup_remote(&n,&buffer);
-
-    output->close();
-    output->finalize();
-    output_next(simulation);
-    
-    const int stride = output->stride_wait();
-    const int ip_next = ip+1;
-    if (ip_next%stride != 0 && ip_next < np) {
-      proxy_simulation[ip_next].p_output_start(index_output_);
-    }
-  }
+  // Count this process's own contribution
+  output_write(simulation,0,0);
 }
 
 //----------------------------------------------------------------------
@@ -343,10 +312,28 @@ void Problem::output_write
     output->update_remote(n, buffer);
   }
 
+  // Wait for local data and data from all remote processes sending
+  // to this one: either every process in the stride if this is the
+  // writer, or child processes in the reduction tree
+
   if (output->sync_write()->next()) {
 
     TRACE_OUTPUT("Problem::output_write(): sync_write()->next() = true");
 
+    if (! output->is_writer()) {
+
+      int n=0;  char * buffer = 0;
+
+      // Copy / alias buffer array of data to send
+      output->prepare_remote(&n,&buffer);
+
+      // Send data to writing process or parent in reduction tree
+      proxy_simulation[output->process_parent()].p_output_write (n, buffer);
+
+      // Deallocate buffer
+      output->cleanup_remote(&n,&buffer);
+    }
+
     output->close();
     output->finalize();
     output_next(simulation);
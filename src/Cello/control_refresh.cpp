@@ -111,6 +111,8 @@ void Block::p_refresh_store (MsgRefresh * msg)
 {
 
   
+  trace_recv_(msg->trace_id());
+
   performance_start_(perf_refresh_store);
 
   msg->update(data());
@@ -145,27 +147,19 @@ int Block::refresh_load_field_faces_ (Refresh *refresh)
 
     const int min_level = cello::config()->mesh_min_level;
     
-    ItNeighbor it_neighbor =
-      this->it_neighbor(min_face_rank,index_,
-			neighbor_type,min_level,refresh->root_level());
-
-    int if3[3];
-    while (it_neighbor.next(if3)) {
-
-      Index index_neighbor = it_neighbor.index();
+    const std::vector<BlockNeighbor> & neighbors =
+      this->neighbors(min_face_rank,neighbor_type,
+		      min_level,refresh->root_level());
 
-      int ic3[3];
-      it_neighbor.child(ic3);
+    for (size_t in=0; in<neighbors.size(); in++) {
 
-      const int level = this->level();
-      const int level_face = it_neighbor.face_level();
+      const BlockNeighbor & neighbor = neighbors[in];
 
-      const int refresh_type = 
-	(level_face == level - 1) ? refresh_coarse :
-	(level_face == level)     ? refresh_same :
-	(level_face == level + 1) ? refresh_fine : refresh_unknown;
+      int if3[3] = {neighbor.of3[0],neighbor.of3[1],neighbor.of3[2]};
+      int ic3[3] = {neighbor.ic3[0],neighbor.ic3[1],neighbor.ic3[2]};
 
-      refresh_load_field_face_ (refresh_type,index_neighbor,if3,ic3);
+      refresh_load_field_face_
+	(neighbor.refresh_type,neighbor.index,if3,ic3);
       ++count;
     }
 
@@ -233,6 +227,7 @@ void Block::refresh_load_field_face_
   MsgRefresh * msg = new MsgRefresh;
 
   msg->set_data_msg (data_msg);
+  msg->set_trace_id (trace_send_());
 
   thisProxy[index_neighbor].p_refresh_store (msg);
 
@@ -364,33 +359,29 @@ int Block::particle_create_array_neighbors_
   //  TRACE_REFRESH("particle_create_array_neighbors()");
 
   const int rank = cello::rank();
-  const int level = this->level();
 
   const int min_face_rank = refresh->min_face_rank();
-  ItNeighbor it_neighbor = this->it_neighbor(min_face_rank,index_,neighbor_leaf,0,0);
+  const std::vector<BlockNeighbor> & neighbors =
+    this->neighbors(min_face_rank,neighbor_leaf,0,0);
 
-  int il = 0;
+  const int nl = neighbors.size();
 
-  int if3[3];
-  for (il=0; it_neighbor.next(if3); il++) {
+  for (int il=0; il<nl; il++) {
 
-    const int level_face = it_neighbor.face_level();
+    const BlockNeighbor & neighbor = neighbors[il];
 
-    int ic3[3] = {0,0,0};
+    const int refresh_type = neighbor.refresh_type;
+
+    int if3[3] = {neighbor.of3[0],neighbor.of3[1],neighbor.of3[2]};
 
-    const int refresh_type = 
-      (level_face == level - 1) ? refresh_coarse :
-      (level_face == level)     ? refresh_same :
-      (level_face == level + 1) ? refresh_fine : refresh_unknown;
-
-    if (refresh_type==refresh_coarse) {
-      // coarse neighbor: need index of self in parent
-      index_.child(index_.level(),ic3,ic3+1,ic3+2);
-    } else if (refresh_type==refresh_fine) {
-      // fine neighbor: need index of child in self
-      it_neighbor.child(ic3);
+    // coarse neighbor: index of self in parent; fine neighbor: index
+    // of child in self; same-level neighbor: child not needed
+    int ic3[3] = {0,0,0};
+    if (refresh_type != refresh_same) {
+      ic3[0] = neighbor.ic3[0];
+      ic3[1] = neighbor.ic3[1];
+      ic3[2] = neighbor.ic3[2];
     }
-    // (else same-level neighbor: don't need child)
 
     int index_lower[3] = {0,0,0};
     int index_upper[3] = {1,1,1};
@@ -404,7 +395,7 @@ int Block::particle_create_array_neighbors_
 
     particle_list[il] = pd;
 
-    index_list[il] = it_neighbor.index();
+    index_list[il] = neighbor.index;
 
     for (int iz=index_lower[2]; iz<index_upper[2]; iz++) {
       for (int iy=index_lower[1]; iy<index_upper[1]; iy++) {
@@ -416,7 +407,7 @@ int Block::particle_create_array_neighbors_
     }
   }
   
-  return il;
+  return nl;
 }
 
 //----------------------------------------------------------------------
@@ -466,7 +457,6 @@ void Block::particle_apply_periodic_update_
 {
 
   const int rank = cello::rank();
-  const int level = this->level();
   const int min_face_rank = refresh->min_face_rank();
 
   double dpx[nl],dpy[nl],dpz[nl];
@@ -479,33 +469,25 @@ void Block::particle_apply_periodic_update_
 
   // Compute position updates for particles crossing periodic boundaries
 
-  ItNeighbor it_neighbor = this->it_neighbor(min_face_rank,index_,neighbor_leaf,0,0);
-
-  int il=0;
+  const std::vector<BlockNeighbor> & neighbors =
+    this->neighbors(min_face_rank,neighbor_leaf,0,0);
 
-  int if3[3];
-  while (it_neighbor.next(if3)) {
+  for (size_t il=0; il<neighbors.size(); il++) {
 
-    const int level_face = it_neighbor.face_level();
+    const BlockNeighbor & neighbor = neighbors[il];
 
-    int ic3[3];
-    it_neighbor.child(ic3);
-
-    const int refresh_type = 
-      (level_face == level - 1) ? refresh_coarse :
-      (level_face == level)     ? refresh_same :
-      (level_face == level + 1) ? refresh_fine : refresh_unknown;
+    int if3[3] = {neighbor.of3[0],neighbor.of3[1],neighbor.of3[2]};
+    int ic3[3] = {neighbor.ic3[0],neighbor.ic3[1],neighbor.ic3[2]};
 
     int index_lower[3] = {0,0,0};
     int index_upper[3] = {1,1,1};
-    refresh->index_limits (rank,refresh_type,if3,ic3,index_lower,index_upper);
+    refresh->index_limits
+      (rank,neighbor.refresh_type,if3,ic3,index_lower,index_upper);
 
     // ASSERT: il < nl
     particle_determine_periodic_update_
       (index_lower,index_upper,&dpx[il],&dpy[il],&dpz[il]);
 
-    il++;
-
   }
 
   ParticleDescr * p_descr = cello::particle_descr();
@@ -660,12 +642,14 @@ void Block::particle_send_
 
       MsgRefresh * msg = new MsgRefresh;
       msg->set_data_msg (data_msg);
+      msg->set_trace_id (trace_send_());
 
       thisProxy[index].p_refresh_store (msg);
 
     } else if (p_data) {
       
       MsgRefresh * msg = new MsgRefresh;
+      msg->set_trace_id (trace_send_());
 
       thisProxy[index].p_refresh_store (msg);
 
@@ -12,7 +12,7 @@
 ///       update_boundary_()
 ///       compute dt
 ///       compute stopping
-///       contribute( >>>>> Block::r_output() >>>>> )
+///       contribute( >>>>> Block::r_stopping_compute_timestep() >>>>> )
 
 #include "simulation.hpp"
 #include "mesh.hpp"
@@ -90,27 +90,30 @@ void Block::stopping_begin_()
 
     int stop_block = stopping->complete(cycle_,time_);
 
-    // Reduce to find Block array minimum dt and stopping criteria
+    // Deposit dt and stopping criteria with any other values
+    // deposited this cycle
 
-    double min_reduce[2];
+    reduce_deposit ("stopping:dt",  reduce_min, dt_block);
+    reduce_deposit ("stopping:stop",reduce_min, stop_block ? 1.0 : 0.0);
 
-    min_reduce[0] = dt_block;
-    min_reduce[1] = stop_block ? 1.0 : 0.0;
-
-    CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
-			 thisProxy);
+  }
 
-#ifdef TRACE_CONTRIBUTE    
-    CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
-	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
-#endif    
-    contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
+  // Reduce all deposited values in a single reduction, which also
+  // serves as the barrier between the output and stopping phases
 
-  } else {
+  const int size = reduce_combine_.data_size();
+  std::vector<char> buffer (size);
+  if (size > 0) reduce_combine_.save_data(&buffer[0]);
+  reduce_combine_.clear();
 
-    stopping_balance_();
+  CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
+		       thisProxy);
 
-  }
+#ifdef TRACE_CONTRIBUTE    
+  CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
+	    name().c_str(),__FILE__,__LINE__); fflush(stdout);
+#endif    
+  contribute(size, size ? &buffer[0] : NULL, r_reduce_combine_type, callback);
 
 }
 
@@ -121,25 +124,37 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
   performance_start_(perf_stopping);
   
   TRACE_STOPPING("Block::r_stopping_compute_timestep");
-  
-  ++age_;
 
-  double * min_reduce = (double * )msg->getData();
+  // Combined results are the same for all Blocks, so are stored once
+  // per process
+
+  ReduceCombine & result = ReduceCombine::result();
 
-  dt_   = min_reduce[0];
-  stop_ = min_reduce[1] == 1.0 ? true : false;
+  result.load_data((const char *)msg->getData(),msg->getSize());
 
   delete msg;
 
   Simulation * simulation = cello::simulation();
 
-  dt_ *= Method::courant_global;
+  long double dt_reduce;
+  long double stop_reduce;
+
+  if (result.value("stopping:dt",&dt_reduce) &&
+      result.value("stopping:stop",&stop_reduce)) {
+
+    ++age_;
+
+    dt_   = dt_reduce;
+    stop_ = stop_reduce == 1.0 ? true : false;
+
+    dt_ *= Method::courant_global;
   
-  set_dt   (dt_);
-  set_stop (stop_);
+    set_dt   (dt_);
+    set_stop (stop_);
 
-  simulation->set_dt(dt_);
-  simulation->set_stop(stop_);
+    simulation->set_dt(dt_);
+    simulation->set_stop(stop_);
+  }
 
 #ifdef CONFIG_USE_PROJECTIONS
   // COMMENTED OUT--BUGGY, projections_schedule_on() crashed with bad schedule_on object
@@ -250,27 +265,27 @@ void Block::exit_()
   TRACE_STOPPING("Block::exit_");
   const int in = cello::index_static();
   if (index().is_root()) {
-    if (MsgRefresh::counter[in] != 0) {
-      CkPrintf ("%d Block::exit_() MsgRefresh::counter = %ld != 0\n",
-		CkMyPe(),MsgRefresh::counter[in]);
+    if (cello::message_counters(in).msg_refresh != 0) {
+      CkPrintf ("%d Block::exit_() MsgRefresh counter = %ld != 0\n",
+		CkMyPe(),cello::message_counters(in).msg_refresh);
     }
-    if (MsgRefine::counter[in] != 0) {
-      CkPrintf ("%d Block::exit_() MsgRefine::counter = %ld != 0\n",
-		CkMyPe(),MsgRefine::counter[in]);
+    if (cello::message_counters(in).msg_refine != 0) {
+      CkPrintf ("%d Block::exit_() MsgRefine counter = %ld != 0\n",
+		CkMyPe(),cello::message_counters(in).msg_refine);
     }
-    if (MsgCoarsen::counter[in] != 0) {
-      CkPrintf ("%d Block::exit_() MsgCoarsen::counter = %ld != 0\n",
-		CkMyPe(),MsgCoarsen::counter[in]);
+    if (cello::message_counters(in).msg_coarsen != 0) {
+      CkPrintf ("%d Block::exit_() MsgCoarsen counter = %ld != 0\n",
+		CkMyPe(),cello::message_counters(in).msg_coarsen);
     }
-    if (FieldFace::counter[in] != 0) {
-      CkPrintf ("%d Block::exit_() FieldFace::counter = %ld != 0\n",
-		CkMyPe(),FieldFace::counter[in]);
+    if (cello::message_counters(in).field_face != 0) {
+      CkPrintf ("%d Block::exit_() FieldFace counter = %ld != 0\n",
+		CkMyPe(),cello::message_counters(in).field_face);
     }
-    if (DataMsg::counter[in] != 0) {
-      CkPrintf ("%d Block::exit_() DataMsg::counter = %ld != 0\n",
-		CkMyPe(),DataMsg::counter[in]);
-      CkPrintf ("%d Block::exit_() ParticleData::counter = %ld != 0\n",
-		CkMyPe(),ParticleData::counter[in]);
+    if (cello::message_counters(in).data_msg != 0) {
+      CkPrintf ("%d Block::exit_() DataMsg counter = %ld != 0\n",
+		CkMyPe(),cello::message_counters(in).data_msg);
+      CkPrintf ("%d Block::exit_() ParticleData counter = %ld != 0\n",
+		CkMyPe(),cello::message_counters(in).particle_data);
     }
   }
   if (index_.is_root()) {
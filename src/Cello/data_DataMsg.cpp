@@ -9,8 +9,6 @@
 
 // #define DEBUG_DATA_MSG
 
-long DataMsg::counter[CONFIG_NODE_SIZE] = {0};
-
 //----------------------------------------------------------------------
 
 int DataMsg::data_size () const
@@ -30,16 +28,18 @@ int DataMsg::data_size () const
 
   const int n_ff = (ff) ? ff->data_size() : 0;
   const int n_fa = (fa) ? ff->num_bytes_array(field) : 0;
+  const int n_fc = (n_ff > 0 && n_fa > 0) ? pack_field_array_(field,n_fa) : 0;
   const int n_pa = (pd) ? pd->data_size(particle_descr) : 0;
 
   int size = 0;
 
   size += sizeof(int); // n_ff_
   size += sizeof(int); // n_fa_
+  size += sizeof(int); // n_fc_
   size += sizeof(int); // n_pa_
 
   size += n_ff*sizeof(char);
-  size += n_fa*sizeof(char);
+  size += (n_fc > 0 ? n_fc : n_fa)*sizeof(char);
   size += n_pa*sizeof(char);
 
   return size;
@@ -74,18 +74,30 @@ char * DataMsg::save_data (char * buffer) const
 
   const int n_ff = (ff) ? ff->data_size() : 0;
   const int n_fa = (fa) ? ff->num_bytes_array(field) : 0;
+  const int n_fc = (n_ff > 0 && n_fa > 0) ? pack_field_array_(field,n_fa) : 0;
   const int n_pa = (pd) ? pd->data_size(particle_descr) : 0;
 
   (*pi++) = n_ff;
   (*pi++) = n_fa;
+  (*pi++) = n_fc;
   (*pi++) = n_pa;
 
   if (n_ff > 0) {
     pc = ff->save_data (pc);
   }
   if (n_ff > 0 && n_fa > 0) {
-    ff->face_to_array(field,pc);
-    pc += n_fa;
+    if (n_fc > 0) {
+      // compressed array
+      memcpy (pc, &field_buffer_[0], n_fc);
+      pc += n_fc;
+    } else if (field_buffer_.size() > 0) {
+      // compression attempted but not used: array already serialized
+      memcpy (pc, &field_buffer_[0], n_fa);
+      pc += n_fa;
+    } else {
+      ff->face_to_array(field,pc);
+      pc += n_fa;
+    }
   }
   if (n_pa > 0) {
     pc = pd->save_data(particle_descr,pc);
@@ -131,13 +143,35 @@ char * DataMsg::load_data (char * buffer)
 
   const int n_ff = (*pi++);
   const int n_fa = (*pi++);
+  const int n_fc = (*pi++);
   const int n_pa = (*pi++);
 
   if (n_ff > 0) {
     pc = field_face_->load_data (pc);
   }
 
-  if (n_fa > 0) {
+  if (n_fa > 0 && n_fc > 0) {
+
+    const int in = cello::index_static();
+    const double time_start = CkWallTimer();
+
+    // element sizes of each field are stored with the compressed data
+
+    field_buffer_.resize(n_fa);
+    const bool ok = FieldCompress::decompress
+      (pc, n_fc, &field_buffer_[0], n_fa);
+
+    ASSERT2 ("DataMsg::load_data()",
+             "Corrupt compressed field array (%d bytes compressed, %d bytes)",
+             n_fc,n_fa, ok);
+
+    field_array_ = &field_buffer_[0];
+    pc += n_fc;
+
+    cello::message_counters(in).compress_usec +=
+      (long long)(1e6*(CkWallTimer() - time_start));
+
+  } else if (n_fa > 0) {
     field_array_ = pc;
     pc += n_fa;
   } else {
@@ -162,6 +196,53 @@ char * DataMsg::load_data (char * buffer)
 
 //----------------------------------------------------------------------
 
+int DataMsg::pack_field_array_ (Field & field, int n_fa) const
+{
+  if (field_compressed_ >= 0) return field_compressed_;
+
+  field_compressed_ = 0;
+
+  const int min_bytes = cello::config()->field_compress_min_bytes;
+
+  // Only serialize into the scratch buffer if compression is
+  // attempted; otherwise save_data() writes directly into the message
+
+  if (min_bytes > 0 && n_fa >= min_bytes) {
+
+    field_buffer_.resize(n_fa);
+    field_face_->face_to_array(field,&field_buffer_[0]);
+
+    const int in = cello::index_static();
+    const double time_start = CkWallTimer();
+
+    // shuffle each field with its own precision
+
+    std::vector<int> segment_bytes, element_size;
+    field_face_->array_segments (field, segment_bytes, element_size);
+
+    std::vector<char> buffer;
+    const int n_fc = FieldCompress::compress
+      (&field_buffer_[0], n_fa, segment_bytes, element_size, buffer);
+
+    // only send compressed if it saves at least 1/8 of the bytes
+
+    if (n_fc < n_fa - n_fa/8) {
+      field_buffer_.swap(buffer);
+      field_compressed_ = n_fc;
+    }
+
+    cello::message_counters(in).compress_bytes_raw += n_fa;
+    cello::message_counters(in).compress_bytes     += (field_compressed_ > 0) ?
+      field_compressed_ : n_fa;
+    cello::message_counters(in).compress_usec +=
+      (long long)(1e6*(CkWallTimer() - time_start));
+  }
+
+  return field_compressed_;
+}
+
+//----------------------------------------------------------------------
+
 void DataMsg::update (Data * data, bool is_local)
 {
   Simulation * simulation  = cello::simulation();
@@ -16,23 +16,22 @@ class DataMsg {
 
 public: // interface
 
-  static long counter[CONFIG_NODE_SIZE];
-
   DataMsg() 
     : field_face_   (NULL),
       field_data_   (NULL),
       particle_data_(NULL),
       field_face_delete_   (false),
       field_data_delete_   (false),
-      particle_data_delete_(false)
-      
+      particle_data_delete_(false),
+      field_buffer_(),
+      field_compressed_(-1)
   {
-    ++counter[cello::index_static()]; 
+    ++cello::message_counters().data_msg; 
   }
 
   ~DataMsg()
   {
-    --counter[cello::index_static()];
+    --cello::message_counters().data_msg;
     
     if (field_face_delete_) {
       delete field_face_;
@@ -51,7 +50,7 @@ public: // interface
   /// Copy constructor
   DataMsg(const DataMsg & data_msg) throw()
   {
-    ++counter[cello::index_static()]; 
+    ++cello::message_counters().data_msg; 
   };
 
   /// Assignment operator
@@ -147,7 +146,16 @@ public: // interface
   }
 public: // static methods
 
-  
+protected: // functions
+
+  /// If Field:compress_min_bytes is enabled and the array is at least
+  /// that large, serialize the field face array into field_buffer_
+  /// and compress it if that saves enough space.  Returns the
+  /// compressed size, or 0 if the array is sent uncompressed, in
+  /// which case field_buffer_ holds it only if compression was
+  /// attempted.
+  int pack_field_array_ (Field & field, int n_fa) const;
+
 protected: // attributes
 
   /// Field Face Data
@@ -176,6 +184,14 @@ protected: // attributes
   /// Whethere FieldFace data should be deleted in destructor
   bool particle_data_delete_;
 
+  /// Serialized (possibly compressed) field array when sending, or
+  /// decompressed field array when receiving
+  mutable std::vector<char> field_buffer_;
+
+  /// Compressed size of field_buffer_, 0 if uncompressed, or -1 if
+  /// not yet serialized
+  mutable int field_compressed_;
+
 };
 
 #endif /* DATA_DATA_MSG_HPP */
@@ -0,0 +1,282 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldCompress.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of the FieldCompress class
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  // LZ77 parameters
+
+  const int min_match  = 4;
+  const int hash_bits  = 12;
+  const int max_offset = 65535;
+
+  // number of trailing bytes always stored as literals
+  const int last_literals = 5;
+
+  inline unsigned int read32_ (const unsigned char * p)
+  {
+    unsigned int v;
+    memcpy (&v,p,sizeof(v));
+    return v;
+  }
+
+  inline int hash_ (unsigned int v)
+  { return (v * 2654435761u) >> (32 - hash_bits); }
+
+  // write length l >= 15 extension bytes
+
+  inline unsigned char * write_length_ (unsigned char * op, int l)
+  {
+    for (; l >= 255; l -= 255) *op++ = 255;
+    *op++ = (unsigned char)(l);
+    return op;
+  }
+
+  // read a length extension, returning false if past the end of input
+
+  inline bool read_length_ (const unsigned char *& ip,
+                            const unsigned char * ip_end, int & l)
+  {
+    unsigned char c;
+    do {
+      if (ip >= ip_end) return false;
+      c = *ip++;
+      l += c;
+    } while (c == 255);
+    return true;
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+int FieldCompress::compress
+(const char * array, int n,
+ const std::vector<int> & segment_bytes,
+ const std::vector<int> & element_size,
+ std::vector<char> & buffer)
+{
+  const int ns = (n > 0) ? segment_bytes.size() : 0;
+
+  ASSERT2 ("FieldCompress::compress()",
+           "Number of segment sizes %d and element sizes %d differ",
+           int(segment_bytes.size()),int(element_size.size()),
+           (segment_bytes.size() == element_size.size()));
+
+  // header: number of segments, then bytes and element size of each
+
+  const int n_header = (1 + 2*ns)*sizeof(int);
+
+  if (n <= 0) {
+    buffer.assign(n_header,0);
+    return n_header;
+  }
+
+  std::vector<int> header (1 + 2*ns);
+  header[0] = ns;
+
+  std::vector<char> shuffled (n);
+  int offset = 0;
+  for (int is=0; is<ns; is++) {
+    shuffle_ (array + offset, &shuffled[offset],
+              segment_bytes[is], element_size[is]);
+    header[1+2*is] = segment_bytes[is];
+    header[2+2*is] = element_size[is];
+    offset += segment_bytes[is];
+  }
+
+  ASSERT2 ("FieldCompress::compress()",
+           "Segments total %d bytes but array has %d",
+           offset,n, (offset == n));
+
+  // worst case: all literals
+
+  buffer.resize(n_header + n + n/255 + 16);
+
+  memcpy (&buffer[0], &header[0], n_header);
+  const int size = n_header + encode_(&shuffled[0],n,&buffer[n_header]);
+  buffer.resize(size);
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+bool FieldCompress::decompress
+(const char * buffer, int n_in, char * array, int n)
+{
+  int ns;
+  if (n_in < int(sizeof(int))) return false;
+  memcpy (&ns, buffer, sizeof(int));
+
+  const int n_header = (1 + 2*ns)*sizeof(int);
+  if (ns < 0 || n_in < n_header) return false;
+
+  if (n <= 0) return (ns == 0 && n_in == n_header);
+
+  std::vector<int> header (2*ns);
+  if (ns > 0) memcpy (&header[0], buffer + sizeof(int), 2*ns*sizeof(int));
+
+  int total = 0;
+  for (int is=0; is<ns; is++) {
+    if (header[2*is] < 0 || header[2*is+1] <= 0) return false;
+    total += header[2*is];
+  }
+  if (total != n) return false;
+
+  std::vector<char> shuffled (n);
+  if (! decode_(buffer + n_header,n_in - n_header,&shuffled[0],n))
+    return false;
+
+  int offset = 0;
+  for (int is=0; is<ns; is++) {
+    unshuffle_ (&shuffled[offset], array + offset,
+                header[2*is], header[2*is+1]);
+    offset += header[2*is];
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void FieldCompress::shuffle_
+(const char * in, char * out, int n, int element_size)
+{
+  const int m = n / element_size;
+  for (int ib=0; ib<element_size; ib++) {
+    char * o = out + ib*m;
+    for (int i=0; i<m; i++) {
+      o[i] = in[i*element_size + ib];
+    }
+  }
+  // trailing bytes not forming a whole element
+  for (int i=m*element_size; i<n; i++) out[i] = in[i];
+}
+
+//----------------------------------------------------------------------
+
+void FieldCompress::unshuffle_
+(const char * in, char * out, int n, int element_size)
+{
+  const int m = n / element_size;
+  for (int ib=0; ib<element_size; ib++) {
+    const char * p = in + ib*m;
+    for (int i=0; i<m; i++) {
+      out[i*element_size + ib] = p[i];
+    }
+  }
+  for (int i=m*element_size; i<n; i++) out[i] = in[i];
+}
+
+//----------------------------------------------------------------------
+
+int FieldCompress::encode_ (const char * in_c, int n, char * out_c)
+{
+  const unsigned char * in = (const unsigned char *) in_c;
+  unsigned char * op = (unsigned char *) out_c;
+
+  int table[1 << hash_bits];
+  std::fill_n (table, 1 << hash_bits, -1);
+
+  int anchor = 0;
+  int ip = 0;
+  const int ip_limit = n - last_literals - min_match;
+
+  while (ip <= ip_limit) {
+
+    const unsigned int v = read32_(in + ip);
+    const int h = hash_(v);
+    const int ref = table[h];
+    table[h] = ip;
+
+    if (ref < 0 || ip - ref > max_offset || read32_(in + ref) != v) {
+      ++ip;
+      continue;
+    }
+
+    // extend match, leaving the last literals unmatched
+
+    int ml = min_match;
+    const int ml_max = n - last_literals - ip;
+    while (ml < ml_max && in[ref + ml] == in[ip + ml]) ++ml;
+
+    // emit literals [anchor,ip) then match (ip - ref, ml)
+
+    const int ll = ip - anchor;
+    unsigned char * token = op++;
+    *token = (unsigned char)
+      (((ll >= 15 ? 15 : ll) << 4) |
+       (ml - min_match >= 15 ? 15 : ml - min_match));
+    if (ll >= 15) op = write_length_(op,ll - 15);
+    memcpy (op, in + anchor, ll);
+    op += ll;
+
+    const int offset = ip - ref;
+    *op++ = (unsigned char)(offset & 0xff);
+    *op++ = (unsigned char)(offset >> 8);
+
+    if (ml - min_match >= 15) op = write_length_(op,ml - min_match - 15);
+
+    ip += ml;
+    anchor = ip;
+  }
+
+  // final literals
+
+  const int ll = n - anchor;
+  *op++ = (unsigned char)((ll >= 15 ? 15 : ll) << 4);
+  if (ll >= 15) op = write_length_(op,ll - 15);
+  memcpy (op, in + anchor, ll);
+  op += ll;
+
+  return op - (unsigned char *) out_c;
+}
+
+//----------------------------------------------------------------------
+
+bool FieldCompress::decode_ (const char * in_c, int n_in, char * out_c, int n)
+{
+  const unsigned char * ip     = (const unsigned char *) in_c;
+  const unsigned char * ip_end = ip + n_in;
+  unsigned char * out = (unsigned char *) out_c;
+  int op = 0;
+
+  while (ip < ip_end) {
+
+    const int token = *ip++;
+
+    // literals
+
+    int ll = token >> 4;
+    if (ll == 15 && ! read_length_(ip,ip_end,ll)) return false;
+    if (ip + ll > ip_end || op + ll > n) return false;
+    memcpy (out + op, ip, ll);
+    ip += ll;
+    op += ll;
+
+    if (op == n) return (ip == ip_end);
+
+    // match
+
+    if (ip + 2 > ip_end) return false;
+    const int offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    int ml = token & 15;
+    if (ml == 15 && ! read_length_(ip,ip_end,ml)) return false;
+    ml += min_match;
+    if (offset == 0 || offset > op || op + ml > n) return false;
+
+    // byte copy, since the match may overlap its own output
+    const unsigned char * ref = out + op - offset;
+    for (int i=0; i<ml; i++) out[op+i] = ref[i];
+    op += ml;
+  }
+
+  return (op == n);
+}
@@ -0,0 +1,61 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldCompress.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Data] Declaration of the FieldCompress class
+
+#ifndef DATA_FIELD_COMPRESS_HPP
+#define DATA_FIELD_COMPRESS_HPP
+
+class FieldCompress {
+
+  /// @class    FieldCompress
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Lossless compression of serialized field
+  /// face arrays
+  ///
+  /// Bytes are first shuffled so that the i'th bytes of all elements
+  /// are contiguous, which groups the slowly-varying sign and
+  /// exponent bytes of smooth fields, and then compressed with a
+  /// simple LZ77 byte coder (LZ4-style sequences of literals and
+  /// matches).  Both steps are exactly invertible.
+
+public: // static methods
+
+  /// Compress n bytes of array into buffer, which is resized as
+  /// needed.  The array is a sequence of segments (e.g. one per field)
+  /// of segment_bytes[i] bytes with elements of element_size[i] bytes,
+  /// each shuffled separately; the segment sizes are stored in the
+  /// buffer.  Returns the compressed size.
+  static int compress (const char * array, int n,
+                       const std::vector<int> & segment_bytes,
+                       const std::vector<int> & element_size,
+                       std::vector<char> & buffer);
+
+  /// Compress n bytes of array with elements of a single size
+  static int compress (const char * array, int n, int element_size,
+                       std::vector<char> & buffer)
+  {
+    return compress (array, n, std::vector<int>(1,n),
+                     std::vector<int>(1,element_size), buffer);
+  }
+
+  /// Decompress n_in bytes of buffer into the n bytes of array.
+  /// Returns false if the input is corrupt.
+  static bool decompress (const char * buffer, int n_in,
+                          char * array, int n);
+
+private: // static methods
+
+  /// Byte shuffle and its inverse
+  static void shuffle_ (const char * in, char * out, int n, int element_size);
+  static void unshuffle_ (const char * in, char * out, int n, int element_size);
+
+  /// LZ77 coder and decoder
+  static int encode_ (const char * in, int n, char * out);
+  static bool decode_ (const char * in, int n_in, char * out, int n);
+
+};
+
+#endif /* DATA_FIELD_COMPRESS_HPP */
@@ -8,21 +8,25 @@
 #include "cello.hpp"
 #include "data.hpp"
 
-long FieldFace::counter[CONFIG_NODE_SIZE] = {0};
+FieldFace::PlanCache FieldFace::plan_cache_[CONFIG_NODE_SIZE];
 
 #define FORTRAN_NAME(NAME) NAME##_
 
 extern "C" void FORTRAN_NAME(field_face_store_4)
-  (float * field, float * array, int * m3, int * n3, int * accumulate);
+  (float * field, const float * array, const int * m3, const int * n3,
+   int * accumulate);
 extern "C" void FORTRAN_NAME(field_face_store_8)
-  (double * field, double * array, int * m3, int * n3, int * accumulate);
+  (double * field, const double * array, const int * m3, const int * n3,
+   int * accumulate);
 extern "C" void FORTRAN_NAME(field_face_store_16)
-  (long double * field, long double * array, int * m3, int * n3, int * accumulate);
+  (long double * field, const long double * array, const int * m3,
+   const int * n3, int * accumulate);
 
 enum enum_op_type {
   op_unknown,
   op_load,
-  op_store
+  op_store,
+  op_copy
 };
 
 //----------------------------------------------------------------------
@@ -35,7 +39,7 @@ FieldFace::FieldFace
      refresh_(NULL),
      new_refresh_(false)
 {
-  ++counter[cello::index_static()];
+  ++cello::message_counters().field_face;
 
   for (int i=0; i<3; i++) {
     ghost_[i] = false;
@@ -51,7 +55,7 @@ FieldFace::~FieldFace() throw ()
 #ifdef DEBUG_FIELD_FACE  
   CkPrintf ("%d %s:%d DEBUG_FIELD_FACE deleting %p\n",CkMyPe(),__FILE__,__LINE__,this);
 #endif
-  --counter[cello::index_static()];
+  --cello::message_counters().field_face;
 
   if (new_refresh_) {
     delete refresh_;
@@ -72,7 +76,7 @@ FieldFace::FieldFace(const FieldFace & field_face) throw ()
 #ifdef DEBUG_FIELD_FACE  
   CkPrintf ("%d %s:%d DEBUG_FIELD_FACE creating %p(%p)\n",CkMyPe(),__FILE__,__LINE__,this,&field_face);
 #endif  
-  ++counter[cello::index_static()];
+  ++cello::message_counters().field_face;
 
   copy_(field_face);
 }
@@ -153,7 +157,8 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 {
   size_t index_array = 0;
 
-  std::vector <int> field_list = field_list_src_(field);
+  const std::vector<int> field_list     = field_list_src_(field);
+  const std::vector<int> field_list_dst = field_list_dst_(field);
 
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -161,7 +166,7 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
   
     precision_type precision = field.precision(index_field);
 
-    const void * field_face = field.values(index_field);
+    const char * field_face = field.values(index_field);
 
     char * array_face  = &array[index_array];
 
@@ -171,21 +176,17 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
-    const bool accumulate = accumulate_(index_src,index_dst);
+    const bool accumulate = accumulate_(field_list[i_f],field_list_dst[i_f]);
+
+    const FieldFacePlan & plan = plan_(op_load,m3,g3,c3,accumulate);
 
-    int i3[3], n3[3];
-    if (!accumulate) {
-      loop_limits (i3,n3,m3,g3,c3,op_load);
-    } else {
-      loop_limits_accumulate (i3,n3,m3,g3,c3,op_load);
-    }
-  
     if (refresh_type_ == refresh_coarse) {
 
       // Restrict field to array
 
+      int i3[3] = {plan.i3[0],plan.i3[1],plan.i3[2]};
+      int n3[3] = {plan.n3[0],plan.n3[1],plan.n3[2]};
+
       int nc3[3] = { (n3[0]+1)/2, (n3[1]+1)/2,(n3[2]+1)/2 };
 
       int i3_array[3] = {0,0,0};
@@ -200,22 +201,12 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     } else {
 
-      union { float * a4; double * a8; long double * a16; };
-      union { float * f4; double * f8;long double * f16;  };
-      a4 = (float *) array_face;
-      f4 = (float *) field_face;
-      
-      // Copy field to array
-      
-      if (precision == precision_single) {
-	index_array += load_ ( a4,  f4,  m3,n3,i3, accumulate);
-      } else if (precision == precision_double) {
-	index_array += load_ ( a8,  f8,  m3,n3,i3, accumulate);
-      } else if (precision == precision_quadruple) {
-	index_array += load_ ( a16, f16, m3,n3,i3, accumulate);
-      } else {
-	ERROR("FieldFace::face_to_array", "Unsupported precision");
-      }
+      // Copy field to array; accumulate is handled in array_to_face()
+      // at the receiving end
+
+      index_array += copy_runs_
+	(precision, array_face, field_face, plan, false);
+
     }
   }
 
@@ -227,7 +218,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
 {
   size_t index_array = 0;
 
-  std::vector<int> field_list = field_list_dst_(field);
+  const std::vector<int> field_list     = field_list_dst_(field);
+  const std::vector<int> field_list_src = field_list_src_(field);
   
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -245,16 +237,9 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
-    const bool accumulate = accumulate_(index_src,index_dst);
+    const bool accumulate = accumulate_(field_list_src[i_f],field_list[i_f]);
 
-    int i3[3], n3[3];
-    if (!accumulate) {
-      loop_limits (i3,n3,m3,g3,c3,op_store);
-    } else {
-      loop_limits_accumulate (i3,n3,m3,g3,c3,op_store);
-    }
+    const FieldFacePlan & plan = plan_(op_store,m3,g3,c3,accumulate);
 
     if (refresh_type_ == refresh_fine) {
 
@@ -266,6 +251,9 @@ void FieldFace::array_to_face (char * array, Field field) throw()
 	     "Odd ghost zones not implemented yet: prolong needs padding",
 	     ! need_padding);
 
+      int i3[3] = {plan.i3[0],plan.i3[1],plan.i3[2]};
+      int n3[3] = {plan.n3[0],plan.n3[1],plan.n3[2]};
+
       int nc3[3] = { (n3[0]+1)/2, (n3[1]+1)/2, (n3[2]+1)/2 };
 
       int i3_array[3] = {0,0,0};
@@ -283,22 +271,10 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     } else {
 
       // Copy array to field
-      union { float * as4; double * as8; long double * as16; };
-      union { float * fd4; double * fd8;long double * fd16;  };
-      as4 = (float *) array_ghost;
-      fd4 = (float *) field_ghost;
-      
-      // Copy field to array
-
-      if (precision == precision_single) {
-	index_array += store_ ( fd4,  as4,  m3,n3,i3, accumulate);
-      } else if (precision == precision_double) {
-	index_array += store_ ( fd8,  as8,  m3,n3,i3, accumulate);
-      } else if (precision == precision_quadruple) {
-	index_array += store_ ( fd16, as16, m3,n3,i3, accumulate);
-      } else {
-	ERROR("FieldFace::array_to_face()", "Unsupported precision");
-      }
+
+      index_array += store_
+	(precision, field_ghost, array_ghost, m3, plan, accumulate);
+
     }
   }
 }
@@ -324,82 +300,57 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
     
     const bool accumulate = accumulate_(index_src,index_dst);
 
-    int is3[3], ns3[3];
-    if (!accumulate) {
-      loop_limits (is3,ns3,m3,g3,c3,op_load);
-    } else {
-      loop_limits_accumulate (is3,ns3,m3,g3,c3,op_load);
-    }
-
-    invert_face();
-
-    int id3[3], nd3[3];
-    if (!accumulate) {
-      loop_limits (id3,nd3,m3,g3,c3,op_store);
-    } else {
-      loop_limits_accumulate (id3,nd3,m3,g3,c3,op_store);
-    }
-
-    invert_face();
-
-    // Adjust loop limits if accumulating to include ghost zones
-    // on neighbor axes
+    const FieldFacePlan & plan = plan_(op_copy,m3,g3,c3,accumulate);
 
     precision_type precision = field_src.precision(index_src);
     
     char * values_src = field_src.values(index_src);
     char * values_dst = field_dst.values(index_dst);
     
-    Problem * problem = cello::problem();
+    if (refresh_type_ == refresh_fine || refresh_type_ == refresh_coarse) {
 
-    if (refresh_type_ == refresh_fine) {
+      int is3[3] = {plan.i3[0], plan.i3[1], plan.i3[2]};
+      int ns3[3] = {plan.n3[0], plan.n3[1], plan.n3[2]};
+      int id3[3] = {plan.id3[0],plan.id3[1],plan.id3[2]};
+      int nd3[3] = {plan.nd3[0],plan.nd3[1],plan.nd3[2]};
 
-      // Prolong field
+      Problem * problem = cello::problem();
 
-      bool need_padding = (g3[0]%2==1) || (g3[1]%2==1) || (g3[2]%2==1);
+      if (refresh_type_ == refresh_fine) {
 
-      ASSERT("FieldFace::face_to_face()",
-	     "Odd ghost zones not implemented yet: prolong needs padding",
-	     ! need_padding);
+	// Prolong field
 
-      Prolong * prolong = prolong_ ? prolong_ : problem->prolong();
+	bool need_padding = (g3[0]%2==1) || (g3[1]%2==1) || (g3[2]%2==1);
 
-      prolong->apply (precision, 
-		      values_dst,m3,id3, nd3,
-		      values_src,m3,is3, ns3,
-		      accumulate);
+	ASSERT("FieldFace::face_to_face()",
+	       "Odd ghost zones not implemented yet: prolong needs padding",
+	       ! need_padding);
 
-    } else if (refresh_type_ == refresh_coarse) {
+	Prolong * prolong = prolong_ ? prolong_ : problem->prolong();
 
-      // Restrict field
+	prolong->apply (precision, 
+			values_dst,m3,id3, nd3,
+			values_src,m3,is3, ns3,
+			accumulate);
 
-      Restrict * restrict = restrict_ ? restrict_ : problem->restrict();
+      } else {
 
-      restrict->apply (precision, 
-		       values_dst,m3,id3, nd3,
-		       values_src,m3,is3, ns3,
-		       accumulate);
+	// Restrict field
+
+	Restrict * restrict = restrict_ ? restrict_ : problem->restrict();
+
+	restrict->apply (precision, 
+			 values_dst,m3,id3, nd3,
+			 values_src,m3,is3, ns3,
+			 accumulate);
+      }
 
     } else {
 
       // Copy faces to ghosts
 
-      union { float * fs4; double * fs8; long double * fs16; };
-      union { float * fd4; double * fd8;long double * fd16;  };
-      fs4 = (float *) values_src;
-      fd4 = (float *) values_dst;
-      
-      // Copy field to array
-
-      if (precision == precision_single) {
-	copy_ ( fd4, m3,nd3,id3,fs4, m3, ns3,is3,accumulate);
-      } else if (precision == precision_double) {
-	copy_ ( fd8, m3,nd3,id3,fs8, m3, ns3,is3,accumulate);
-      } else if (precision == precision_quadruple) {
-	copy_ ( fd16,m3,nd3,id3,fs16,m3,ns3,is3,accumulate);
-      } else {
-	ERROR("FieldFace::face_to_face()", "Unsupported precision");
-      }
+      copy_runs_ (precision, values_dst, values_src, plan, accumulate);
+
     }
   }
 }
@@ -408,9 +359,35 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 
 int FieldFace::num_bytes_array(Field field) throw()
 {
+  std::vector<int> segment_bytes, element_size;
+
+  array_segments (field, segment_bytes, element_size);
+
   int array_size = 0;
+  for (size_t i=0; i<segment_bytes.size(); i++) {
+    array_size += segment_bytes[i];
+  }
 
-  std::vector<int> field_list = field_list_src_(field);
+  ASSERT("FieldFace::num_bytes_array()",
+	 "array_size must be > 0, maybe field_list.size() is 0?",
+	 array_size);
+
+  return array_size;
+
+}
+
+//----------------------------------------------------------------------
+
+void FieldFace::array_segments
+(Field field,
+ std::vector<int> & segment_bytes,
+ std::vector<int> & element_size) throw()
+{
+  const std::vector<int> field_list     = field_list_src_(field);
+  const std::vector<int> field_list_dst = field_list_dst_(field);
+
+  segment_bytes.resize(field_list.size());
+  element_size.resize(field_list.size());
 
   for (size_t i_f=0; i_f < field_list.size(); i_f++) {
 
@@ -425,28 +402,15 @@ int FieldFace::num_bytes_array(Field field) throw()
     field.ghost_depth(index_field,&g3[0],&g3[1],&g3[2]);
     field.centering(index_field,&c3[0],&c3[1],&c3[2]);
 
-    int index_src = field_list_src_(field)[i_f];
-    int index_dst = field_list_dst_(field)[i_f];
-    const bool accumulate = accumulate_(index_src,index_dst);
+    const bool accumulate = accumulate_(field_list[i_f],field_list_dst[i_f]);
     int op_type = (refresh_type_ == refresh_fine) ? op_load : op_store;
 
-    int i3[3], n3[3];
-    if (!accumulate) {
-      loop_limits (i3,n3,m3,g3,c3,op_type);
-    } else {
-      loop_limits_accumulate (i3,n3,m3,g3,c3,op_type);
-    }
+    const int * n3 = plan_(op_type,m3,g3,c3,accumulate).n3;
 
-    array_size += n3[0]*n3[1]*n3[2]*bytes_per_element;
+    segment_bytes[i_f] = n3[0]*n3[1]*n3[2]*bytes_per_element;
+    element_size[i_f]  = bytes_per_element;
 
   }
-
-  ASSERT("FieldFace::num_bytes_array()",
-	 "array_size must be > 0, maybe field_list.size() is 0?",
-	 array_size);
-
-  return array_size;
-
 }
 
 //----------------------------------------------------------------------
@@ -529,144 +493,201 @@ char * FieldFace::load_data (char * buffer)
 
 //======================================================================
 
-template<class T>
-size_t FieldFace::load_
-( T * array_face, const T * field_face, 
-  int m3[3], int n3[3],int i3[3], bool accumulate ) throw()
+const FieldFacePlan & FieldFace::plan_
+(int op_type, const int m3[3], const int g3[3], const int c3[3],
+ bool accumulate)
 {
-  // NOTE: don't check accumulate since loading array; accumulate
-  // is handled in corresponding store_() at the receiving end
-  // add values
-
-  for (int iz=0; iz <n3[2]; iz++)  {
-    int kz = iz+i3[2];
-    for (int iy=0; iy < n3[1]; iy++) {
-      int ky = iy+i3[1];
-      for (int ix=0; ix < n3[0]; ix++) {
-	int kx = ix+i3[0];
-	int index_array = ix +   n3[0]*(iy +   n3[1] * iz);
-	int index_field = kx + m3[0]*(ky + m3[1] * kz);
-	array_face[index_array] = field_face[index_field];
-      }
-    }
+  const int in = cello::index_static();
+
+  plan_key_type key;
+  int k = 0;
+  key[k++] = op_type;
+  key[k++] = refresh_type_;
+  key[k++] = accumulate ? 1 : 0;
+  for (int axis=0; axis<3; axis++) {
+    key[k++] = face_[axis];
+    key[k++] = ghost_[axis] ? 1 : 0;
+    key[k++] = child_[axis];
+    key[k++] = m3[axis];
+    key[k++] = g3[axis];
+    key[k++] = c3[axis];
   }
 
-  return (sizeof(T) * n3[0] * n3[1] * n3[2]);
+  PlanCache & cache = plan_cache_[in];
 
-}
+  if (cache.last && key == cache.last_key) return *cache.last;
 
-//----------------------------------------------------------------------
+  std::map<plan_key_type,FieldFacePlan> & plan_map = cache.map;
 
-template<class T> size_t FieldFace::store_
-( T * ghost, const T * array,
-  int m3[3], int n3[3],int i3[3], bool accumulate) throw()
-{
-#define FORTRAN_STORE
+  std::map<plan_key_type,FieldFacePlan>::iterator it = plan_map.find(key);
 
-#ifdef FORTRAN_STORE
+  if (it != plan_map.end()) {
+    cache.last_key = key;
+    cache.last = &it->second;
+    return it->second;
+  }
 
-  // This is to get around a bug on SDSC Comet where this function
-  // crashes with -O3 (See Enzo-P / Cello bug report #90)
-  // http://client64-249.sdsc.edu/cello-bug/show_bug.cgi?id=90
+  ++cello::message_counters(in).field_face_plan;
 
-  union {
-    float *       ghost_4;
-    double *      ghost_8;
-    long double * ghost_16;
-  };
-  union {
-    float *       array_4;
-    double *      array_8;
-    long double * array_16;
-  };
-
-  ghost_4 = (float *) ghost;
-  array_4 = (float *) array;
-  
-  int im = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
+  FieldFacePlan & plan = plan_map[key];
 
-  int iaccumulate = accumulate ? 1 : 0;
+  const int op_src = (op_type == op_copy) ? op_load : op_type;
 
-  if (sizeof(T)==sizeof(float)) {
-    FORTRAN_NAME(field_face_store_4)(ghost_4 + im,   array_4, m3,n3,
-				     &iaccumulate);
-  } else if (sizeof(T)==sizeof(double)) {
-    FORTRAN_NAME(field_face_store_8)(ghost_8 + im,   array_8, m3,n3,
-				     &iaccumulate);
-  } else if (sizeof(T)==sizeof(long double)) {
-    FORTRAN_NAME(field_face_store_16)(ghost_16 + im, array_16, m3,n3,
-				      &iaccumulate);
+  if (!accumulate) {
+    loop_limits (plan.i3,plan.n3,m3,g3,c3,op_src);
   } else {
-    ERROR1 ("FieldFace::store_()",
-	   "unknown float precision sizeof(T) = %d\n",sizeof(T));
+    loop_limits_accumulate (plan.i3,plan.n3,m3,g3,c3,op_src);
   }
 
-#else
+  const int zero3[3] = {0,0,0};
 
-  if (accumulate) {
-    // add values
-    for (int iz=0; iz <n3[2]; iz++)  {
-      int kz = iz+i3[2];
-      for (int iy=0; iy < n3[1]; iy++) {
-	int ky = iy+i3[1];
-	for (int ix=0; ix < n3[0]; ix++) {
-	  int kx = ix+i3[0];
-	  int index_array = ix + n3[0]*(iy + n3[1] * iz);
-	  int index_field = kx + m3[0]*(ky + m3[1] * kz);
-	  ghost[index_field] += array[index_array];
-	}
-      }
+  if (op_type == op_copy) {
+
+    invert_face();
+    if (!accumulate) {
+      loop_limits (plan.id3,plan.nd3,m3,g3,c3,op_store);
+    } else {
+      loop_limits_accumulate (plan.id3,plan.nd3,m3,g3,c3,op_store);
     }
+    invert_face();
+
+    if (refresh_type_ != refresh_fine && refresh_type_ != refresh_coarse) {
+      plan_runs_ (&plan, m3,plan.i3, m3,plan.id3, plan.n3);
+    }
+
   } else {
-    // copy values
-    for (int iz=0; iz <n3[2]; iz++)  {
-      int kz = iz+i3[2];
-      for (int iy=0; iy < n3[1]; iy++) {
-	int ky = iy+i3[1];
-	for (int ix=0; ix < n3[0]; ix++) {
-	  int kx = ix+i3[0];
-	  int index_array = ix + n3[0]*(iy + n3[1] * iz);
-	  int index_field = kx + m3[0]*(ky + m3[1] * kz);
-	  ghost[index_field] = array[index_array];
-	}
-      }
+
+    for (int axis=0; axis<3; axis++) {
+      plan.id3[axis] = 0;
+      plan.nd3[axis] = plan.n3[axis];
+    }
+
+    // Stores use store_() instead of runs
+
+    if (op_type == op_load && refresh_type_ != refresh_coarse) {
+      plan_runs_ (&plan, m3,plan.i3, plan.n3,zero3, plan.n3);
     }
   }
 
-#endif
+  cache.last_key = key;
+  cache.last = &plan;
 
-  return (sizeof(T) * n3[0] * n3[1] * n3[2]);
+  return plan;
+}
 
+//----------------------------------------------------------------------
+
+void FieldFace::plan_runs_
+(FieldFacePlan * plan,
+ const int ms3[3], const int is3[3],
+ const int md3[3], const int id3[3], const int n3[3])
+{
+  std::vector<int> & run = plan->run;
+
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      const int i_src = is3[0] + ms3[0]*((iy+is3[1]) + ms3[1]*(iz+is3[2]));
+      const int i_dst = id3[0] + md3[0]*((iy+id3[1]) + md3[1]*(iz+id3[2]));
+      const int nr = run.size();
+      if (nr > 0 &&
+	  run[nr-3] + run[nr-1] == i_src &&
+	  run[nr-2] + run[nr-1] == i_dst) {
+	// contiguous with previous run in both arrays: extend it
+	run[nr-1] += n3[0];
+      } else {
+	run.push_back(i_src);
+	run.push_back(i_dst);
+	run.push_back(n3[0]);
+      }
+    }
+  }
 }
 
 //----------------------------------------------------------------------
 
-template<class T> void FieldFace::copy_
-( T       * vd, int md3[3],int nd3[3],int id3[3],
-  const T * vs, int ms3[3],int ns3[3],int is3[3],
-  bool accumulate) throw()
+template<class T> size_t FieldFace::copy_runs_
+( T * dst, const T * src, const FieldFacePlan & plan, bool accumulate) throw()
 {
+  const int nr = plan.run.size();
+  const int * run = plan.run.data();
+
+  size_t count = 0;
+
   if (accumulate) {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = (ix+is3[0]) + ms3[0]*((iy+is3[1]) + ms3[1] * (iz+is3[2]));
-	  int i_dst = (ix+id3[0]) + md3[0]*((iy+id3[1]) + md3[1] * (iz+id3[2]));
-	  vd[i_dst] += vs[i_src];
-	}
-      }
+    for (int ir=0; ir<nr; ir+=3) {
+      T       * vd = dst + run[ir+1];
+      const T * vs = src + run[ir];
+      const int n = run[ir+2];
+      for (int i=0; i<n; i++) vd[i] += vs[i];
+      count += n;
     }
   } else {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = (ix+is3[0]) + ms3[0]*((iy+is3[1]) + ms3[1] * (iz+is3[2]));
-	  int i_dst = (ix+id3[0]) + md3[0]*((iy+id3[1]) + md3[1] * (iz+id3[2]));
-	  vd[i_dst] = vs[i_src];
-	}
-      }
+    for (int ir=0; ir<nr; ir+=3) {
+      const int n = run[ir+2];
+      memcpy (dst + run[ir+1], src + run[ir], n*sizeof(T));
+      count += n;
     }
   }
+
+  return sizeof(T) * count;
+}
+
+//----------------------------------------------------------------------
+
+size_t FieldFace::copy_runs_
+( precision_type precision, char * dst, const char * src,
+  const FieldFacePlan & plan, bool accumulate) throw()
+{
+  if (precision == precision_single) {
+    return copy_runs_ ((float *) dst, (const float *) src,
+		       plan,accumulate);
+  } else if (precision == precision_double) {
+    return copy_runs_ ((double *) dst, (const double *) src,
+		       plan,accumulate);
+  } else if (precision == precision_quadruple) {
+    return copy_runs_ ((long double *) dst, (const long double *) src,
+		       plan,accumulate);
+  } else {
+    ERROR("FieldFace::copy_runs_()", "Unsupported precision");
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------
+
+size_t FieldFace::store_
+( precision_type precision, char * field, const char * array,
+  const int m3[3], const FieldFacePlan & plan, bool accumulate) throw()
+{
+  // Stores use Fortran loops to get around a bug on SDSC Comet where
+  // the equivalent C++ loops crash with -O3 (See Enzo-P / Cello bug
+  // report #90)
+  // http://client64-249.sdsc.edu/cello-bug/show_bug.cgi?id=90
+
+  const int * i3 = plan.i3;
+  const int * n3 = plan.n3;
+  const int im = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
+  const size_t count = size_t(n3[0])*n3[1]*n3[2];
+
+  int iaccumulate = accumulate ? 1 : 0;
+
+  if (precision == precision_single) {
+    FORTRAN_NAME(field_face_store_4)
+      ((float *) field + im, (const float *) array, m3,n3, &iaccumulate);
+    return sizeof(float) * count;
+  } else if (precision == precision_double) {
+    FORTRAN_NAME(field_face_store_8)
+      ((double *) field + im, (const double *) array, m3,n3, &iaccumulate);
+    return sizeof(double) * count;
+  } else if (precision == precision_quadruple) {
+    FORTRAN_NAME(field_face_store_16)
+      ((long double *) field + im, (const long double *) array, m3,n3,
+       &iaccumulate);
+    return sizeof(long double) * count;
+  } else {
+    ERROR("FieldFace::store_()", "Unsupported precision");
+  }
+  return 0;
 }
 
 //----------------------------------------------------------------------
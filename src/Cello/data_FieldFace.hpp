@@ -12,6 +12,23 @@ class Prolong;
 class Restrict;
 class Refresh;
 
+/// @struct   FieldFacePlan
+/// @brief    Loop limits and contiguous copy runs for one FieldFace
+/// operation on a Field array of given size, ghost depth and centering
+struct FieldFacePlan {
+
+  /// Source (or only) loop limits
+  int i3[3], n3[3];
+
+  /// Destination loop limits for face_to_face()
+  int id3[3], nd3[3];
+
+  /// Copy runs as (source offset, destination offset, length)
+  /// triples in elements; empty if the operation prolongs, restricts,
+  /// or stores
+  std::vector<int> run;
+};
+
 class FieldFace {
 
   /// @class    FieldFace
@@ -21,8 +38,6 @@ class FieldFace {
 
 public: // interface
 
-  static long counter[CONFIG_NODE_SIZE];
-
   /// Constructor of uninitialized FieldFace
 
   FieldFace () throw()
@@ -36,7 +51,7 @@ public: // interface
     CkPrintf ("%d %s:%d DEBUG_FIELD_FACE creating %p\n",
 	      CkMyPe(),__FILE__,__LINE__,this);
 #endif    
-    ++counter[cello::index_static()]; 
+    ++cello::message_counters().field_face; 
 
     for (int i=0; i<3; i++) {
       face_[i] = 0;
@@ -144,6 +159,12 @@ public: // interface
 
   int num_bytes_array (Field field) throw();
 
+  /// Return the bytes and element size of each field in the array,
+  /// in the order they are serialized
+  void array_segments (Field field,
+                       std::vector<int> & segment_bytes,
+                       std::vector<int> & element_size) throw();
+
   /// Compute loop limits for copy, load, or store if accumulate == false
   void loop_limits
   (int i3[3], int n3[3], const int m3[3], const int g3[3], const int c3[3],
@@ -178,26 +199,34 @@ private: // functions
   /// copy data
   void copy_(const FieldFace & field_face); 
 
-  /// Precision-agnostic function for loading field block face into
-  /// the field_face array; returns number of bytes copied
+  /// Return the FieldFacePlan for the given operation and field
+  /// array shape, creating it on first use
+  const FieldFacePlan & plan_
+  (int op_type, const int m3[3], const int g3[3], const int c3[3],
+   bool accumulate);
+
+  /// Append copy runs between the given source and destination
+  /// subarrays to the plan, merging runs that are contiguous in both
+  static void plan_runs_
+  (FieldFacePlan * plan,
+   const int ms3[3], const int is3[3],
+   const int md3[3], const int id3[3], const int n3[3]);
+
+  /// Precision-agnostic function for executing a plan's copy runs;
+  /// returns number of bytes copied
   template<class T>
-  size_t load_ (T * array_face,  const T * field_face,
-		int nd3[3], int nf3[3], int im3[3],
-		bool accumulate) throw();
+  size_t copy_runs_ (T * dst, const T * src,
+		     const FieldFacePlan & plan, bool accumulate) throw();
 
-  /// Precision-agnostic function for copying the field_face array into
-  /// the field block ghosts; returns number of bytes copied
-  template<class T>
-  size_t store_ (T * field_ghosts,  const T * array_ghosts, 
-		 int nd3[3], int nf3[3], int im3[3],
-		 bool accumulate) throw();
+  /// Execute plan's copy runs for the given precision
+  size_t copy_runs_ (precision_type precision, char * dst, const char * src,
+		     const FieldFacePlan & plan, bool accumulate) throw();
 
-  /// Precision-agnostic function for copying a field block face
-  /// into another block's ghost zones
-  template<class T>
-  void copy_ (T       * vd, int md3[3], int nd3[3], int id3[3],
-	      const T * vs, int ms3[3], int ns3[3], int is3[3],
-	      bool accumulate) throw();
+  /// Store the packed array into the field's plan loop limits using
+  /// Fortran loops; returns number of bytes copied
+  size_t store_ (precision_type precision, char * field, const char * array,
+		 const int m3[3], const FieldFacePlan & plan,
+		 bool accumulate) throw();
 
 
   std::vector<int> field_list_src_(Field field) const;
@@ -230,6 +259,25 @@ private: // attributes
 
   /// Whether refresh object should be deleted in destructor
   bool new_refresh_;
+
+  /// Key identifying a FieldFacePlan: the operation, FieldFace
+  /// attributes, and field array shape.  Fixed size so lookups do not
+  /// allocate
+  typedef std::array<int,21> plan_key_type;
+
+  /// Per-PE plan cache, aligned to a cache line so that caches for
+  /// different PEs in an SMP process do not share one
+  struct alignas(64) PlanCache {
+    /// FieldFacePlan objects indexed by plan key, since FieldFace
+    /// objects are recreated for each exchange but topologies repeat
+    std::map<plan_key_type,FieldFacePlan> map;
+    /// Most recently used plan and its key, since consecutive fields
+    /// in an exchange usually share the same plan
+    plan_key_type last_key;
+    const FieldFacePlan * last;
+    PlanCache() : map(), last_key(), last(NULL) {}
+  };
+  static PlanCache plan_cache_[CONFIG_NODE_SIZE];
 };
 
 #endif /* DATA_FIELD_FACE_HPP */
@@ -321,6 +321,13 @@ public: // interface
   int gather (int it, int n, ParticleData **particle_array)
   { return particle_data_->gather(particle_descr_,it,n,particle_array); }
 
+  /// Move particles of the given type from another ParticleData,
+  /// reusing its batches instead of copying when possible.  Return
+  /// the number of particles moved
+
+  int splice (int it, ParticleData * particle_data)
+  { return particle_data_->splice(particle_descr_,it,particle_data); }
+
   /// Compress particles in batches so that all batches except
   /// possibly the last have batch_size() particles.  May be performed
   /// periodically to recover unused memory from multiple insert/deletes
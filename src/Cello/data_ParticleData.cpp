@@ -10,8 +10,6 @@
 
 // #define DEBUG_PARTICLES
 
-int64_t ParticleData::counter[CONFIG_NODE_SIZE] = {0};
-
 //----------------------------------------------------------------------
 
 ParticleData::ParticleData()
@@ -19,7 +17,7 @@ ParticleData::ParticleData()
     attribute_align_(),
     particle_count_()
 {
-  ++counter[cello::index_static()]; 
+  ++cello::message_counters().particle_data; 
 }
 
 //----------------------------------------------------------------------
@@ -45,7 +43,7 @@ void ParticleData::pup (PUP::er &p)
 
 ParticleData::~ParticleData()
 {
-  --counter[cello::index_static()]; 
+  --cello::message_counters().particle_data; 
 }
 //----------------------------------------------------------------------
 
@@ -366,6 +364,39 @@ int ParticleData::gather
 
 //----------------------------------------------------------------------
 
+int ParticleData::splice
+(ParticleDescr * particle_descr, int it, ParticleData * particle_data)
+{
+  if (particle_data == NULL || particle_data == this) return 0;
+
+  int count;
+
+  if (num_particles(particle_descr,it) > 0) {
+
+    // Particles already present: copy into existing batches
+
+    count = gather (particle_descr,it,1,&particle_data);
+
+  } else {
+
+    // No particles of this type: take ownership of the source batches
+
+    count = particle_data->num_particles(particle_descr,it);
+
+    attribute_array_[it].swap(particle_data->attribute_array_[it]);
+    attribute_align_[it].swap(particle_data->attribute_align_[it]);
+    particle_count_ [it].swap(particle_data->particle_count_[it]);
+  }
+
+  particle_data->attribute_array_[it].clear();
+  particle_data->attribute_align_[it].clear();
+  particle_data->particle_count_ [it].clear();
+
+  return count;
+}
+
+//----------------------------------------------------------------------
+
 void ParticleData::compress (ParticleDescr * particle_descr)
 {
   const int nt = particle_descr->num_types();
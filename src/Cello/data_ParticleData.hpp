@@ -18,8 +18,6 @@ class ParticleData {
 
 public: // interface
 
-  static int64_t counter[CONFIG_NODE_SIZE];
-
   /// Constructor
   ParticleData();
 
@@ -32,7 +30,7 @@ public: // interface
   /// Constructor
   ParticleData(const ParticleData & particle_data)
   {
-    ++counter[cello::index_static()];
+    ++cello::message_counters().particle_data;
 
     attribute_array_ = particle_data.attribute_array_;
     attribute_align_ = particle_data.attribute_align_;
@@ -91,6 +89,14 @@ public: // interface
 
   int gather (ParticleDescr *, int it, int n, ParticleData * particle_array[]);
 
+  /// Move all particles of the given type from another ParticleData
+  /// object, which is left with no particles of that type.  Batches
+  /// are moved without copying if this object has no particles of the
+  /// type; otherwise falls back to gather().  Return the number of
+  /// particles moved
+
+  int splice (ParticleDescr *, int it, ParticleData * particle_data);
+
   /// Compress particles in batches so that all batches except
   /// possibly the last have batch_size() particles.  May be performed
   /// periodically to recover unused memory from multiple insert/deletes
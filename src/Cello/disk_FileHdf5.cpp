@@ -474,16 +474,26 @@ int FileHdf5::group_count () const throw()
 
 std::string FileHdf5::group_name (size_t i) const throw()
 {
-  char buffer[10];
-
   // 1.6.0 <= HDF5 version < 1.8.0
   //  H5Gget_objname_by_idx(group_id_,i,buffer,10);
 
   // 1.8.0 <= HDF5 version 
+
+  // query the name length first, since names of datasets and blocks
+  // may be arbitrarily long
+
+  ssize_t length = H5Lget_name_by_idx
+    (group_id_,group_name_.c_str(),H5_INDEX_NAME,H5_ITER_INC,
+     i,NULL,0,H5P_DEFAULT);
+
+  if (length <= 0) return "";
+
+  std::vector<char> buffer (length + 1);
+
   H5Lget_name_by_idx (group_id_,group_name_.c_str(),H5_INDEX_NAME,H5_ITER_INC,
-		      i,buffer,10,H5P_DEFAULT);
+		      i,&buffer[0],length+1,H5P_DEFAULT);
 
-  return std::string(buffer);
+  return std::string(&buffer[0]);
 }
 
 //----------------------------------------------------------------------
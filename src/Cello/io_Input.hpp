@@ -61,13 +61,29 @@ public: // functions
   void set_filename (std::string filename,
 		     std::vector<std::string> fileargs) throw();
 
+  /// Set the cycle and time used for file name format arguments
+  void set_cycle_time (int cycle, double time) throw()
+  { cycle_ = cycle; time_ = time; }
+
+  /// Return the file name with format arguments expanded
+  std::string expanded_name
+  (const std::string & name, const std::vector<std::string> & args)
+    const throw()
+  { return expand_name_(&name,&args); }
+
   /// Set field iterator
   void set_it_field_index (ItIndex * it_index) throw()
-  { it_field_index_ = it_index; }
+  {
+    if (it_field_index_ != it_index) delete it_field_index_;
+    it_field_index_ = it_index;
+  }
   
   /// Set particle iterator
   void set_it_particle_index (ItIndex * it_index) throw()
-  { it_particle_index_ = it_index; }
+  {
+    if (it_particle_index_ != it_index) delete it_particle_index_;
+    it_particle_index_ = it_index;
+  }
   
   /// Return the IoBlock object
   IoBlock * io_block () const throw() { return io_block_; }
@@ -97,24 +97,24 @@ Block * InputData::read_block
 (  Block * block, std::string  block_name) throw()
 {
 
-  file_->group_chdir(block_name);
+  file_->group_chdir("/" + block_name);
   file_->group_open();
 
-  // Read block meta data
+  // List datasets in the group, so that fields or particle types not
+  // in the file are skipped rather than treated as errors
 
-  io_block()->set_block(block);
-
-  Input::read_meta_group (io_block());
-
-  int ibx,iby,ibz;
-  block->index_array(&ibx,&iby,&ibz);
+  data_names_.clear();
+  const int num_data = file_->group_count();
+  for (int i=0; i<num_data; i++) {
+    data_names_.insert(file_->group_name(i));
+  }
 
-  // // Call read_block() on base Input object
+  // Call read_block() on base Input object to read fields and particles
 
-  // Input::read_block(block,field_descr,ixp0,iyp0,izp0);
+  Input::read_block(block,block_name);
 
   file_->group_close();
-  file_->group_chdir("..");
+  file_->group_chdir("/");
 
   return block;
 }
@@ -136,17 +136,35 @@ void InputData::read_field( Block * block, int index_field) throw()
     int nxd,nyd,nzd;  // Array dimension
     int nx,ny,nz;     // Array size
 
-    // Read ith FieldData data
-
-    file_->data_open(name.c_str(),&type,&nx,&ny,&nz);
-    file_->data_read(buffer);
-    file_->data_close();
-
     // Get ith FieldData data
+
     io_field_data()->field_array(i, &buffer, &name, &type, 
 				 &nxd,&nyd,&nzd,
 				 &nx, &ny, &nz);
 
+    if (data_names_.find(name) == data_names_.end()) continue;
+
+    // Read ith FieldData data, including ghost zones, directly into
+    // the field array with a single contiguous read
+
+    int type_file;
+    int m4[4] = {1,1,1,1};
+    file_->data_open(name,&type_file,m4,m4+1,m4+2,m4+3);
+
+    ASSERT3 ("InputData::read_field()",
+	     "Dataset %s has type %d but field has type %d",
+	     name.c_str(),type_file,type,
+	     type_file == type);
+
+    ASSERT5 ("InputData::read_field()",
+	     "Dataset %s has %d values but field array is %d x %d x %d",
+	     name.c_str(),m4[0]*m4[1]*m4[2]*m4[3],nxd,nyd,nzd,
+	     m4[0]*m4[1]*m4[2]*m4[3] == nxd*nyd*nzd);
+
+    file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
+    file_->data_read(buffer);
+    file_->mem_close();
+    file_->data_close();
   }
 
 }
@@ -154,33 +172,89 @@ void InputData::read_field( Block * block, int index_field) throw()
 //----------------------------------------------------------------------
 
 void InputData::read_particle
-( Block * block, int index_particle) throw()
+( Block * block, int it) throw()
 {
-  // io_particle_data()->set_particle_descr((ParticleDescr*)particle_descr);
-  // io_particle_data()->set_particle_data(particle_data);
-  // io_particle_data()->set_particle_index(index_particle);
+  Particle particle = block->data()->particle();
 
-  // for (size_t i=0; i<io_particle_data()->data_count(); i++) {
+  const std::string prefix = "particle_" + particle.type_name(it) + "_";
 
-  //   void * buffer = 0;
-  //   std::string name;
-  //   int type;
-  //   int nxd,nyd,nzd;  // Array dimension
-  //   int nx,ny,nz;     // Array size
+  const int na = particle.num_attributes(it);
 
-  //   // Read ith ParticleData data
+  // Skip particle types not in the file
 
-  //   file_->data_open(name.c_str(),&type,&nx,&ny,&nz);
-  //   file_->data_read(buffer);
-  //   file_->data_close();
+  if (na == 0 ||
+      data_names_.find(prefix + particle.attribute_name(it,0))
+      == data_names_.end()) return;
 
-  //   // Get ith ParticleData data
-  //   io_particle_data()->field_array(i, &buffer, &name, &type, 
-  //                                   &nxd,&nyd,&nzd,
-  // 				       &nx, &ny, &nz);
+  std::vector<char> buffer;
+  int np = 0;
+  int i0 = 0;
 
-  // }
+  for (int ia=0; ia<na; ia++) {
 
+    const std::string name = prefix + particle.attribute_name(it,ia);
+
+    if (data_names_.find(name) == data_names_.end()) continue;
+
+    int type_file;
+    int m4[4] = {1,1,1,1};
+    file_->data_open(name,&type_file,m4,m4+1,m4+2,m4+3);
+
+    const int type = particle.attribute_type(it,ia);
+
+    ASSERT3 ("InputData::read_particle()",
+	     "Dataset %s has type %d but attribute has type %d",
+	     name.c_str(),type_file,type,
+	     type_file == type);
+
+    // Create the particles when reading the first attribute
+
+    if (ia == 0) {
+      np = m4[0];
+      if (np > 0) {
+	i0 = particle.insert_particles(it,np);
+	cello::simulation()->data_insert_particles(np);
+      }
+    }
+
+    ASSERT3 ("InputData::read_particle()",
+	     "Dataset %s has %d particles but expected %d",
+	     name.c_str(),m4[0],np,
+	     m4[0] == np);
+
+    if (np == 0) {
+      file_->data_close();
+      continue;
+    }
+
+    // Read all particles of the attribute with one contiguous read,
+    // then copy into batches
+
+    const int bytes  = particle.attribute_bytes(it,ia);
+    const int stride = particle.stride(it,ia);
+
+    buffer.resize(np*bytes);
+
+    file_->mem_create(np,1,1,np,1,1,0,0,0);
+    file_->data_read(&buffer[0]);
+    file_->mem_close();
+    file_->data_close();
+
+    int ib,io;
+    particle.index(i0,&ib,&io);
+    for (int ip=0; ip<np; ib++,io=0) {
+      char * array = (char *) particle.attribute_array(it,ia,ib);
+      const int n = std::min(particle.num_particles(it,ib) - io, np - ip);
+      if (stride == 1) {
+	memcpy (array + io*bytes, &buffer[ip*bytes], n*bytes);
+      } else {
+	for (int k=0; k<n; k++) {
+	  memcpy (array + (io+k)*stride*bytes, &buffer[(ip+k)*bytes], bytes);
+	}
+      }
+      ip += n;
+    }
+  }
 }
 
 //======================================================================
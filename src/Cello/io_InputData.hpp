@@ -32,7 +32,7 @@ public: // functions
   PUPable_decl(InputData);
 
   /// Charm++ PUP::able migration constructor
-  InputData (CkMigrateMessage *m) : Input(m) {}
+  InputData (CkMigrateMessage *m) : Input(m), data_names_() {}
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
@@ -54,7 +54,7 @@ public: // virtual functions
   /// Read hierarchy data from disk
   virtual void read_hierarchy ( Hierarchy * hierarchy ) throw();
 
-  /// Read block data from disk
+  /// Read block data from the Block's group written by OutputData
   virtual Block * read_block
   ( Block *            block,
     std::string        block_name) throw();
@@ -65,8 +65,10 @@ public: // virtual functions
   /// Read local particle from disk
   virtual void read_particle ( Block * block, int index_particle) throw();
 
-protected:
+protected: // attributes
 
+  /// Names of datasets in the currently open Block group
+  std::set<std::string> data_names_;
 
 };
 
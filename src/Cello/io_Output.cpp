@@ -31,7 +31,8 @@ Output::Output (int index, const Factory * factory) throw()
     it_particle_index_(0),        // set_it_index_particle()
     io_particle_data_(0),
     stride_write_(1), // default one file per process
-    stride_wait_(1) // default all can write at once
+    stride_wait_(1), // default all can write at once
+    reduce_arity_(0) // default send directly to writer
 
 {
   io_block_         = factory->create_io_block();
@@ -87,6 +88,7 @@ void Output::pup (PUP::er &p)
   p | *io_particle_data_;
   p | stride_write_;
   p | stride_wait_;
+  p | reduce_arity_;
 
 }
 
@@ -59,7 +59,8 @@ public: // functions
       it_particle_index_(0),        // set_it_index_particle()
       io_particle_data_(0),
       stride_write_(1),// default one file per process
-      stride_wait_(0) // default no synchronization of writes
+      stride_wait_(0), // default no synchronization of writes
+      reduce_arity_(0) // default send directly to writer
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -118,9 +119,20 @@ public: // functions
   void set_stride_write (int stride) throw () 
   {
     stride_write_ = stride; 
-    sync_write_.set_stop(stride_write_);
+    sync_write_.set_stop(num_remote() + 1);
   }
 
+  /// Set the arity of the tree used to reduce remote data to the
+  /// writer (0: all processes send directly to the writer)
+  void set_reduce_arity (int arity) throw ()
+  {
+    reduce_arity_ = arity;
+    sync_write_.set_stop(num_remote() + 1);
+  }
+
+  int reduce_arity () const throw ()
+  { return reduce_arity_; }
+
   int stride_write () const throw () 
   { return stride_write_; }
 
@@ -138,6 +150,31 @@ public: // functions
     return ip - (ip % stride_write_);
   }
 
+  /// Return the process id to send remote data to: the writer, or
+  /// the parent process in the reduction tree
+  int process_parent() const throw()
+  {
+    const int ip = CkMyPe();
+    const int ip_write = process_writer();
+    return (reduce_arity_ > 0) ?
+      ip_write + (ip - ip_write - 1) / reduce_arity_ : ip_write;
+  }
+
+  /// Return the number of processes sending remote data to this
+  /// process
+  int num_remote() const throw()
+  {
+    const int ip = CkMyPe();
+    const int ip_write = process_writer();
+    const int np = std::min(stride_write_, CkNumPes() - ip_write);
+    const int k = ip - ip_write;
+    if (reduce_arity_ > 0) {
+      return std::max(0, std::min(reduce_arity_, np - (k*reduce_arity_ + 1)));
+    } else {
+      return (k == 0) ? np - 1 : 0;
+    }
+  }
+
   /// Return the updated timestep if time + dt goes past a scheduled output
   double update_timestep (double time, double dt) const throw ();
 
@@ -323,6 +360,11 @@ protected: // attributes
   
   int stride_wait_;
 
+  /// Arity of the tree over which remote data is reduced to the
+  /// writer, with update_remote() applied at each level (0: all
+  /// processes send to the writer)
+  int reduce_arity_;
+
 };
 
 #endif /* IO_OUTPUT_HPP */
@@ -29,6 +29,7 @@ OutputImage::OutputImage(int index,
 			 std::string image_type,
 			 int image_size_x, int image_size_y,
 			 std::string image_reduce_type,
+			 int image_reduce_arity,
 			 std::string image_mesh_color,
 			 std::string color_particle_attribute,
 			 int         image_block_size,
@@ -103,6 +104,8 @@ OutputImage::OutputImage(int index,
   
   // Override default Output::stride_write_: only root writes
   set_stride_write (process_count);
+  // Reduce image tiles to root over a tree
+  set_reduce_arity (image_reduce_arity);
   // Let all processes contribute data when its available
   // (wait stride may be helpful for performance?)
   stride_wait_ = 1;
@@ -159,6 +162,7 @@ void OutputImage::pup (PUP::er &p)
   p | axis_;
   p | nxi_;
   p | nyi_;
+  PUParray(p,image_box_,4);
 
   int has_data = (image_data_ != NULL);
   p | has_data;
@@ -562,15 +566,24 @@ void OutputImage::prepare_remote (int * n, char ** buffer) throw()
   TRACE("OutputImage::prepare_remote()");
   DEBUG("prepare_remote");
 
+  // Only send the bounding box of pixels updated on this process or
+  // its children in the reduction tree
+
+  const int * box = image_box_;
+  const int mx = std::max(0,box[1]-box[0]+1);
+  const int my = std::max(0,box[3]-box[2]+1);
+  const int m = mx*my;
+
+  const bool is_data = type_is_data_();
+  const bool is_mesh = type_is_mesh_();
+
   int size = 0;
-  int nx = nxi_;
-  int ny = nyi_;
 
   // Determine buffer size
 
-  size += 2*sizeof(int);        // nxi_, nyi_
-  size += nx*ny*sizeof(double); // image_data_
-  size += nx*ny*sizeof(double); // image_mesh_
+  size += 6*sizeof(int);                   // nxi_, nyi_, image_box_
+  if (is_data) size += m*sizeof(double);   // image_data_ tile
+  if (is_mesh) size += m*sizeof(double);   // image_mesh_ tile
   (*n) = size;
 
   // Allocate buffer (deallocated in cleanup_remote())
@@ -584,17 +597,20 @@ void OutputImage::prepare_remote (int * n, char ** buffer) throw()
 
   p.c = (*buffer);
 
-  *p.i++ = nx;
-  *p.i++ = ny;
+  *p.i++ = nxi_;
+  *p.i++ = nyi_;
+  for (int k=0; k<4; k++) *p.i++ = box[k];
 
-  for (int k=0; k<nx*ny; k++) *p.d++ = image_data_[k];
-  for (int k=0; k<nx*ny; k++) *p.d++ = image_mesh_[k];
-  
+  for (int iy=0; iy<my; iy++) {
+    const int i0 = box[0] + nxi_*(box[2]+iy);
+    if (is_data) std::copy_n (image_data_ + i0, mx, p.d + mx*iy);
+    if (is_mesh) std::copy_n (image_mesh_ + i0, mx, p.d + mx*iy + (is_data?m:0));
+  }
 }
 
 //----------------------------------------------------------------------
 
-void OutputImage::update_remote  ( int m, char * buffer) throw()
+void OutputImage::update_remote  ( int n, char * buffer) throw()
 {
   TRACE("OutputImage::update_remote()");
   DEBUG("update_remote");
@@ -610,25 +626,31 @@ void OutputImage::update_remote  ( int m, char * buffer) throw()
   const int nx = *p.i++;
   const int ny = *p.i++;
 
-  const int n = nx*ny;
-  
-  if (op_reduce_ == reduce_min) {
-    for (int k=0; k<n; k++) image_data_[k] = std::min(image_data_[k],*p.d++);
-    for (int k=0; k<n; k++) image_mesh_[k] = std::min(image_mesh_[k],*p.d++);
-  } else if (op_reduce_ == reduce_max) {
-    for (int k=0; k<n; k++) image_data_[k] = std::max(image_data_[k],*p.d++);
-    for (int k=0; k<n; k++) image_mesh_[k] = std::max(image_mesh_[k],*p.d++);
-  } else if (op_reduce_ == reduce_sum) {
-    for (int k=0; k<n; k++) image_data_[k] += *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k] += *p.d++;
-  } else if (op_reduce_ == reduce_avg) {
-    for (int k=0; k<n; k++) image_data_[k] += *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k] += *p.d++;
-  } else if (op_reduce_ == reduce_set) {
-    for (int k=0; k<n; k++) image_data_[k]  = *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k]  = *p.d++;
+  ASSERT4 ("OutputImage::update_remote()",
+	   "Remote image size %d x %d differs from local size %d x %d",
+	   nx,ny,nxi_,nyi_,
+	   nx == nxi_ && ny == nyi_);
+
+  int box[4];
+  for (int k=0; k<4; k++) box[k] = *p.i++;
+
+  const int m = std::max(0,box[1]-box[0]+1) * std::max(0,box[3]-box[2]+1);
+
+  if (m == 0) return;
+
+  if (type_is_data_()) {
+    reduce_tile_ (image_data_,p.d,box);
+    p.d += m;
+  }
+  if (type_is_mesh_()) {
+    reduce_tile_ (image_mesh_,p.d,box);
+    p.d += m;
   }
 
+  image_box_[0] = std::min(image_box_[0],box[0]);
+  image_box_[1] = std::max(image_box_[1],box[1]);
+  image_box_[2] = std::min(image_box_[2],box[2]);
+  image_box_[3] = std::max(image_box_[3],box[3]);
 }
 
 //----------------------------------------------------------------------
@@ -736,6 +758,12 @@ void OutputImage::image_create_ () throw()
   for (int i=0; i<nxi_*nyi_; i++) image_data_[i] = value0;
   for (int i=0; i<nxi_*nyi_; i++) image_mesh_[i] = value0;
 
+  // empty bounding box of updated pixels
+  image_box_[0] = nxi_;
+  image_box_[1] = -1;
+  image_box_[2] = nyi_;
+  image_box_[3] = -1;
+
 }
 
 //----------------------------------------------------------------------
@@ -886,6 +914,11 @@ void OutputImage::reduce_point_
   }
   const int i = ix + nxi_*iy;
 
+  image_box_[0] = std::min(image_box_[0],ix);
+  image_box_[1] = std::max(image_box_[1],ix);
+  image_box_[2] = std::min(image_box_[2],iy);
+  image_box_[3] = std::max(image_box_[3],iy);
+
   double value_new = 0.0;
   
   switch (op_reduce_) {
@@ -1013,3 +1046,24 @@ void OutputImage::reduce_box_filled_
 }
 
 //----------------------------------------------------------------------
+
+void OutputImage::reduce_tile_
+(double * image, const double * tile, const int box[4])
+{
+  const int mx = box[1]-box[0]+1;
+  for (int iy=box[2]; iy<=box[3]; iy++) {
+    double * a = image + box[0] + nxi_*iy;
+    const double * b = tile + mx*(iy-box[2]);
+    if (op_reduce_ == reduce_min) {
+      for (int ix=0; ix<mx; ix++) a[ix] = std::min(a[ix],b[ix]);
+    } else if (op_reduce_ == reduce_max) {
+      for (int ix=0; ix<mx; ix++) a[ix] = std::max(a[ix],b[ix]);
+    } else if (op_reduce_ == reduce_sum || op_reduce_ == reduce_avg) {
+      for (int ix=0; ix<mx; ix++) a[ix] += b[ix];
+    } else if (op_reduce_ == reduce_set) {
+      for (int ix=0; ix<mx; ix++) a[ix] = b[ix];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
@@ -40,6 +40,7 @@ public: // functions
 	      int         image_size_x,
 	      int         image_size_y,
 	      std::string image_reduce_type,
+	      int         image_reduce_arity,
 	      std::string image_mesh_color,
 	      std::string image_color_particle_attribute,
 	      int         image_block_size,
@@ -177,6 +178,9 @@ private: // functions
 
   double data_(int i) const ;
 
+  /// Reduce the tile of the given pixel bounds into the image
+  void reduce_tile_(double * image, const double * tile, const int box[4]);
+
 private: // attributes
 
   /// Color map
@@ -190,6 +194,10 @@ private: // attributes
   /// Current image for mesh
   double * image_mesh_;
 
+  /// Bounds ixm,ixp,iym,iyp of pixels updated in image_data_ or
+  /// image_mesh_; pixels outside hold the reduction identity
+  int image_box_[4];
+
   /// Reduction operation
   reduce_type op_reduce_;
 
@@ -0,0 +1,784 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputProjection.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of the OutputProjection class
+
+#include "cello.hpp"
+#include "main.hpp"
+#include "io.hpp"
+
+//----------------------------------------------------------------------
+
+OutputProjection::OutputProjection
+(
+ int index,
+ const Factory * factory,
+ Config * config,
+ int process_count
+ ) throw ()
+  : Output(index,factory),
+    index_field_(),
+    index_weight_(),
+    axis_(),
+    type_(),
+    op_reduce_(),
+    position_(),
+    nu_(),
+    nv_(),
+    value_(),
+    weight_(),
+    box_(),
+    map_r_(),map_g_(),map_b_(),
+    image_log_(config->output_image_log[index]),
+    max_level_(std::min(config->output_max_level[index],
+			config->mesh_max_level))
+{
+  // Only root writes, reducing images over a tree
+  set_stride_write (process_count);
+  set_reduce_arity (config->output_image_reduce_arity[index]);
+  stride_wait_ = 1;
+
+  FieldDescr * field_descr = cello::field_descr();
+
+  const int rank = cello::rank();
+  const int num_views = config->output_field_list[index].size();
+
+  ASSERT1 ("OutputProjection::OutputProjection()",
+	   "Output %s field_list must not be empty",
+	   config->output_list[index].c_str(),
+	   num_views > 0);
+
+  index_field_. resize(num_views);
+  index_weight_.resize(num_views);
+  axis_.        resize(num_views);
+  type_.        resize(num_views);
+  op_reduce_.   resize(num_views);
+  position_.    resize(num_views);
+  nu_.          resize(num_views);
+  nv_.          resize(num_views);
+
+  for (int iv=0; iv<num_views; iv++) {
+
+    const std::string field  = config->output_field_list[index][iv];
+    const std::string weight = config->output_projection_weight[index][iv];
+    const std::string type   = config->output_projection_type[index][iv];
+    const std::string axis   = config->output_projection_axis[index][iv];
+    const std::string reduce = config->output_projection_reduce[index][iv];
+
+    index_field_[iv] = field_descr->field_id(field);
+
+    ASSERT1 ("OutputProjection::OutputProjection()",
+	     "Unknown field %s in field_list",
+	     field.c_str(),
+	     index_field_[iv] >= 0);
+
+    index_weight_[iv] = (weight == "") ? -1 : field_descr->field_id(weight);
+
+    ASSERT1 ("OutputProjection::OutputProjection()",
+	     "Unknown projection_weight field %s",
+	     weight.c_str(),
+	     weight == "" || index_weight_[iv] >= 0);
+
+    ASSERT1 ("OutputProjection::OutputProjection()",
+	     "projection_axis %s must be \"x\", \"y\", or \"z\"",
+	     axis.c_str(),
+	     axis=="x" || axis=="y" || axis=="z");
+
+    axis_[iv] = axis[0] - 'x';
+
+    ASSERT ("OutputProjection::OutputProjection()",
+	    "projection_axis must be \"z\" for 2D problems",
+	    ! (rank == 2 && axis_[iv] != 2));
+
+    if      (type == "projection") type_[iv] = view_type_projection;
+    else if (type == "slice")      type_[iv] = view_type_slice;
+    else {
+      ERROR1 ("OutputProjection::OutputProjection()",
+	      "Unrecognized projection_type %s",
+	      type.c_str());
+    }
+
+    if (type_[iv] == view_type_slice) {
+      // slices average field values over the pixel
+      op_reduce_[iv] = reduce_avg;
+      index_weight_[iv] = -1;
+    } else if (reduce == "") {
+      op_reduce_[iv] = (index_weight_[iv] >= 0) ? reduce_avg : reduce_sum;
+    } else if (reduce == "sum") { op_reduce_[iv] = reduce_sum; }
+    else if   (reduce == "avg") { op_reduce_[iv] = reduce_avg; }
+    else if   (reduce == "min") { op_reduce_[iv] = reduce_min; }
+    else if   (reduce == "max") { op_reduce_[iv] = reduce_max; }
+    else {
+      ERROR1 ("OutputProjection::OutputProjection()",
+	      "Unrecognized projection_reduce %s",
+	      reduce.c_str());
+    }
+
+    ASSERT1 ("OutputProjection::OutputProjection()",
+	     "projection_weight %s requires projection_reduce \"avg\"",
+	     weight.c_str(),
+	     index_weight_[iv] < 0 || op_reduce_[iv] == reduce_avg);
+
+    position_[iv] = config->output_projection_position[index][iv];
+
+    // one pixel per cell at max_level_
+
+    const int IX = (axis_[iv]+1) % 3;
+    const int IY = (axis_[iv]+2) % 3;
+
+    nu_[iv] = config->mesh_root_size[IX] << max_level_;
+    nv_[iv] = config->mesh_root_size[IY] << max_level_;
+  }
+
+  // Set default color map to be black and white
+
+  map_r_.resize(2);
+  map_g_.resize(2);
+  map_b_.resize(2);
+
+  map_r_[0] = 0.0;
+  map_g_[0] = 0.0;
+  map_b_[0] = 0.0;
+
+  map_r_[1] = 1.0;
+  map_g_[1] = 1.0;
+  map_b_[1] = 1.0;
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::pup (PUP::er &p)
+{
+  TRACEPUP;
+
+  // NOTE: change this function whenever attributes change
+
+  Output::pup(p);
+
+  p | index_field_;
+  p | index_weight_;
+  p | axis_;
+  p | type_;
+  p | op_reduce_;
+  p | position_;
+  p | nu_;
+  p | nv_;
+  p | value_;
+  p | weight_;
+  p | box_;
+  p | map_r_;
+  p | map_g_;
+  p | map_b_;
+  p | image_log_;
+  p | max_level_;
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::set_colormap
+(int n, double * map_r, double * map_g, double * map_b) throw()
+{
+  map_r_.resize(n);
+  map_g_.resize(n);
+  map_b_.resize(n);
+
+  for (int i=0; i<n; i++) {
+    map_r_[i] = map_r[i];
+    map_g_[i] = map_g[i];
+    map_b_[i] = map_b[i];
+  }
+}
+
+//======================================================================
+
+void OutputProjection::init () throw()
+{
+  const int num_views = this->num_views();
+
+  value_. resize(num_views);
+  weight_.resize(num_views);
+  box_.   resize(4*num_views);
+
+  const double max = std::numeric_limits<double>::max();
+
+  for (int iv=0; iv<num_views; iv++) {
+
+    const int n = nu_[iv]*nv_[iv];
+
+    // initialize to the identity of the reduction
+
+    const int op = op_reduce_[iv];
+    const double value0 =
+      (op == reduce_min) ? max : ((op == reduce_max) ? -max : 0.0);
+
+    value_[iv].assign(n,value0);
+    if (is_weighted_(iv)) weight_[iv].assign(n,0.0);
+
+    box_[4*iv+0] = nu_[iv];
+    box_[4*iv+1] = -1;
+    box_[4*iv+2] = nv_[iv];
+    box_[4*iv+3] = -1;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::open () throw()
+{
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::close () throw()
+{
+  if (is_writer()) {
+
+    std::string file_base = directory() + "/" +
+      expand_name_ (&file_name_,&file_args_);
+
+    for (int iv=0; iv<num_views(); iv++) {
+      write_view_files_(iv,file_base);
+    }
+  }
+
+  // Deallocate images
+
+  for (int iv=0; iv<num_views(); iv++) {
+    std::vector<double>().swap(value_[iv]);
+    std::vector<double>().swap(weight_[iv]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::write_block ( const Block * block ) throw()
+{
+  // Only leaf Blocks, so that projections do not count any region
+  // of the domain twice
+
+  if (! block->is_leaf()) return;
+
+  for (int iv=0; iv<num_views(); iv++) {
+    write_view_(iv,block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::write_field_data
+(
+ const FieldData * field_data,
+ int index_field) throw()
+{
+  WARNING("OutputProjection::write_field_data",
+	  "This function should not be called");
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::write_particle_data
+(
+ const ParticleData * particle_data,
+ int index_particle) throw()
+{
+  WARNING("OutputProjection::write_particle_data",
+	  "This function should not be called");
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::prepare_remote (int * n, char ** buffer) throw()
+{
+  // Only send the bounding box of pixels updated on this process or
+  // its children in the reduction tree
+
+  const int num_views = this->num_views();
+
+  // header: number of views and pixel bounds for each view, padded
+  // to align the following double arrays
+  const int num_ints = 1 + 4*num_views;
+  const int size_header = sizeof(double) *
+    ((num_ints*sizeof(int) + sizeof(double) - 1) / sizeof(double));
+
+  int size = size_header;
+  for (int iv=0; iv<num_views; iv++) {
+    const int * box = &box_[4*iv];
+    const int m = std::max(0,box[1]-box[0]+1) * std::max(0,box[3]-box[2]+1);
+    size += (is_weighted_(iv) ? 2 : 1) * m * sizeof(double);
+  }
+
+  (*n) = size;
+
+  // Allocate buffer (deallocated in cleanup_remote())
+  (*buffer) = new char [ size ];
+
+  int * pi = (int *)(*buffer);
+
+  *pi++ = num_views;
+  for (int iv=0; iv<num_views; iv++) {
+    for (int k=0; k<4; k++) *pi++ = box_[4*iv+k];
+  }
+
+  double * pd = (double *)((*buffer) + size_header);
+
+  for (int iv=0; iv<num_views; iv++) {
+    const int * box = &box_[4*iv];
+    const int mx = std::max(0,box[1]-box[0]+1);
+    const int my = std::max(0,box[3]-box[2]+1);
+    for (int iy=0; iy<my; iy++) {
+      const int i0 = box[0] + nu_[iv]*(box[2]+iy);
+      std::copy_n (&value_[iv][i0], mx, pd + mx*iy);
+    }
+    pd += mx*my;
+    if (is_weighted_(iv)) {
+      for (int iy=0; iy<my; iy++) {
+	const int i0 = box[0] + nu_[iv]*(box[2]+iy);
+	std::copy_n (&weight_[iv][i0], mx, pd + mx*iy);
+      }
+      pd += mx*my;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::update_remote  ( int n, char * buffer) throw()
+{
+  const int num_views = this->num_views();
+
+  const int * pi = (const int *)buffer;
+
+  ASSERT2 ("OutputProjection::update_remote()",
+	   "Remote number of views %d differs from local number %d",
+	   pi[0],num_views,
+	   pi[0] == num_views);
+
+  const int num_ints = 1 + 4*num_views;
+  const int size_header = sizeof(double) *
+    ((num_ints*sizeof(int) + sizeof(double) - 1) / sizeof(double));
+
+  const double * pd = (const double *)(buffer + size_header);
+
+  for (int iv=0; iv<num_views; iv++) {
+
+    const int * box = pi + 1 + 4*iv;
+    const int m = std::max(0,box[1]-box[0]+1) * std::max(0,box[3]-box[2]+1);
+
+    if (m == 0) continue;
+
+    reduce_tile_ (op_reduce_[iv],nu_[iv],&value_[iv][0],pd,box);
+    pd += m;
+    if (is_weighted_(iv)) {
+      reduce_tile_ (reduce_sum,nu_[iv],&weight_[iv][0],pd,box);
+      pd += m;
+    }
+
+    int * box_v = &box_[4*iv];
+    box_v[0] = std::min(box_v[0],box[0]);
+    box_v[1] = std::max(box_v[1],box[1]);
+    box_v[2] = std::min(box_v[2],box[2]);
+    box_v[3] = std::max(box_v[3],box[3]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::cleanup_remote  (int * n, char ** buffer) throw()
+{
+  delete [] (*buffer);
+  (*buffer) = NULL;
+}
+
+//======================================================================
+
+void OutputProjection::write_view_ (int iv, const Block * block)
+{
+  Field field = ((Data *)block->data())->field();
+
+  const int rank = cello::rank();
+
+  const int IX = (axis_[iv]+1) % 3;
+  const int IY = (axis_[iv]+2) % 3;
+  const int IZ = (axis_[iv]+0) % 3;
+
+  int nb3[3];
+  field.size(&nb3[0],&nb3[1],&nb3[2]);
+
+  double dm3[3],dp3[3];
+  cello::hierarchy()->lower(dm3,dm3+1,dm3+2);
+  cello::hierarchy()->upper(dp3,dp3+1,dp3+2);
+
+  double bm3[3],bp3[3],h3[3];
+  block->lower(bm3,bm3+1,bm3+2);
+  block->upper(bp3,bp3+1,bp3+2);
+  block->cell_width(h3,h3+1,h3+2);
+
+  // Range of cells along the axis
+
+  int k0 = 0;
+  int k1 = nb3[IZ];
+  double dz = (rank >= 3) ? h3[IZ] : 1.0;
+
+  if (type_[iv] == view_type_slice) {
+    const double z = dm3[IZ] + position_[iv]*(dp3[IZ]-dm3[IZ]);
+    const bool in_block = (bm3[IZ] <= z && z < bp3[IZ]) ||
+      (z == dp3[IZ] && bp3[IZ] == dp3[IZ]);
+    if (! in_block) return;
+    k0 = std::min(nb3[IZ]-1,int(floor((z-bm3[IZ])/h3[IZ])));
+    k1 = k0 + 1;
+    dz = 1.0;
+  }
+
+  // Strides of field arrays
+
+  const int index_field  = index_field_[iv];
+  const int index_weight = index_weight_[iv];
+
+  int mf3[3] = {1,1,1};
+  field.dimensions(index_field,&mf3[0],&mf3[1],&mf3[2]);
+  const int df3[3] = {1, mf3[0], mf3[0]*mf3[1]};
+
+  int mw3[3] = {1,1,1};
+  if (index_weight >= 0) {
+    field.dimensions(index_weight,&mw3[0],&mw3[1],&mw3[2]);
+  }
+  const int dw3[3] = {1, mw3[0], mw3[0]*mw3[1]};
+
+  // Strides of the block plane: 0 along the axis, and 1 along the
+  // first remaining axis in field memory order so that rows of field
+  // values update contiguous plane values.  The plane is transposed
+  // to (u,v) order afterwards if needed
+
+  const int nbu = nb3[IX];
+  const int nbv = nb3[IY];
+  const bool transpose = (IY < IX);
+  int ds3[3];
+  ds3[IX] = transpose ? nbv : 1;
+  ds3[IY] = transpose ? 1 : nbu;
+  ds3[IZ] = 0;
+
+  int n3[3] = {nb3[0],nb3[1],nb3[2]};
+  n3[IZ] = k1 - k0;
+
+  // Reduce along the axis over the block
+
+  const int op = op_reduce_[iv];
+  const double max = std::numeric_limits<double>::max();
+  const double value0 =
+    (op == reduce_min) ? max : ((op == reduce_max) ? -max : 0.0);
+
+  std::vector<double> plane_v (nbu*nbv,value0);
+  std::vector<double> plane_w (is_weighted_(iv) ? nbu*nbv : 0, 0.0);
+
+  const char * f = field.unknowns(index_field)  + k0*df3[IZ] *
+    ((field.precision(index_field) == precision_single) ?
+     sizeof(float) : sizeof(double));
+  const char * w = (index_weight < 0) ? NULL :
+    field.unknowns(index_weight) + k0*dw3[IZ] *
+    ((field.precision(index_weight) == precision_single) ?
+     sizeof(float) : sizeof(double));
+
+  const int precision_f = field.precision(index_field);
+  const int precision_w = (index_weight < 0) ?
+    precision_f : field.precision(index_weight);
+
+  ASSERT ("OutputProjection::write_view_",
+	  "Field precision must be single or double",
+	  (precision_f == precision_single || precision_f == precision_double) &&
+	  (precision_w == precision_single || precision_w == precision_double));
+
+  double * pv = &plane_v[0];
+  double * pw = is_weighted_(iv) ? &plane_w[0] : NULL;
+
+  if (precision_f == precision_single) {
+    if (precision_w == precision_single) {
+      reduce_block(op,(const float *)f,(const float *)w,
+		   n3,df3,dw3,ds3,dz,pv,pw);
+    } else {
+      reduce_block(op,(const float *)f,(const double *)w,
+		   n3,df3,dw3,ds3,dz,pv,pw);
+    }
+  } else {
+    if (precision_w == precision_single) {
+      reduce_block(op,(const double *)f,(const float *)w,
+		   n3,df3,dw3,ds3,dz,pv,pw);
+    } else {
+      reduce_block(op,(const double *)f,(const double *)w,
+		   n3,df3,dw3,ds3,dz,pv,pw);
+    }
+  }
+
+  if (transpose) {
+    std::vector<double> plane_t (nbu*nbv);
+    for (int ju=0; ju<nbu; ju++) {
+      for (int jv=0; jv<nbv; jv++) plane_t[ju+nbu*jv] = plane_v[jv+nbv*ju];
+    }
+    plane_v.swap(plane_t);
+    if (pw) {
+      for (int ju=0; ju<nbu; ju++) {
+	for (int jv=0; jv<nbv; jv++) plane_t[ju+nbu*jv] = plane_w[jv+nbv*ju];
+      }
+      plane_w.swap(plane_t);
+    }
+  }
+
+  // Add block plane to the image: each cell covers r x r pixels if
+  // the block is at or coarser than max_level_, or several cells
+  // share a pixel if finer
+
+  const int level = block->level();
+  const int shift = std::max(0,level - max_level_);
+  const int r = 1 << std::max(0,max_level_ - level);
+  const double scale = 1.0 / ((1 << shift)*(1 << shift));
+
+  const int gu0 = lround((bm3[IX]-dm3[IX])/h3[IX]);
+  const int gv0 = (rank >= 2) ? lround((bm3[IY]-dm3[IY])/h3[IY]) : 0;
+
+  const int nu = nu_[iv];
+  const int nv = nv_[iv];
+  double * image_v = &value_[iv][0];
+  double * image_w = is_weighted_(iv) ? &weight_[iv][0] : NULL;
+
+  int * box = &box_[4*iv];
+
+  for (int jv=0; jv<nbv; jv++) {
+    const int ivm = ((gv0+jv)*r) >> shift;
+    const int ivp = std::min(nv-1,((gv0+jv+1)*r-1) >> shift);
+    for (int ju=0; ju<nbu; ju++) {
+      const int ium = ((gu0+ju)*r) >> shift;
+      const int iup = std::min(nu-1,((gu0+ju+1)*r-1) >> shift);
+      const double v = plane_v[ju+nbu*jv];
+      for (int iy=ivm; iy<=ivp; iy++) {
+	double * a = image_v + nu*iy;
+	if (op == reduce_min) {
+	  for (int ix=ium; ix<=iup; ix++) a[ix] = std::min(a[ix],v);
+	} else if (op == reduce_max) {
+	  for (int ix=ium; ix<=iup; ix++) a[ix] = std::max(a[ix],v);
+	} else {
+	  for (int ix=ium; ix<=iup; ix++) a[ix] += scale*v;
+	}
+	if (image_w) {
+	  double * b = image_w + nu*iy;
+	  const double vw = scale*plane_w[ju+nbu*jv];
+	  for (int ix=ium; ix<=iup; ix++) b[ix] += vw;
+	}
+      }
+    }
+  }
+
+  // update bounding box of updated pixels
+
+  const int ium = (gu0*r) >> shift;
+  const int iup = std::min(nu-1,((gu0+nbu)*r-1) >> shift);
+  const int ivm = (gv0*r) >> shift;
+  const int ivp = std::min(nv-1,((gv0+nbv)*r-1) >> shift);
+  box[0] = std::min(box[0],ium);
+  box[1] = std::max(box[1],iup);
+  box[2] = std::min(box[2],ivm);
+  box[3] = std::max(box[3],ivp);
+}
+
+//----------------------------------------------------------------------
+
+template <class TF, class TW>
+void OutputProjection::reduce_block
+(int op, const TF * f, const TW * w,
+ const int n3[3], const int df3[3], const int dw3[3],
+ const int ds3[3], double dz,
+ double * pv, double * pw)
+{
+  // Loops are in field memory order, with the innermost loop over
+  // contiguous field values.  The plane stride ds3[0] must be 0
+  // (projecting along x: each row reduces to one pixel) or 1 (rows
+  // map to contiguous pixels); callers order the plane to match
+
+  ASSERT1 ("OutputProjection::reduce_block",
+	   "Plane stride along x must be 0 or 1, not %d",
+	   ds3[0], (ds3[0] == 0 || ds3[0] == 1));
+
+  const int nx = n3[0];
+
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      const TF * fr = f + iy*df3[1] + iz*df3[2];
+      double * vr = pv + iy*ds3[1] + iz*ds3[2];
+      double * wr = pw ? pw + iy*ds3[1] + iz*ds3[2] : NULL;
+      const TW * ar = w ? w + iy*dw3[1] + iz*dw3[2] : NULL;
+      if (ds3[0] == 0) {
+	// row reduces to a single pixel
+	double v = vr[0];
+	if (op == reduce_sum) {
+	  for (int ix=0; ix<nx; ix++) v += dz*fr[ix];
+	} else if (op == reduce_min) {
+	  for (int ix=0; ix<nx; ix++) v = std::min(v,double(fr[ix]));
+	} else if (op == reduce_max) {
+	  for (int ix=0; ix<nx; ix++) v = std::max(v,double(fr[ix]));
+	} else if (op == reduce_avg) {
+	  double a = 0.0;
+	  if (ar) {
+	    for (int ix=0; ix<nx; ix++) {
+	      v += dz*ar[ix]*fr[ix];
+	      a += dz*ar[ix];
+	    }
+	  } else {
+	    for (int ix=0; ix<nx; ix++) v += dz*fr[ix];
+	    a = dz*nx;
+	  }
+	  wr[0] += a;
+	}
+	vr[0] = v;
+      } else {
+	// row maps to contiguous pixels
+	if (op == reduce_sum) {
+	  for (int ix=0; ix<nx; ix++) vr[ix] += dz*fr[ix];
+	} else if (op == reduce_min) {
+	  for (int ix=0; ix<nx; ix++) vr[ix] = std::min(vr[ix],double(fr[ix]));
+	} else if (op == reduce_max) {
+	  for (int ix=0; ix<nx; ix++) vr[ix] = std::max(vr[ix],double(fr[ix]));
+	} else if (op == reduce_avg) {
+	  if (ar) {
+	    for (int ix=0; ix<nx; ix++) {
+	      const double a = dz*ar[ix];
+	      vr[ix] += a*fr[ix];
+	      wr[ix] += a;
+	    }
+	  } else {
+	    for (int ix=0; ix<nx; ix++) {
+	      vr[ix] += dz*fr[ix];
+	      wr[ix] += dz;
+	    }
+	  }
+	}
+      }
+    }
+  }
+}
+
+template void OutputProjection::reduce_block<float,float>
+(int, const float *, const float *, const int[3], const int[3],
+ const int[3], const int[3], double, double *, double *);
+template void OutputProjection::reduce_block<float,double>
+(int, const float *, const double *, const int[3], const int[3],
+ const int[3], const int[3], double, double *, double *);
+template void OutputProjection::reduce_block<double,float>
+(int, const double *, const float *, const int[3], const int[3],
+ const int[3], const int[3], double, double *, double *);
+template void OutputProjection::reduce_block<double,double>
+(int, const double *, const double *, const int[3], const int[3],
+ const int[3], const int[3], double, double *, double *);
+
+//----------------------------------------------------------------------
+
+void OutputProjection::reduce_tile_
+(int op, int nu, double * image, const double * tile, const int box[4]) const
+{
+  const int mx = box[1]-box[0]+1;
+  for (int iy=box[2]; iy<=box[3]; iy++) {
+    double * a = image + box[0] + nu*iy;
+    const double * b = tile + mx*(iy-box[2]);
+    if (op == reduce_min) {
+      for (int ix=0; ix<mx; ix++) a[ix] = std::min(a[ix],b[ix]);
+    } else if (op == reduce_max) {
+      for (int ix=0; ix<mx; ix++) a[ix] = std::max(a[ix],b[ix]);
+    } else {
+      for (int ix=0; ix<mx; ix++) a[ix] += b[ix];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+double OutputProjection::value_final_ (int iv, int i) const
+{
+  const double v = value_[iv][i];
+  if (is_weighted_(iv)) {
+    const double w = weight_[iv][i];
+    return (w > 0.0) ? v / w : 0.0;
+  } else if (std::abs(v) == std::numeric_limits<double>::max()) {
+    // pixel not covered by any Block
+    return 0.0;
+  } else {
+    return v;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputProjection::write_view_files_
+(int iv, std::string file_base) const
+{
+  const char axis_name[] = "xyz";
+  const std::string field_name =
+    cello::field_descr()->field_name(index_field_[iv]);
+
+  const std::string file_name = file_base + "-" + field_name +
+    ((type_[iv] == view_type_slice) ? "-slice-" : "-proj-") +
+    axis_name[axis_[iv]];
+
+  const int nu = nu_[iv];
+  const int nv = nv_[iv];
+  const int m = nu*nv;
+
+  std::vector<float> image (m);
+  for (int i=0; i<m; i++) image[i] = value_final_(iv,i);
+
+  Monitor::instance()->print ("Output","writing projection file %s",
+			      file_name.c_str());
+
+  // Raw array: int32 width and height, then width*height float32
+  // values with the first image axis varying fastest
+
+  const std::string file_raw = file_name + ".raw";
+  FILE * fp = fopen (file_raw.c_str(),"wb");
+  if (fp == NULL) {
+    WARNING1 ("OutputProjection::write_view_files_()",
+	      "Cannot open file %s for writing",
+	      file_raw.c_str());
+  } else {
+    const int size[2] = {nu,nv};
+    fwrite (size,sizeof(int),2,fp);
+    fwrite (&image[0],sizeof(float),m,fp);
+    fclose (fp);
+  }
+
+  // PNG image
+
+  double min = std::numeric_limits<double>::max();
+  double max = -min;
+  for (int i=0; i<m; i++) {
+    const double value = image[i];
+    if (image_log_ && ! (value > 0.0)) continue;
+    const double v = image_log_ ? log(value) : value;
+    min = std::min(min,v);
+    max = std::max(max,v);
+  }
+
+  const std::string file_png = file_name + ".png";
+  const char * file_name_png = strdup(file_png.c_str());
+  pngwriter png (nu,nv,0,file_name_png);
+  free ((void *)file_name_png);
+
+  const size_t n = map_r_.size();
+
+  for (int iy=0; iy<nv; iy++) {
+    for (int ix=0; ix<nu; ix++) {
+      double value = image[ix + nu*iy];
+      if (image_log_) value = (value > 0.0) ? log(value) : min;
+      value = std::max(min,std::min(max,value));
+
+      // map value to colormap
+      const double t = (max > min) ? (n-1)*(value - min)/(max - min) : 0.0;
+      size_t k = std::min(size_t(t),n-2);
+      const double ratio = t - k;
+
+      const double r = (1-ratio)*map_r_[k] + ratio*map_r_[k+1];
+      const double g = (1-ratio)*map_g_[k] + ratio*map_g_[k+1];
+      const double b = (1-ratio)*map_b_[k] + ratio*map_b_[k+1];
+
+      png.plot (ix+1, iy+1, r,g,b);
+    }
+  }
+  png.close();
+}
@@ -0,0 +1,191 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputProjection.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Io] Declaration for the OutputProjection class
+
+#ifndef IO_OUTPUT_PROJECTION_HPP
+#define IO_OUTPUT_PROJECTION_HPP
+
+class Factory;
+class Config;
+
+/// @enum     view_type
+/// @brief    Type of image generated by OutputProjection
+enum view_type {
+  view_type_unknown,
+  view_type_projection,   // reduction of field values along the axis
+  view_type_slice         // field values on a plane normal to the axis
+};
+
+class OutputProjection : public Output {
+
+  /// @class    OutputProjection
+  /// @ingroup  Io
+  /// @brief [\ref Io] In-situ slices and projections of several fields
+  ///
+  /// Generates one image ("view") per field in the Output field_list,
+  /// each a slice or a projection along its own axis.  Projections
+  /// may be summed along the axis, averaged (optionally weighted by a
+  /// second field, e.g. density-weighted temperature), or reduced by
+  /// min or max.  Each leaf Block is visited once, reducing all views
+  /// with per-block kernels before adding the result to the image.
+  /// Images are combined over the Output reduction tree, sending only
+  /// the bounding box of updated pixels, and written as PNG files and
+  /// raw single-precision arrays.
+
+public: // functions
+
+  /// Empty constructor for Charm++ pup()
+  OutputProjection() throw() {}
+
+  /// Create an OutputProjection object
+  OutputProjection(int index,
+		   const Factory * factory,
+		   Config * config,
+		   int process_count) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(OutputProjection);
+
+  /// Charm++ PUP::able migration constructor
+  OutputProjection (CkMigrateMessage *m)
+    : Output (m),
+      index_field_(),
+      index_weight_(),
+      axis_(),
+      type_(),
+      op_reduce_(),
+      position_(),
+      nu_(),
+      nv_(),
+      value_(),
+      weight_(),
+      box_(),
+      map_r_(),map_g_(),map_b_(),
+      image_log_(false),
+      max_level_(0)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Set the image colormap
+  void set_colormap
+  (int n, double * map_r, double * map_g, double * map_b) throw();
+
+  /// Number of views
+  int num_views() const throw()
+  { return index_field_.size(); }
+
+  /// Reduce the field f (and optional weight w) of size n3 and
+  /// strides df3 (dw3) along the axis with plane stride 0, adding
+  /// into plane_v (and plane_w for reduce_avg) with strides ds3.
+  /// ds3[0] must be 0 or 1.  Instantiated for float and double
+  template <class TF, class TW>
+  static void reduce_block
+  (int op, const TF * f, const TW * w,
+   const int n3[3], const int df3[3], const int dw3[3],
+   const int ds3[3], double dz,
+   double * plane_v, double * plane_w);
+
+public: // virtual functions
+
+  /// Prepare for accumulating block data
+  virtual void init () throw();
+
+  /// Open (or create) a file for IO
+  virtual void open () throw();
+
+  /// Close file for IO
+  virtual void close () throw();
+
+  /// Write block-related field data
+  virtual void write_block ( const Block * block ) throw();
+
+  /// Write fields
+  virtual void write_field_data
+  ( const FieldData * field_data,
+    int index_field) throw();
+
+  /// Write particles
+  virtual void write_particle_data
+  ( const ParticleData * particle_data,
+    int index_particle) throw();
+
+  /// Prepare local array with data to be sent to remote chare for processing
+  virtual void prepare_remote (int * n, char ** buffer) throw();
+
+  /// Accumulate and write data sent from a remote processes
+  virtual void update_remote  ( int n, char * buffer) throw();
+
+  /// Free local array if allocated; NOP if not
+  virtual void cleanup_remote (int * n, char ** buffer) throw();
+
+private: // functions
+
+  /// Whether the view needs a weight image
+  bool is_weighted_ (int iv) const
+  { return (op_reduce_[iv] == reduce_avg); }
+
+  /// Add the block's contribution to view iv
+  void write_view_ (int iv, const Block * block);
+
+  /// Reduce the tile of the given pixel bounds into the image of
+  /// width nu using the given operation
+  void reduce_tile_
+  (int op, int nu, double * image, const double * tile,
+   const int box[4]) const;
+
+  /// Return the final value of pixel i of view iv
+  double value_final_ (int iv, int i) const;
+
+  /// Write the PNG and raw files for view iv
+  void write_view_files_ (int iv, std::string file_base) const;
+
+private: // attributes
+
+  /// Field to image for each view
+  std::vector<int> index_field_;
+
+  /// Field to weight averages by, or -1 for none
+  std::vector<int> index_weight_;
+
+  /// Axis normal to the image
+  std::vector<int> axis_;
+
+  /// Slice or projection
+  std::vector<int> type_;
+
+  /// Reduction operation along the axis for projections
+  std::vector<int> op_reduce_;
+
+  /// Position of slice relative to the domain, between 0 and 1
+  std::vector<double> position_;
+
+  /// Image size
+  std::vector<int> nu_;
+  std::vector<int> nv_;
+
+  /// Reduced field values (and weights) for each view
+  std::vector< std::vector<double> > value_;
+  std::vector< std::vector<double> > weight_;
+
+  /// Bounds ixm,ixp,iym,iyp of pixels updated for each view
+  std::vector<int> box_;
+
+  /// Color map
+  std::vector<double> map_r_;
+  std::vector<double> map_g_;
+  std::vector<double> map_b_;
+
+  /// Whether to plot the log of the image in the PNG file
+  bool image_log_;
+
+  /// Mesh level corresponding to one pixel
+  int max_level_;
+
+};
+
+#endif /* IO_OUTPUT_PROJECTION_HPP */
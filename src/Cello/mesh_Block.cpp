@@ -58,6 +58,7 @@ Block::Block ( MsgRefine * msg )
   time_(0.0),
   dt_(0.0),
   stop_(false),
+  reduce_combine_(),
   index_initial_(0),
   children_(),
   sync_coarsen_(),
@@ -70,15 +71,20 @@ Block::Block ( MsgRefine * msg )
   count_coarsen_(0),
   adapt_step_(0),
   adapt_(adapt_unknown),
+  adapt_cache_(adapt_unknown),
+  adapt_cache_cycle_(-1),
+  adapt_cache_time_(-1.0),
   coarsened_(false),
   delete_(false),
   is_leaf_(true),
   age_(0),
   face_level_last_(),
+  neighbor_table_(),
   name_(""),
   index_method_(-1),
   index_solver_(),
-  refresh_()
+  refresh_(),
+  field_version_()
 {
   performance_start_(perf_block);
   usesAtSync = true;
@@ -125,6 +131,7 @@ Block::Block ( process_type ip_source )
   time_(0.0),
   dt_(0.0),
   stop_(false),
+  reduce_combine_(),
   index_initial_(0),
   children_(),
   sync_coarsen_(),
@@ -137,15 +144,20 @@ Block::Block ( process_type ip_source )
   count_coarsen_(0),
   adapt_step_(0),
   adapt_(adapt_unknown),
+  adapt_cache_(adapt_unknown),
+  adapt_cache_cycle_(-1),
+  adapt_cache_time_(-1.0),
   coarsened_(false),
   delete_(false),
   is_leaf_(true),
   age_(0),
   face_level_last_(),
+  neighbor_table_(),
   name_(""),
   index_method_(-1),
   index_solver_(),
-  refresh_()
+  refresh_(),
+  field_version_()
 {
   usesAtSync = true;
 #ifdef TRACE_BLOCK
@@ -161,7 +173,13 @@ Block::Block ( process_type ip_source )
 
   thisIndex.array(array_,array_+1,array_+2);
 
-  proxy_simulation[ip_source].p_get_msg_refine(thisIndex);
+  if (ip_source == process_type(CkMyPe())) {
+    // Creating Block is on this process: request the MsgRefine from
+    // the local Simulation directly instead of via a message
+    cello::simulation()->p_get_msg_refine(thisIndex);
+  } else {
+    proxy_simulation[ip_source].p_get_msg_refine(thisIndex);
+  }
   
   performance_stop_(perf_block);
 }
@@ -396,6 +414,7 @@ void Block::pup(PUP::er &p)
   p | time_;
   p | dt_;
   p | stop_;
+  p | reduce_combine_;
   p | index_initial_;
   p | children_;
   p | sync_coarsen_;
@@ -408,6 +427,9 @@ void Block::pup(PUP::er &p)
   p | count_coarsen_;
   p | adapt_step_;
   p | adapt_;
+  p | adapt_cache_;
+  p | adapt_cache_cycle_;
+  p | adapt_cache_time_;
   p | coarsened_;
   p | delete_;
   p | is_leaf_;
@@ -462,6 +484,40 @@ ItNeighbor Block::it_neighbor (int min_face_rank, Index index,
 
 //----------------------------------------------------------------------
 
+const std::vector<BlockNeighbor> & Block::neighbors
+(int min_face_rank, int neighbor_type, int min_level, int root_level)
+{
+  const std::tuple<int,int,int,int> key
+    (min_face_rank,neighbor_type,min_level,root_level);
+
+  auto it = neighbor_table_.find(key);
+
+  if (it != neighbor_table_.end()) return it->second;
+
+  std::vector<BlockNeighbor> & list = neighbor_table_[key];
+
+  ItNeighbor it_neighbor = this->it_neighbor
+    (min_face_rank,index_,neighbor_type,min_level,root_level);
+
+  const int level = this->level();
+
+  BlockNeighbor neighbor;
+  while (it_neighbor.next(neighbor.of3)) {
+    neighbor.index = it_neighbor.index();
+    it_neighbor.child(neighbor.ic3);
+    neighbor.level_face = it_neighbor.face_level();
+    neighbor.refresh_type =
+      (neighbor.level_face == level - 1) ? refresh_coarse :
+      (neighbor.level_face == level)     ? refresh_same :
+      (neighbor.level_face == level + 1) ? refresh_fine : refresh_unknown;
+    list.push_back(neighbor);
+  }
+
+  return list;
+}
+
+//----------------------------------------------------------------------
+
 Method * Block::method () throw ()
 {
   Problem * problem = cello::problem();
@@ -590,6 +646,7 @@ void Block::apply_initial_() throw ()
   index_initial_ = 0;
   Problem * problem = cello::problem();
   while (Initial * initial = problem->initial(index_initial_++)) {
+    field_modified();
     initial->enforce_block(this,cello::hierarchy());
   }
 }
@@ -704,6 +761,7 @@ Block::Block (CkMigrateMessage *m)
     time_(0.0),
     dt_(0.0),
     stop_(false),
+    reduce_combine_(),
     index_initial_(0),
     children_(),
     sync_coarsen_(),
@@ -716,15 +774,20 @@ Block::Block (CkMigrateMessage *m)
     count_coarsen_(0),
     adapt_step_(0),
     adapt_(adapt_unknown),
+    adapt_cache_(adapt_unknown),
+    adapt_cache_cycle_(-1),
+    adapt_cache_time_(-1.0),
     coarsened_(false),
     delete_(false),
     is_leaf_(true),
     age_(0),
     face_level_last_(),
+    neighbor_table_(),
     name_(""),
     index_method_(-1),
     index_solver_(),
-    refresh_()
+    refresh_(),
+    field_version_()
 {
   
 #ifdef TRACE_BLOCK
@@ -963,6 +1026,10 @@ void Block::update_boundary_ ()
 
   determine_boundary_(is_boundary,&fxm,&fxp,&fym,&fyp,&fzm,&fzp);
 
+  if (! (fxm || fxp || fym || fyp || fzm || fzp)) return;
+
+  performance_start_(perf_boundary,__FILE__,__LINE__);
+
   int index = 0;
   Problem * problem = cello::problem();
   Boundary * boundary;
@@ -976,6 +1043,8 @@ void Block::update_boundary_ ()
     if ( fzm ) boundary->enforce(this,face_lower,axis_z);
     if ( fzp ) boundary->enforce(this,face_upper,axis_z);
   }
+
+  performance_stop_(perf_boundary,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
@@ -1002,6 +1071,9 @@ void Block::copy_(const Block & block) throw()
   stop_       = block.stop_;
   adapt_step_ = block.adapt_step_;
   adapt_      = block.adapt_;
+  adapt_cache_       = block.adapt_cache_;
+  adapt_cache_cycle_ = block.adapt_cache_cycle_;
+  adapt_cache_time_  = block.adapt_cache_time_;
   coarsened_  = block.coarsened_;
   delete_     = block.delete_;
 }
@@ -1029,8 +1101,16 @@ void Block::performance_start_
 (int index_region, std::string file, int line)
 {
   Simulation * simulation = cello::simulation();
-  if (simulation)
-    simulation->performance()->start_region(index_region,file,line);
+  if (simulation) {
+    Performance * performance = simulation->performance();
+    performance->start_region(index_region,file,line);
+    EventTrace * event_trace = performance->event_trace();
+    if (event_trace->is_active()) {
+      int v3[3];
+      index_.values(v3);
+      event_trace->record (trace_type_start,index_region,cycle_,v3);
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1039,8 +1119,47 @@ void Block::performance_stop_
 (int index_region, std::string file, int line)
 {
   Simulation * simulation = cello::simulation();
-  if (simulation)
-    simulation->performance()->stop_region(index_region,file,line);
+  if (simulation) {
+    Performance * performance = simulation->performance();
+    performance->stop_region(index_region,file,line);
+    EventTrace * event_trace = performance->event_trace();
+    if (event_trace->is_active()) {
+      int v3[3];
+      index_.values(v3);
+      event_trace->record (trace_type_stop,index_region,cycle_,v3);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+long long Block::trace_send_ ()
+{
+  Simulation * simulation = cello::simulation();
+  EventTrace * event_trace =
+    simulation ? simulation->performance()->event_trace() : NULL;
+  if (event_trace == NULL || ! event_trace->is_active()) return 0;
+
+  const long long trace_id = event_trace->new_message_id();
+  int v3[3];
+  index_.values(v3);
+  event_trace->record (trace_type_send,perf_unknown,cycle_,v3,trace_id);
+  return trace_id;
+}
+
+//----------------------------------------------------------------------
+
+void Block::trace_recv_ (long long trace_id)
+{
+  if (trace_id == 0) return;
+  Simulation * simulation = cello::simulation();
+  EventTrace * event_trace =
+    simulation ? simulation->performance()->event_trace() : NULL;
+  if (event_trace == NULL || ! event_trace->is_active()) return;
+
+  int v3[3];
+  index_.values(v3);
+  event_trace->record (trace_type_recv,perf_unknown,cycle_,v3,trace_id);
 }
 
 //----------------------------------------------------------------------
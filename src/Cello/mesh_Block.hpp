@@ -34,6 +34,26 @@ class Solver;
 
 //----------------------------------------------------------------------
 
+/// @brief [\ref Mesh] Neighbor of a Block as given by ItNeighbor,
+/// cached by Block::neighbors() until the mesh changes
+struct BlockNeighbor {
+
+  /// Index of the neighbor Block
+  Index index;
+
+  /// Face shared with the neighbor
+  int of3[3];
+
+  /// Child indices as given by ItNeighbor::child()
+  int ic3[3];
+
+  /// Level of the neighbor
+  int level_face;
+
+  /// refresh_coarse, refresh_same, or refresh_fine
+  int refresh_type;
+};
+
 class Block : public CBase_Block
 {
   /// @class    Block
@@ -107,11 +127,15 @@ public: // interface
     count_coarsen_(0),
     adapt_step_(0),
     adapt_(0),
+    adapt_cache_(adapt_unknown),
+    adapt_cache_cycle_(-1),
+    adapt_cache_time_(-1.0),
     coarsened_(false),
     delete_(false),
     is_leaf_(true),
     age_(0),
     face_level_last_(),
+    neighbor_table_(),
     name_(""),
     index_method_(-1),
     index_solver_(),
@@ -175,6 +199,18 @@ public: // interface
   bool stop() const throw() 
   { return stop_; };
 
+  /// Deposit a value to be reduced over all Blocks using reduce_min,
+  /// reduce_max, or reduce_sum.  Values are combined into the single
+  /// reduction of the next stopping phase, after which the result
+  /// is available from reduce_result()
+  void reduce_deposit (std::string name, int op, long double value) throw()
+  { reduce_combine_.deposit(name,op,value); }
+
+  /// Return whether the named value was reduced in the most recent
+  /// stopping phase, and if so its global value
+  static bool reduce_result (std::string name, long double * value) throw()
+  { return ReduceCombine::result().value(name,value); }
+
   /// Return whether this Block is a leaf in the octree array
   bool is_leaf() const 
   { return is_leaf_ && ! (index_.level() < 0); }
@@ -237,6 +273,7 @@ public: // interface
 
   void update_levels_ ()
   {
+    neighbor_table_.clear();
     face_level_curr_ =       face_level_next_;
     //    for (int i=0; i<face_level_next_.size(); i++) face_level_next_[i]=0;
     child_face_level_curr_ = child_face_level_next_;
@@ -268,6 +305,13 @@ public: // interface
 			 int min_level,
 			 int root_level) throw();
 
+  /// Return the neighbors of this Block as given by it_neighbor()
+  /// for index_.  The list is computed once and reused until the
+  /// mesh changes in the adapt phase, or the Block migrates.
+
+  const std::vector<BlockNeighbor> & neighbors
+  (int min_face_rank, int neighbor_type, int min_level, int root_level);
+
   //--------------------------------------------------
   // Charm++ virtual
   //--------------------------------------------------
@@ -368,6 +412,32 @@ public: // methods
   void compute_derived(const std::vector< std::string >& field_list =
                              std::vector< std::string>()) throw();
 
+  /// Return the field version, which is incremented whenever Field
+  /// data may have changed
+  long long field_version() const throw()
+  { return field_version_.version(); }
+
+  /// Increment the field version, invalidating all derived fields.
+  /// Called between Methods and after refresh, adapt, and
+  /// initialization; a Method that modifies fields and then
+  /// recomputes a derived field itself must also call it
+  void field_modified() throw()
+  { field_version_.modified(); }
+
+  /// Return whether the named derived field and history was computed
+  /// in its permanent field since Field data was last modified, using
+  /// the same compute parameters (e.g. gamma or floors).  Always false
+  /// if DEBUG_DERIVED_CACHE is defined in mesh_FieldVersion.hpp
+  bool is_derived_current (std::string name, int i_hist,
+			   const std::vector<double> & param) const throw()
+  { return field_version_.is_current(name,i_hist,param); }
+
+  /// Mark the named derived field and history as current for the
+  /// given compute parameters
+  void set_derived_current (std::string name, int i_hist,
+			    const std::vector<double> & param) throw()
+  { field_version_.set_current(name,i_hist,param); }
+
   //--------------------------------------------------
   // OUTPUT
   //--------------------------------------------------
@@ -674,13 +744,6 @@ public:
     stopping_enter_();
     performance_stop_(perf_stopping);
   }
-  void r_stopping_enter (CkReductionMsg * msg) 
-  {
-    performance_start_(perf_stopping);
-    delete msg;    
-    stopping_enter_();
-    performance_stop_(perf_stopping);
-  }
 
   /// Quiescence before load balancing
   void p_stopping_balance();
@@ -736,6 +799,13 @@ protected:
   void performance_stop_
   (int index_region, std::string file="", int line=0);
 
+  /// Record sending a traced message in the EventTrace, returning
+  /// its identifier or 0 if tracing is disabled
+  long long trace_send_ ();
+
+  /// Record receiving a traced message in the EventTrace
+  void trace_recv_ (long long trace_id);
+
   //--------------------------------------------------
   // TESTING
   //--------------------------------------------------
@@ -932,6 +1002,9 @@ protected: // attributes
   /// Current stopping criteria
   bool stop_;
 
+  /// Values deposited for the next combined reduction
+  ReduceCombine reduce_combine_;
+
   //--------------------------------------------------
 
   /// Index of current initialization routine
@@ -970,6 +1043,12 @@ protected: // attributes
   /// Current adapt value for the block
   int adapt_;
 
+  /// Cached result of the refinement criteria, and the cycle and
+  /// time at which it was computed (adapt_cache_cycle_ < 0 if none)
+  int adapt_cache_;
+  int adapt_cache_cycle_;
+  double adapt_cache_time_;
+
   /// whether Block has been coarsened and should be deleted
   bool coarsened_;
 
@@ -986,6 +1065,11 @@ protected: // attributes
   /// Last face level received from given face
   std::vector<int> face_level_last_;
 
+  /// Neighbor lists indexed by min_face_rank, neighbor_type,
+  /// min_level and root_level (not pup'ed)
+  std::map< std::tuple<int,int,int,int>,
+	    std::vector<BlockNeighbor> > neighbor_table_;
+
   /// String for storing bit ID name
   mutable std::string name_;
 
@@ -999,6 +1083,11 @@ protected: // attributes
   /// (Not a pointer since must be one per Block for synchronization counters)
   std::vector<Refresh*> refresh_;
 
+  /// Field version and the versions at which derived fields were
+  /// last computed (not pup'ed, so derived fields are recomputed
+  /// after migration or restart)
+  FieldVersion field_version_;
+
 };
 
 #endif /* COMM_BLOCK_HPP */
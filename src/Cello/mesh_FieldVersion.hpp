@@ -0,0 +1,84 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     mesh_FieldVersion.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Mesh] Declaration of the FieldVersion class
+///
+/// This class tracks whether a Block's derived fields (pressure,
+/// temperature, etc.) are still current.  The version is incremented
+/// whenever Field data may have changed, and each derived field
+/// records the version and compute parameters with which it was last
+/// computed into its permanent field.
+///
+/// Define DEBUG_DERIVED_CACHE to treat derived fields as never
+/// current, so that they are always recomputed; comparing outputs
+/// with and without it checks for a missing modified() call
+
+#ifndef MESH_FIELD_VERSION_HPP
+#define MESH_FIELD_VERSION_HPP
+
+// #define DEBUG_DERIVED_CACHE
+
+class FieldVersion {
+
+  /// @class    FieldVersion
+  /// @ingroup  Mesh
+  /// @brief    [\ref Mesh] Field version for reusing current derived fields
+
+public: // interface
+
+  /// Constructor
+  FieldVersion() throw()
+    : version_(0),
+      derived_()
+  { }
+
+  /// Return the field version
+  long long version() const throw()
+  { return version_; }
+
+  /// Increment the field version, invalidating all derived fields
+  void modified() throw()
+  { ++version_; }
+
+  /// Return whether the named derived field and history was computed
+  /// since Field data was last modified, using the same compute
+  /// parameters (e.g. gamma or floors)
+  bool is_current (std::string name, int i_hist,
+		   const std::vector<double> & param) const throw()
+  {
+#ifdef DEBUG_DERIVED_CACHE
+    return false;
+#else
+    std::map< std::pair<std::string,int>,
+	      std::pair<long long, std::vector<double> > >::const_iterator it =
+      derived_.find(std::make_pair(name,i_hist));
+    return (it != derived_.end())
+      && (it->second.first == version_)
+      && (it->second.second == param);
+#endif
+  }
+
+  /// Mark the named derived field and history as current for the
+  /// given compute parameters
+  void set_current (std::string name, int i_hist,
+		    const std::vector<double> & param) throw()
+  {
+    derived_[std::make_pair(name,i_hist)] =
+      std::make_pair(version_,param);
+  }
+
+private: // attributes
+
+  /// Field version, incremented whenever Field data may have changed
+  long long version_;
+
+  /// Field version and compute parameters with which each derived
+  /// field and history was last computed
+  std::map< std::pair<std::string,int>,
+	    std::pair<long long, std::vector<double> > > derived_;
+
+};
+
+#endif /* MESH_FIELD_VERSION_HPP */
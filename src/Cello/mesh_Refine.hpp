@@ -61,6 +61,10 @@ public: // interface
   /// Return the name of the refinement criteria
   virtual std::string name () const { return "unknown"; }
 
+  /// Return whether the criteria writes to a refinement output field,
+  /// in which case it must be evaluated over the entire Block
+  bool has_output () const { return output_ != ""; }
+
   /// Clear the output field to the default coarsen (-1)
   void * initialize_output_(FieldData * field_data);
 
@@ -79,20 +79,24 @@ int RefineDensity::apply_
   int gx, int gy, int gz ) const throw ()
 {
 
-  bool any_refine  = false;
+  // Reduce minimum and maximum along each x-pencil, returning as soon
+  // as any pencil requires refinement
+
   bool all_coarsen = true;
   for (int iz=gz; iz<mz-gz; iz++) {
     for (int iy=gy; iy<my-gy; iy++) {
+      const T * a0 = array + mx*(iy + my*iz);
+      T a_min = a0[gx];
+      T a_max = a0[gx];
       for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] < max_coarsen_) all_coarsen = false;
+	a_min = std::min(a_min,a0[ix]);
+	a_max = std::max(a_max,a0[ix]);
       }
+      if (a_max > min_refine_)  return adapt_refine;
+      if (a_min < max_coarsen_) all_coarsen = false;
     }
   }
-  return 
-    any_refine ?  adapt_refine :
-    (all_coarsen ? adapt_coarsen : adapt_same) ;
+  return all_coarsen ? adapt_coarsen : adapt_same;
 
 }
 
@@ -56,6 +56,10 @@ int RefineSlope::apply ( Block * block ) throw ()
 
   for (size_t k=0; k<field_id_list_.size(); k++) {
 
+    // Remaining fields cannot change the result once refinement is
+    // required, unless the output field still needs to be written
+    if (any_refine && ! output) break;
+
     int id_field = field_id_list_[k];
 
     int gx,gy,gz;
@@ -126,6 +130,35 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
   T slope;
   const int d3[3] = {1,mx,mx*my};
   T tiny = 1e-10;
+
+  if (output == NULL) {
+
+    // No output field: reduce the maximum slope along each x-pencil
+    // using a branch-free inner loop, and return as soon as any
+    // pencil requires refinement
+
+    for (int axis=0; axis<rank; axis++) {
+      const int id = d3[axis];
+      const T h2 = 2.0*h3[axis];
+      for (int iz=gz; iz<mz-gz; iz++) {
+	for (int iy=gy; iy<my-gy; iy++) {
+	  const T * a0 = array + mx*(iy + my*iz);
+	  T slope_max = 0.0;
+	  for (int ix=gx; ix<mx-gx; ix++) {
+	    T a = std::max(T(h2*fabs(a0[ix])),tiny);
+	    slope_max = std::max(slope_max,T(fabs((a0[ix+id]-a0[ix-id]) / a)));
+	  }
+	  if (slope_max > max_coarsen_) *all_coarsen = false;
+	  if (slope_max > min_refine_) {
+	    *any_refine = true;
+	    return;
+	  }
+	}
+      }
+    }
+    return;
+  }
+
   int count=0;
   for (int axis=0; axis<rank; axis++) {
     int id = d3[axis];
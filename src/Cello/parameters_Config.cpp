@@ -73,6 +73,7 @@ void Config::pup (PUP::er &p)
   p | field_precision;
   p | field_prolong;
   p | field_restrict;
+  p | field_compress_min_bytes;
   p | field_group_list;
 
   // Initial
@@ -135,6 +136,12 @@ void Config::pup (PUP::er &p)
   p | output_image_color_particle_attribute;
   p | output_image_size;
   p | output_image_reduce_type;
+  p | output_image_reduce_arity;
+  p | output_projection_type;
+  p | output_projection_axis;
+  p | output_projection_weight;
+  p | output_projection_reduce;
+  p | output_projection_position;
   p | output_image_ghost;
   p | output_image_face_rank;
   p | output_image_min;
@@ -180,6 +187,8 @@ void Config::pup (PUP::er &p)
   p | performance_warnings;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_trace_size;
+  p | performance_trace_file;
 
   // Physics
   
@@ -590,6 +599,8 @@ void Config::read_field_ (Parameters * p) throw()
   field_prolong   = p->value_string ("Field:prolong","linear");
 
   field_restrict  = p->value_string ("Field:restrict","linear");
+
+  field_compress_min_bytes = p->value_integer ("Field:compress_min_bytes",0);
 }
 
 //----------------------------------------------------------------------
@@ -784,6 +795,12 @@ void Config::read_output_ (Parameters * p) throw()
   output_image_color_particle_attribute.resize(num_output);
   output_image_size.resize(num_output);
   output_image_reduce_type.resize(num_output);
+  output_image_reduce_arity.resize(num_output);
+  output_projection_type.resize(num_output);
+  output_projection_axis.resize(num_output);
+  output_projection_weight.resize(num_output);
+  output_projection_reduce.resize(num_output);
+  output_projection_position.resize(num_output);
   output_image_ghost.resize(num_output);
   output_image_face_rank.resize(num_output);
   output_image_min.resize(num_output);
@@ -922,6 +939,9 @@ void Config::read_output_ (Parameters * p) throw()
       output_image_reduce_type[index_output] = 
 	p->value_string("image_reduce_type","sum");
 
+      output_image_reduce_arity[index_output] = 
+	p->value_integer("image_reduce_arity",4);
+
       output_image_face_rank[index_output] = 
 	p->value_integer("image_face_rank",3);
 
@@ -957,6 +977,62 @@ void Config::read_output_ (Parameters * p) throw()
       }
 
     }
+
+    // Projection
+
+    if (output_type[index_output] == "projection") {
+
+      // one view per field, with view parameters either a list with
+      // one value per field or a single value for all fields
+
+      const int num_views = output_field_list[index_output].size();
+
+      output_projection_type    [index_output].resize(num_views);
+      output_projection_axis    [index_output].resize(num_views);
+      output_projection_weight  [index_output].resize(num_views);
+      output_projection_reduce  [index_output].resize(num_views);
+      output_projection_position[index_output].resize(num_views);
+
+      for (int iv=0; iv<num_views; iv++) {
+	output_projection_type[index_output][iv] =
+	  (p->type("projection_type") == parameter_list) ?
+	  p->list_value_string(iv,"projection_type","projection") :
+	  p->value_string("projection_type","projection");
+	output_projection_axis[index_output][iv] =
+	  (p->type("projection_axis") == parameter_list) ?
+	  p->list_value_string(iv,"projection_axis","z") :
+	  p->value_string("projection_axis","z");
+	output_projection_weight[index_output][iv] =
+	  (p->type("projection_weight") == parameter_list) ?
+	  p->list_value_string(iv,"projection_weight","") :
+	  p->value_string("projection_weight","");
+	output_projection_reduce[index_output][iv] =
+	  (p->type("projection_reduce") == parameter_list) ?
+	  p->list_value_string(iv,"projection_reduce","") :
+	  p->value_string("projection_reduce","");
+	output_projection_position[index_output][iv] =
+	  (p->type("projection_position") == parameter_list) ?
+	  p->list_value_float(iv,"projection_position",0.5) :
+	  p->value_float("projection_position",0.5);
+      }
+
+      output_image_log[index_output] = p->value_logical("image_log",false);
+
+      output_image_reduce_arity[index_output] = 
+	p->value_integer("image_reduce_arity",4);
+
+      output_max_level[index_output] =
+	p->value_integer("max_level",std::numeric_limits<int>::max());
+
+      if (p->type("colormap") == parameter_list) {
+	int size = p->list_length("colormap");
+	output_colormap[index_output].resize(size);
+	for (int i=0; i<size; i++) {
+	  output_colormap[index_output][i] = 
+	    p->list_value_float(i,"colormap",0.0);
+	}
+      }
+    }
   }  
 
 }
@@ -1174,6 +1250,10 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_trace_size = p->value_integer("Performance:trace:size",0);
+  performance_trace_file = p->value_string
+    ("Performance:trace:file","trace-%04d.data");
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -55,6 +55,7 @@ public: // interface
     field_precision(0),
     field_prolong(""),
     field_restrict(""),
+    field_compress_min_bytes(0),
     field_group_list(),
     num_initial(0),
     initial_list(),
@@ -97,6 +98,12 @@ public: // interface
     output_image_color_particle_attribute(),
     output_image_size(),
     output_image_reduce_type(),
+    output_image_reduce_arity(),
+    output_projection_type(),
+    output_projection_axis(),
+    output_projection_weight(),
+    output_projection_reduce(),
+    output_projection_position(),
     output_image_ghost(),
     output_image_face_rank(),
     output_image_min(),
@@ -133,6 +140,8 @@ public: // interface
     performance_warnings(false),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_trace_size(0),
+    performance_trace_file(""),
     num_physics(0),
     physics_list(),
     restart_file(""),
@@ -203,6 +212,7 @@ public: // interface
       field_precision(0),
       field_prolong(""),
       field_restrict(""),
+      field_compress_min_bytes(0),
       field_group_list(),
       num_initial(0),
       initial_list(),
@@ -245,6 +255,12 @@ public: // interface
       output_image_color_particle_attribute(),
       output_image_size(),
       output_image_reduce_type(),
+      output_image_reduce_arity(),
+      output_projection_type(),
+      output_projection_axis(),
+      output_projection_weight(),
+      output_projection_reduce(),
+      output_projection_position(),
       output_image_ghost(),
       output_image_face_rank(),
       output_image_min(),
@@ -281,6 +297,8 @@ public: // interface
       performance_warnings(false),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_trace_size(0),
+      performance_trace_file(""),
       num_physics(0),
       physics_list(),
       restart_file(""),
@@ -383,6 +401,7 @@ public: // attributes
   int                        field_precision;
   std::string                field_prolong;
   std::string                field_restrict;
+  int                        field_compress_min_bytes;
   std::vector< std::vector<std::string> >  field_group_list;
 
   // Initial
@@ -446,6 +465,12 @@ public: // attributes
   std::vector < std::string > output_image_color_particle_attribute;
   std::vector < std::vector <int> > output_image_size;
   std::vector < std::string>  output_image_reduce_type;
+  std::vector < int >         output_image_reduce_arity;
+  std::vector < std::vector <std::string> > output_projection_type;
+  std::vector < std::vector <std::string> > output_projection_axis;
+  std::vector < std::vector <std::string> > output_projection_weight;
+  std::vector < std::vector <std::string> > output_projection_reduce;
+  std::vector < std::vector <double> > output_projection_position;
   std::vector < char>         output_image_ghost;
   std::vector < int >         output_image_face_rank;
   std::vector < double>       output_image_min;
@@ -494,6 +519,8 @@ public: // attributes
   bool                       performance_warnings;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  int                        performance_trace_size;
+  std::string                performance_trace_file;
 
   // Physics
   
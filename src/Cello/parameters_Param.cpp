@@ -408,6 +408,25 @@ void Param::evaluate_float
 
 //----------------------------------------------------------------------
 
+bool Param::uses_variable (char var, struct node_expr * node) const
+/// @param var  Variable name 'x', 'y', 'z', or 't'
+/// @param node Head node of the expression tree
+{
+  if (node == 0) {
+    if (type_ != parameter_float_expr &&
+	type_ != parameter_logical_expr) return false;
+    node = value_expr_;
+  }
+
+  if (node->type == enum_node_variable && node->var_value == var)
+    return true;
+
+  return ((node->left  && uses_variable(var,node->left)) ||
+	  (node->right && uses_variable(var,node->right)));
+}
+
+//----------------------------------------------------------------------
+
 void Param::evaluate_logical
 (int                n, 
  bool   *           result, 
@@ -99,6 +99,10 @@ public: // interface
     double             t,
     struct node_expr * node = 0);
 
+  /// Return whether an expression refers to the variable var ('x',
+  /// 'y', 'z', or 't')
+  bool uses_variable (char var, struct node_expr * node = 0) const;
+
   /// Set the parameter type and value
   void set(struct param_struct * param);
 
@@ -0,0 +1,71 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_EventTrace.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of the EventTrace class
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+//----------------------------------------------------------------------
+
+EventTrace::EventTrace(int size) throw()
+  : event_(size),
+    num_events_(0),
+    num_written_(0),
+    is_open_(false),
+    message_count_(0)
+{
+}
+
+//----------------------------------------------------------------------
+
+void EventTrace::flush
+(std::string file_name,
+ const std::vector<std::string> & region_name) throw()
+{
+  if (event_.empty()) return;
+
+  FILE * fp = fopen (file_name.c_str(), is_open_ ? "a" : "w");
+
+  if (fp == NULL) {
+    WARNING1 ("EventTrace::flush()",
+              "Cannot open trace file %s for writing",
+              file_name.c_str());
+    return;
+  }
+
+  if (! is_open_) {
+    fprintf (fp,"# pe %d\n",CkMyPe());
+    for (size_t i=0; i<region_name.size(); i++) {
+      fprintf (fp,"# region %d %s\n",int(i),region_name[i].c_str());
+    }
+    fprintf (fp,"# time-usec cycle type region index-x index-y index-z message\n");
+    is_open_ = true;
+  }
+
+  // events overwritten in the ring buffer since the last flush
+
+  const long long n = event_.size();
+  const long long i0 = std::max(num_written_, num_events_ - n);
+
+  if (i0 > num_written_) {
+    fprintf (fp,"# dropped %lld\n",i0 - num_written_);
+  }
+
+  const char * type_name[] = {"unknown","start","stop","send","recv"};
+
+  for (long long i=i0; i<num_events_; i++) {
+    const event_type & event = event_[i % n];
+    fprintf (fp,"%lld %d %s %d %08X %08X %08X %llX\n",
+             event.time, event.cycle, type_name[event.type], event.region,
+             event.index3[0],event.index3[1],event.index3[2],
+             event.message);
+  }
+
+  num_written_ = num_events_;
+
+  fclose (fp);
+}
@@ -0,0 +1,137 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_EventTrace.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Performance] Declaration of the EventTrace class
+
+#ifndef PERFORMANCE_EVENT_TRACE_HPP
+#define PERFORMANCE_EVENT_TRACE_HPP
+
+/// @enum     trace_type
+/// @brief    Type of event recorded by EventTrace
+enum trace_type {
+  trace_type_unknown,
+  trace_type_start,   // Block started a performance region
+  trace_type_stop,    // Block stopped a performance region
+  trace_type_send,    // Block sent a traced message
+  trace_type_recv     // Block received a traced message
+};
+
+class EventTrace {
+
+  /// @class    EventTrace
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Per-process ring buffer of
+  /// timestamped Block events
+  ///
+  /// Records Block phase transitions and traced message sends and
+  /// receives, so that the critical path of a cycle across Blocks
+  /// and processes can be reconstructed offline with
+  /// tools/critical_path.py.  Only the most recent size() events are
+  /// kept between calls to flush(), so the size should be large enough
+  /// to hold one cycle's events.  Recording is disabled if the size is
+  /// 0.
+
+public: // interface
+
+  /// Constructor
+  EventTrace(int size = 0) throw();
+
+  /// CHARM++ Pack / Unpack function
+  inline void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    // NOTE: change this function whenever attributes change
+    // Recorded events are process-local and are not migrated
+    int size = event_.size();
+    p | size;
+    if (p.isUnpacking()) {
+      event_.resize(size);
+      num_events_  = 0;
+      num_written_ = 0;
+      is_open_     = false;
+    }
+    p | message_count_;
+  }
+
+  /// Whether events are being recorded
+  bool is_active() const throw()
+  { return ! event_.empty(); }
+
+  /// Capacity of the ring buffer
+  int size() const throw()
+  { return event_.size(); }
+
+  /// Number of events recorded, including those overwritten
+  long long num_events() const throw()
+  { return num_events_; }
+
+  /// Record an event for the Block with the given Index values
+  inline void record (int type, int region, int cycle,
+                      const int index3[3], long long message = 0) throw()
+  {
+    if (event_.empty()) return;
+    event_type & event = event_[num_events_ % event_.size()];
+    event.time      = time_real_();
+    event.type      = type;
+    event.region    = region;
+    event.cycle     = cycle;
+    event.index3[0] = index3[0];
+    event.index3[1] = index3[1];
+    event.index3[2] = index3[2];
+    event.message   = message;
+    ++num_events_;
+  }
+
+  /// Return a new identifier for a traced message, unique across
+  /// processes
+  long long new_message_id() throw()
+  { return (((long long)CkMyPe()) << 40) | (++message_count_); }
+
+  /// Append events recorded since the last call to the given file in
+  /// chronological order.  The first call creates the file and
+  /// writes a header including the given region names.
+  void flush (std::string file_name,
+              const std::vector<std::string> & region_name) throw();
+
+private: // functions
+
+  /// Return the current time in usec
+  long long time_real_ () const
+  {
+    struct timeval tv;
+    struct timezone tz;
+    gettimeofday (&tv,&tz);
+    return (long long )(1000000) * tv.tv_sec + tv.tv_usec;
+  }
+
+private: // attributes
+
+  struct event_type {
+    long long time;
+    int type;
+    int region;
+    int cycle;
+    int index3[3];
+    long long message;
+  };
+
+  /// Ring buffer of recorded events
+  std::vector<event_type> event_;
+
+  /// Number of events recorded
+  long long num_events_;
+
+  /// Number of events written or dropped by flush()
+  long long num_written_;
+
+  /// Whether flush() has written the file header
+  bool is_open_;
+
+  /// Number of message identifiers generated
+  long long message_count_;
+
+};
+
+#endif /* PERFORMANCE_EVENT_TRACE_HPP */
@@ -33,7 +33,8 @@ Performance::Performance (Config * config)
   papi_counters_(0),
 #endif
   warnings_(config ? config->performance_warnings : false),
-  index_region_current_(perf_unknown)
+  index_region_current_(perf_unknown),
+  event_trace_(config ? config->performance_trace_size : 0)
 {
 
   const int in = cello::index_static();
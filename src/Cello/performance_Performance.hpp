@@ -58,6 +58,7 @@ enum perf_region {
   perf_stopping,
   perf_block,
   perf_exit,
+  perf_boundary,
 #ifdef CONFIG_USE_GRACKLE
   perf_grackle,
 #endif
@@ -91,7 +92,8 @@ public: // interface
      papi_counters_(0),
 #endif
      warnings_(false),
-     index_region_current_(perf_unknown)
+     index_region_current_(perf_unknown),
+     event_trace_()
   {};
 
   /// Initialize a Performance object
@@ -125,6 +127,7 @@ public: // interface
 #endif    
     p | warnings_;
     p | index_region_current_;
+    p | event_trace_;
   }
 
   /// Begin collecting performance data
@@ -193,6 +196,14 @@ public: // interface
   bool region_started(int index_region) const throw()
   { return region_started_[index_region]; }
 
+  /// Return the per-process event trace
+  EventTrace * event_trace() throw()
+  { return &event_trace_; }
+
+  /// Append new event trace events, if active, to the given file
+  void flush_trace (std::string file_name) throw()
+  { event_trace_.flush(file_name,region_name_); }
+
 #ifdef CONFIG_USE_PAPI  
   /// Return the associated Papi object
   Papi * papi() { return &papi_; };
@@ -258,6 +269,9 @@ private: // attributes
 
   /// Last region index started
   int index_region_current_;
+
+  /// Ring buffer of Block events for critical path analysis
+  EventTrace event_trace_;
 };
 
 #endif /* PERFORMANCE_PERFORMANCE_HPP */
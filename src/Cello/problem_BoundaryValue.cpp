@@ -31,13 +31,16 @@ void BoundaryValue::enforce
 	    "Function called with ghosts not allocated");
     }
 
-    double xm,ym,zm;
-    double xp,yp,zp;
-    data -> lower(&xm,&ym,&zm);
-    data -> upper(&xp,&yp,&zp);
-
     double t = block->time();
 
+    // Expressions depending on x,y,z and t, and masked expressions,
+    // are evaluated in every ghost zone on every call
+
+    const int dependence = (mask_ == nullptr) ?
+      value_->dependence() : value_space_time;
+
+    std::vector<double> x,y,z;
+
     for (size_t index = 0; index < field_list_.size(); index++) {
 
       int nx,ny,nz;
@@ -47,16 +50,16 @@ void BoundaryValue::enforce
       int gx,gy,gz;
       field.ghost_depth(index_field,&gx,&gy,&gz);
 
-
       int ndx=nx+2*gx;
       int ndy=ny+2*gy;
       int ndz=nz+2*gz;
 
-      double * x = new double [ndx];
-      double * y = new double [ndy];
-      double * z = new double [ndz];
-
-      data->field_cells(x,y,z,gx,gy,gz);
+      if (dependence & value_space) {
+	x.resize(ndx);
+	y.resize(ndy);
+	z.resize(ndz);
+	data->field_cells(&x[0],&y[0],&z[0],gx,gy,gz);
+      }
 
       void * array = field.values(index_field);
 
@@ -78,96 +81,193 @@ void BoundaryValue::enforce
 	if (axis == axis_z) iz0 = ndz - gz;
       }
 
-      int i0=ix0 + ndx*(iy0 + ndy*iz0);
+      if (dependence == value_space_time) {
 
-      bool * mask = 0;
+	evaluate_ (array, precision, t, &x[0],&y[0],&z[0],
+		   ndx,ndy,ndz, nx,ny,nz, ix0,iy0,iz0);
 
-      if (mask_ != nullptr) mask = new bool [nx*ny*nz];
+      } else if (dependence == value_space) {
 
-      switch (precision) {
-      case precision_single:
-	{
-	  float * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (float *)array;
-	    array = new float [ndx*ndy*ndz];
-	  }
-	  
-	  value_->evaluate((float *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((float *)temp)[i]=((float *)array)[i];
-	    delete [] ((float*)array);
-	    array = temp;
-	  }
-	}
-       	break;
-      case precision_double:
-	{
-	  double * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (double *)array;
-	    array = new double [ndx*ndy*ndz];
-	  }
-	  value_->evaluate((double *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((double *)temp)[i]=((double *)array)[i];
-	    delete [] ((double *)array);
-	    array = temp;
-	  }
+	const std::vector<double> & values = face_values_
+	  (block,axis,face,index_field, t, &x[0],&y[0],&z[0],
+	   nx,ny,nz, ix0,iy0,iz0);
+
+	switch (precision) {
+	case precision_single:
+	  copy_((float *)array,&values[0],ndx,ndy,nx,ny,nz,ix0,iy0,iz0);
+	  break;
+	case precision_double:
+	  copy_((double *)array,&values[0],ndx,ndy,nx,ny,nz,ix0,iy0,iz0);
+	  break;
+	case precision_extended80:
+	case precision_extended96:
+	case precision_quadruple:
+	  copy_((long double *)array,&values[0],ndx,ndy,nx,ny,nz,ix0,iy0,iz0);
+	  break;
 	}
-       	break;
-      case precision_extended80:
-      case precision_extended96:
-      case precision_quadruple:
-	{
-	  long double * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (long double *)array;
-	    array = new long double [ndx*ndy*ndz];
-	  }
-	  value_->evaluate((long double *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) 
-	      ((long double *)temp)[i]=((long double *)array)[i];
-	    delete [] ((long double *)array);
-	    array = temp;
-	  }
+
+      } else {
+
+	// constant or time-dependent only: one evaluation for the face
+
+	const double value = value_->evaluate(t,0.0,0.0,0.0);
+
+	switch (precision) {
+	case precision_single:
+	  fill_((float *)array,value,ndx,ndy,nx,ny,nz,ix0,iy0,iz0);
+	  break;
+	case precision_double:
+	  fill_((double *)array,value,ndx,ndy,nx,ny,nz,ix0,iy0,iz0);
+	  break;
+	case precision_extended80:
+	case precision_extended96:
+	case precision_quadruple:
+	  fill_((long double *)array,value,ndx,ndy,nx,ny,nz,ix0,iy0,iz0);
+	  break;
 	}
-       	break;
       }
+    }
+  }
+}
 
-      delete [] x;
-      delete [] y;
-      delete [] z;
-      delete [] mask;
+//----------------------------------------------------------------------
+
+void BoundaryValue::evaluate_
+(void * array, precision_type precision,
+ double t, const double * x, const double * y, const double * z,
+ int ndx, int ndy, int ndz,
+ int nx,  int ny,  int nz,
+ int ix0, int iy0, int iz0) const throw ()
+{
+  int i0=ix0 + ndx*(iy0 + ndy*iz0);
+
+  double * xc = (double *) x;
+  double * yc = (double *) y;
+  double * zc = (double *) z;
+
+  switch (precision) {
+  case precision_single:
+    {
+      float * temp = 0;
+      if (mask_ != nullptr) {
+	temp = (float *)array;
+	array = new float [ndx*ndy*ndz];
+      }
+	  
+      value_->evaluate((float *)array+i0, t, 
+		       ndx,nx,xc+ix0, 
+		       ndy,ny,yc+iy0,
+		       ndz,nz,zc+iz0);
+      if (mask_ != nullptr) {
+	for (int i=0; i<ndx*ndy*ndz; i++) ((float *)temp)[i]=((float *)array)[i];
+	delete [] ((float*)array);
+	array = temp;
+      }
     }
+    break;
+  case precision_double:
+    {
+      double * temp = 0;
+      if (mask_ != nullptr) {
+	temp = (double *)array;
+	array = new double [ndx*ndy*ndz];
+      }
+      value_->evaluate((double *)array+i0, t, 
+		       ndx,nx,xc+ix0, 
+		       ndy,ny,yc+iy0,
+		       ndz,nz,zc+iz0);
+      if (mask_ != nullptr) {
+	for (int i=0; i<ndx*ndy*ndz; i++) ((double *)temp)[i]=((double *)array)[i];
+	delete [] ((double *)array);
+	array = temp;
+      }
+    }
+    break;
+  case precision_extended80:
+  case precision_extended96:
+  case precision_quadruple:
+    {
+      long double * temp = 0;
+      if (mask_ != nullptr) {
+	temp = (long double *)array;
+	array = new long double [ndx*ndy*ndz];
+      }
+      value_->evaluate((long double *)array+i0, t, 
+		       ndx,nx,xc+ix0, 
+		       ndy,ny,yc+iy0,
+		       ndz,nz,zc+iz0);
+      if (mask_ != nullptr) {
+	for (int i=0; i<ndx*ndy*ndz; i++) 
+	  ((long double *)temp)[i]=((long double *)array)[i];
+	delete [] ((long double *)array);
+	array = temp;
+      }
+    }
+    break;
   }
 }
 
 //----------------------------------------------------------------------
 
+const std::vector<double> & BoundaryValue::face_values_
+(Block * block, int axis, int face, int index_field,
+ double t, const double * x, const double * y, const double * z,
+ int nx,  int ny,  int nz,
+ int ix0, int iy0, int iz0) const throw ()
+{
+  // Entries are never invalid, but may be left over from Blocks that
+  // have since been coarsened or refined away: start over when the
+  // cache grows beyond a few faces per Block on the process
+
+  const size_t max_size = 64*cello::hierarchy()->num_blocks() + 64;
+  if (face_cache_.size() > max_size) face_cache_.clear();
+
+  int v3[3];
+  block->index().values(v3);
+  const int key_face = axis + 3*(face + 2*index_field);
+  std::vector<double> & values =
+    face_cache_[std::make_tuple(v3[0],v3[1],v3[2],key_face)];
+
+  if (values.empty()) {
+    values.resize(nx*ny*nz);
+    value_->evaluate(&values[0], t,
+		     nx,nx,(double *)x+ix0,
+		     ny,ny,(double *)y+iy0,
+		     nz,nz,(double *)z+iz0);
+  }
+  return values;
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
-void BoundaryValue::copy_(T * field, double * value,
-			  int ndx, int ndy, int ndz,
+void BoundaryValue::copy_(T * field, const double * value,
+			  int ndx, int ndy,
 			  int nx,  int ny,  int nz,
 			  int ix0, int iy0, int iz0) const throw()
 {
-  for (int ix=ix0; ix<ix0+nx; ix++) {
-    for (int iy=iy0; iy<iy0+ny; iy++) {
-      for (int iz=iz0; iz<iz0+nz; iz++) {
-	int iv = (ix-ix0) + nx*((iy-iy0) + ny*(iz-iz0));
-	int ib = ix + ndx*(iy + ndy*(iz));
-	field[ib] = (T) value[iv];
-      }
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      T * f = field + ix0 + ndx*((iy0+iy) + ndy*(iz0+iz));
+      const double * v = value + nx*(iy + ny*iz);
+      for (int ix=0; ix<nx; ix++) f[ix] = (T) v[ix];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void BoundaryValue::fill_(T * field, double value,
+			  int ndx, int ndy,
+			  int nx,  int ny,  int nz,
+			  int ix0, int iy0, int iz0) const throw()
+{
+  const T v = (T) value;
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      T * f = field + ix0 + ndx*((iy0+iy) + ndy*(iz0+iz));
+      for (int ix=0; ix<nx; ix++) f[ix] = v;
     }
   }
 }
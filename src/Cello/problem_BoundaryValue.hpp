@@ -14,6 +14,12 @@ class BoundaryValue : public Boundary
   /// @class    BoundaryValue
   /// @ingroup  Problem
   /// @brief    [\ref Problem] Encapsulate a BoundaryValue conditions generator
+  ///
+  /// Boundary values that depend on neither x,y,z nor t, or on t
+  /// only, are evaluated once per face and filled into the ghost
+  /// zones.  Values that depend on x,y,z but not t are evaluated once
+  /// per Block face and cached.  Only values that depend on both (or
+  /// that are masked) are re-evaluated in every cell on each call.
 
 public: // interface
 
@@ -25,7 +31,8 @@ public: // interface
   /// Create a new BoundaryValue
   BoundaryValue(axis_enum axis, face_enum face, Value * value, 
 		std::vector<std::string> field_list) throw() 
-    : Boundary(axis,face,0), value_(value), field_list_(field_list)
+    : Boundary(axis,face,0), value_(value), field_list_(field_list),
+      face_cache_()
   { }
 
   /// Destructor
@@ -37,7 +44,8 @@ public: // interface
   BoundaryValue(CkMigrateMessage *m)
     : Boundary (m),
       value_(NULL),
-      field_list_()
+      field_list_(),
+      face_cache_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -61,9 +69,34 @@ public: // virtual functions
 
 protected: // functions
 
+  /// Evaluate value_ at every ghost zone of the face directly in the
+  /// field array
+  void evaluate_ (void * array, precision_type precision,
+		  double t, const double * x, const double * y, const double * z,
+		  int ndx, int ndy, int ndz,
+		  int nx,  int ny,  int nz,
+		  int ix0, int iy0, int iz0) const throw ();
+
+  /// Return the cached values of value_ in the face ghost zones of
+  /// the Block, evaluating them if needed
+  const std::vector<double> & face_values_
+  (Block * block, int axis, int face, int index_field,
+   double t, const double * x, const double * y, const double * z,
+   int nx,  int ny,  int nz,
+   int ix0, int iy0, int iz0) const throw ();
+
+  /// Copy the nx*ny*nz values into the field subarray starting at
+  /// (ix0,iy0,iz0)
   template <class T>
-  void copy_(T * field, double * value,
-	     int ndx, int ndy, int ndz,
+  void copy_(T * field, const double * value,
+	     int ndx, int ndy,
+	     int nx,  int ny,  int nz,
+	     int ix0, int iy0, int iz0) const throw ();
+
+  /// Set the field subarray starting at (ix0,iy0,iz0) to value
+  template <class T>
+  void fill_(T * field, double value,
+	     int ndx, int ndy,
 	     int nx,  int ny,  int nz,
 	     int ix0, int iy0, int iz0) const throw ();
 
@@ -72,6 +105,11 @@ protected: // attributes
   Value * value_;
   std::vector<std::string> field_list_;
 
+  /// Face values of time-independent spatial expressions, indexed by
+  /// Block Index values and by axis, face, and field.  Not pup'ed.
+  mutable std::map< std::tuple<int,int,int,int>,
+		    std::vector<double> > face_cache_;
+
 };
 
 #endif /* PROBLEM_BOUNDARY_VALUE_HPP */
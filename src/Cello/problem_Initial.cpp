@@ -31,3 +31,10 @@ void Initial::pup (PUP::er &p)
 void Initial::enforce_block(Block * block, const Hierarchy * hierarchy) throw()
 {
 }
+
+//----------------------------------------------------------------------
+
+int Initial::adapt_block (const Block * block) const throw()
+{
+  return adapt_unknown;
+}
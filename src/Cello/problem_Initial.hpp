@@ -62,6 +62,12 @@ public: // virtual functions
   virtual bool expects_blocks_allocated() const throw()
   { return true; }
 
+  /// Return adapt_refine or adapt_same to override the refinement
+  /// criteria for the Block in the initial cycle, e.g. to rebuild the
+  /// mesh hierarchy of a data dump, or adapt_unknown (default) if the
+  /// initial conditions do not constrain the mesh
+  virtual int adapt_block (const Block * block) const throw();
+
 protected: // functions
 
 
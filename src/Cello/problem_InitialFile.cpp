@@ -9,6 +9,10 @@
 
 #include "problem.hpp"
 
+// Maximum number of HDF5 files kept open on each process
+
+#define MAX_FILES_OPEN 4
+
 //----------------------------------------------------------------------
 
 InitialFile::InitialFile
@@ -16,7 +20,12 @@ InitialFile::InitialFile
  int cycle, double time) throw ()
   : Initial (cycle,time),
     parameters_(parameters),
-    input_(0)
+    dir_(""),
+    block_file_(),
+    block_parent_(),
+    input_(),
+    input_order_(),
+    is_checked_(false)
 {
 }
 
@@ -24,7 +33,11 @@ InitialFile::InitialFile
 
 InitialFile::~InitialFile() throw()
 {
-  delete input_; input_ = 0;
+  std::map<std::string,Input *>::iterator it;
+  for (it = input_.begin(); it != input_.end(); ++it) {
+    delete it->second;
+  }
+  input_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -40,8 +53,6 @@ void InitialFile::pup (PUP::er &p)
   if (up) parameters_ = new Parameters;
   p | *parameters_;
 
-  p | input_; // PUP::able
-
 }
 
 //----------------------------------------------------------------------
@@ -53,35 +64,197 @@ void InitialFile::enforce_block
  ) throw()
 {
   ASSERT ("InitialFile::enforce_block",
-	  "Input block is expected to be NULL",
-	  block == 0);
+	  "Input block is expected to be non-NULL",
+	  block != NULL);
+
+  if (dir_ == "") read_block_list_(hierarchy);
+
+  const std::string block_name = block->name();
+
+  std::map<std::string,std::string>::const_iterator it_block =
+    block_file_.find(block_name);
+
+  ASSERT2 ("InitialFile::enforce_block",
+	   "Block %s is not in the block_list of data dump %s",
+	   block_name.c_str(),dir_.c_str(),
+	   it_block != block_file_.end());
+
+  Input * input = input_file_(it_block->second,hierarchy);
+
+  if (! is_checked_) check_cycle_time_(input->file(),block_name);
+
+  // Particles of non-leaf Blocks were moved to their children when
+  // refined, so are only read for leaf Blocks
+
+  const bool is_parent =
+    (block_parent_.find(block_name) != block_parent_.end());
+
+  ItIndexList * it_particle = new ItIndexList;
+  if (! is_parent) {
+    const int num_types = cello::particle_descr()->num_types();
+    for (int it=0; it<num_types; it++) it_particle->append(it);
+  }
+  input->set_it_particle_index(it_particle);
+
+  input->read_block(block,block_name);
+}
+
+//----------------------------------------------------------------------
+
+int InitialFile::adapt_block (const Block * block) const throw()
+{
+  if (dir_ == "") return adapt_unknown;
+
+  return (block_parent_.find(block->name()) != block_parent_.end()) ?
+    adapt_refine : adapt_same;
+}
+
+//----------------------------------------------------------------------
+
+void InitialFile::read_block_list_(const Hierarchy * hierarchy) throw()
+{
+  std::string              dir_name = "";
+  std::vector<std::string> dir_args;
+
+  get_filename_(&dir_name,&dir_args);
+
+  InputData input (hierarchy->factory());
+  input.set_cycle_time (cycle_,time_);
+  dir_ = input.expanded_name(dir_name,dir_args);
+
+  // Each process reads the entire list, which is small compared to
+  // the data, to determine both its Blocks' files and the hierarchy
 
-  if (! input_) 
-    input_ = new InputData (hierarchy->factory());
+  const std::string file_name = dir_ + "/" + dir_ + ".block_list";
 
-  if (! input_->is_open() ) {
+  FILE * fp = fopen (file_name.c_str(),"r");
 
-    std::string              file_name = "";
-    std::vector<std::string> file_args;
+  ASSERT1 ("InitialFile::read_block_list_",
+	   "Error opening block list file %s",
+	   file_name.c_str(),
+	   fp != NULL);
 
-    get_filename_(&file_name,&file_args);
+  char block_name[256];
+  char block_file[256];
+  int max_level = 0;
 
-    input_->open();
+  while (fscanf (fp,"%255s %255s",block_name,block_file) == 2) {
 
+    block_file_[block_name] = block_file;
+
+    // Mark all ancestors as non-leaf Blocks
+
+    int level = 0;
+    std::string name = parent_name(block_name);
+    while (name != "") {
+      ++level;
+      block_parent_.insert(name);
+      name = parent_name(name);
+    }
+    max_level = std::max(max_level,level);
   }
 
-  INCOMPLETE("InitialFile::enforce_block");
+  fclose (fp);
 
-  File * file = input_->file();
-  int num_blocks = file->group_count();
+  ASSERT1 ("InitialFile::read_block_list_",
+	   "Block list file %s is empty",
+	   file_name.c_str(),
+	   block_file_.size() > 0);
 
-  for (int i = 0; i<num_blocks; i++) {
+  if (max_level > cello::config()->mesh_max_level) {
+    WARNING3 ("InitialFile::read_block_list_",
+	      "Data dump %s has level %d Blocks but Adapt:max_level is %d",
+	      dir_.c_str(),max_level,cello::config()->mesh_max_level);
+  }
+}
 
-    std::string block_name = file->group_name(i).c_str();
+//----------------------------------------------------------------------
 
-    input_->read_block(0,block_name);
+std::string InitialFile::parent_name(const std::string & block_name) throw()
+{
+  // Block names are "B" followed by each axis' bits, separated by
+  // "_", where each axis is the root array bits followed by ":" and
+  // one child bit per level.  The parent drops the last child bit.
+
+  std::string parent = "B";
+  bool has_parent = false;
+
+  size_t i0 = 1;
+  while (i0 <= block_name.size()) {
+    size_t i1 = block_name.find("_",i0);
+    if (i1 == std::string::npos) i1 = block_name.size();
+    std::string axis = block_name.substr(i0,i1-i0);
+    const size_t ic = axis.find(":");
+    if (ic != std::string::npos) {
+      has_parent = true;
+      axis.erase(axis.size()-1);
+      if (axis.size() == ic+1) axis.erase(ic);
+    }
+    if (i0 > 1) parent = parent + "_";
+    parent = parent + axis;
+    i0 = i1 + 1;
+  }
+
+  return has_parent ? parent : "";
+}
+
+//----------------------------------------------------------------------
+
+Input * InitialFile::input_file_
+(const std::string & file_name, const Hierarchy * hierarchy) throw()
+{
+  std::map<std::string,Input *>::iterator it = input_.find(file_name);
 
+  if (it != input_.end()) return it->second;
+
+  // Close the oldest file if too many are open
+
+  if (input_order_.size() >= MAX_FILES_OPEN) {
+    const std::string oldest = input_order_.front();
+    delete input_[oldest];
+    input_.erase(oldest);
+    input_order_.erase(input_order_.begin());
+  }
+
+  Input * input = new InputData (hierarchy->factory());
+
+  input->set_filename (dir_ + "/" + file_name, std::vector<std::string>());
+  input->set_it_field_index
+    (new ItIndexRange(cello::field_descr()->field_count()));
+  input->open();
+
+  input_[file_name] = input;
+  input_order_.push_back(file_name);
+
+  return input;
+}
+
+//----------------------------------------------------------------------
+
+void InitialFile::check_cycle_time_
+(File * file, const std::string & block_name) throw()
+{
+  int    cycle = 0;
+  double time  = 0.0;
+  int type;
+
+  file->group_chdir("/" + block_name);
+  file->group_open();
+  type = type_int;
+  file->group_read_meta(&cycle,"cycle",&type);
+  type = type_double;
+  file->group_read_meta(&time,"time",&type);
+  file->group_close();
+  file->group_chdir("/");
+
+  if (cycle != cycle_ || time != time_) {
+    WARNING5 ("InitialFile::check_cycle_time_",
+	      "Data dump %s is cycle %d time %g but Initial:cycle is %d "
+	      "and Initial:time is %g",
+	      dir_.c_str(),cycle,time,cycle_,time_);
   }
+
+  is_checked_ = true;
 }
 
 //----------------------------------------------------------------------
@@ -92,14 +265,15 @@ void InitialFile::get_filename_
  std::vector<std::string> * file_args
  ) throw()
 {
-  // parameter: Initial : name
+  // parameter: Initial : file : name
 
   parameters_->group_set(0,"Initial");
+  parameters_->group_set(1,"file");
 
   if (parameters_->type("name") == parameter_string) {
 
     *file_name = parameters_->value_string("name","");
-     
+
   } else if (parameters_->type("name") == parameter_list) {
 
     int list_length = parameters_->list_length("name");
@@ -113,11 +287,11 @@ void InitialFile::get_filename_
   } else {
 
     ERROR1("InitialFile::enforce_block",
-	   "Bad type %d for 'Initial : name' parameter",
+	   "Bad type %d for 'Initial : file : name' parameter",
 	   parameters_->type("name"));
 
   }
 
-  input_->set_filename (*file_name, *file_args);
+  parameters_->group_clear();
 
 }
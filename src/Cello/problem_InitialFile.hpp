@@ -5,11 +5,14 @@
 /// @date     Tue Jan  4 19:26:38 PST 2011
 /// @brief    [\ref Problem] Declaration of the InitialFile class
 ///
-/// 
+///
 
 #ifndef METHOD_INITIAL_FILE_HPP
 #define METHOD_INITIAL_FILE_HPP
 
+class File;
+class Input;
+
 class InitialFile : public Initial {
 
   /// @class    InitialFile
@@ -17,8 +20,12 @@ class InitialFile : public Initial {
   /// @brief    [\ref Problem] Declaration of the InitialFile class
   ///
   /// This class is used to define initial conditions by reading in
-  /// data from files
-
+  /// data from files written by OutputData.  The directory's
+  /// block_list file maps Block names to HDF5 files, so each Block
+  /// reads only its own group, regardless of the number of processes
+  /// that wrote the files or the mapping of Blocks to processes.
+  /// Refined Blocks are recreated in the initial adapt phase using
+  /// the names in the block_list.
 
 public: // interface
 
@@ -26,7 +33,7 @@ public: // interface
   InitialFile() throw() { }
 
   /// Constructor
-  InitialFile(Parameters * parameters, 
+  InitialFile(Parameters * parameters,
 	      int cycle, double time) throw();
 
   /// Destructor
@@ -37,36 +44,69 @@ public: // interface
   InitialFile(CkMigrateMessage *m)
     : Initial (m),
       parameters_(NULL),
-      input_(NULL)
-    
+      dir_(""),
+      block_file_(),
+      block_parent_(),
+      input_(),
+      input_order_(),
+      is_checked_(false)
   { }
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
 
-  /// Read initialization values from Initial group in parameter file
-
   /// Enforce initial conditions for the given Block
 
   virtual void enforce_block (Block            * block,
 			      const Hierarchy  * hierarchy) throw();
 
-  /// Override default: InitialFile expects blocks not to be allocated
-  virtual bool expects_blocks_allocated() const throw()
-  { return false; }
+  /// Refine Blocks that have children in the data dump
+  virtual int adapt_block (const Block * block) const throw();
+
+  /// Return the name of the parent of the named Block, or "" for
+  /// root-level and coarser Blocks
+  static std::string parent_name(const std::string & block_name) throw();
 
 private: // functions
 
   void get_filename_(std::string * file_name,
 		     std::vector<std::string> * file_args) throw();
 
+  /// Read the directory's block_list file
+  void read_block_list_(const Hierarchy * hierarchy) throw();
+
+  /// Return an open Input object for the given file
+  Input * input_file_(const std::string & file_name,
+		      const Hierarchy * hierarchy) throw();
+
+  /// Warn if the dump cycle or time differ from the initial cycle or time
+  void check_cycle_time_(File * file, const std::string & block_name) throw();
+
 private: // attributes
 
   /// Parameters object
   Parameters * parameters_;
 
-  /// Associated Input object
-  Input * input_;
+  // NOTE: The following attributes are only used in the initial
+  // cycle, so are not pup'ed
+
+  /// Directory containing the data dump
+  std::string dir_;
+
+  /// HDF5 file containing each Block in the dump
+  std::map<std::string,std::string> block_file_;
+
+  /// Blocks in the dump that have children
+  std::set<std::string> block_parent_;
+
+  /// Open Input objects indexed by file name
+  std::map<std::string,Input *> input_;
+
+  /// Order in which files were opened, for closing the oldest
+  std::vector<std::string> input_order_;
+
+  /// Whether the cycle and time of the dump have been checked
+  bool is_checked_;
 };
 
 #endif /* METHOD_INITIAL_FILE_HPP */
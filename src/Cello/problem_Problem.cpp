@@ -394,8 +394,10 @@ void Problem::initialize_output
     //--------------------------------------------------
 
     OutputImage * output_image = dynamic_cast<OutputImage *> (output);
+    OutputProjection * output_projection =
+      dynamic_cast<OutputProjection *> (output);
 
-    if (output_image != NULL) {
+    if (output_image != NULL || output_projection != NULL) {
 
       // COLORMAP
 
@@ -418,7 +420,8 @@ void Problem::initialize_output
 
 	}
 
-	output_image->set_colormap(n,r,g,b);
+	if (output_image)      output_image->set_colormap(n,r,g,b);
+	if (output_projection) output_projection->set_colormap(n,r,g,b);
 
 	delete [] r;
 	delete [] g;
@@ -862,6 +865,7 @@ Output * Problem::create_output_
 					    config->mesh_max_level);
     bool        leaf_only        = config->output_leaf_only[index];
     std::string image_reduce_type = config->output_image_reduce_type[index];
+    int         image_reduce_arity = config->output_image_reduce_arity[index];
     std::string image_mesh_color  = config->output_image_mesh_color[index];
     std::string image_color_particle_attribute =
       config->output_image_color_particle_attribute[index];
@@ -888,6 +892,7 @@ Output * Problem::create_output_
 			      image_type,
 			      image_size_x,image_size_y,
 			      image_reduce_type,
+			      image_reduce_arity,
 			      image_mesh_color,
 			      image_color_particle_attribute,
 			      image_block_size,
@@ -904,6 +909,11 @@ Output * Problem::create_output_
     output = new OutputData (index,factory,
 			     config);
 
+  } else if (name == "projection") {
+
+    output = new OutputProjection (index,factory,
+				   config,CkNumPes());
+
   } else if (name == "checkpoint") {
 
     output = new OutputCheckpoint (index,factory,
@@ -930,6 +940,10 @@ Prolong * Problem::create_prolong_ ( std::string  name ,
 
     prolong = new ProlongInject;
 
+  } else if (name == "quadratic") {
+
+    prolong = new ProlongQuadratic;
+
   } else {
     
     ERROR1("Problem::create_prolong_",
@@ -0,0 +1,236 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_ProlongQuadratic.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of conservative limited quadratic prolongation
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// MC-limited slope across a coarse cell, in units of the coarse
+  /// cell width.  Missing neighbors are clamped to u0 by the caller,
+  /// so one of the differences is zero and the limiter gives a zero
+  /// slope, which cannot overshoot at refinement boundaries.  Sets
+  /// smooth to true only if the centered difference was used
+  /// unmodified, which is when cross terms may be safely added.
+
+  template <class T>
+  inline T slope_ (T um, T u0, T up, bool & smooth)
+  {
+    const T dl = u0 - um;
+    const T dr = up - u0;
+    const T dc  = 0.5*(dl + dr);
+    const T adc = std::abs(dc);
+    const T lim = 2.0*std::min(std::abs(dl),std::abs(dr));
+    const bool same_sign = (dl*dr > 0.0);
+    smooth = same_sign && (adc <= lim);
+    return (! same_sign) ? T(0.0)
+      : ((adc <= lim) ? dc : ((dc > 0.0) ? lim : -lim));
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+ProlongQuadratic::ProlongQuadratic() throw()
+  : Prolong ()
+{
+  TRACE("ProlongQuadratic::ProlongQuadratic");
+}
+
+//----------------------------------------------------------------------
+
+int ProlongQuadratic::apply
+( precision_type precision,
+  void *       values_f, int mf3[3], int of3[3], int nf3[3],
+  const void * values_c, int mc3[3], int oc3[3], int nc3[3],
+  bool accumulate)
+{
+  switch (precision)  {
+
+  case precision_single:
+
+    return apply_((float *)       values_f, mf3, of3, nf3,
+		  (const float *) values_c, mc3, oc3, nc3,
+		  accumulate);
+
+    break;
+
+  case precision_double:
+
+    return apply_((double *)       values_f, mf3, of3, nf3,
+		  (const double *) values_c, mc3, oc3, nc3,
+		  accumulate);
+
+    break;
+
+  default:
+
+    ERROR1 ("ProlongQuadratic::apply()",
+            "Unknown precision %d",
+            precision);
+
+    return 0;
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+int ProlongQuadratic::apply_
+(       T * values_f, int mf3[3], int of3[3], int nf3[3],
+	const T * values_c, int mc3[3], int oc3[3], int nc3[3],
+	bool accumulate)
+{
+  const int rank = (mf3[1] == 1) ? 1 : ( (mf3[2] == 1) ? 2 : 3 );
+
+  for (int i=0; i<rank; i++) {
+    const char * xyz = "xyz";
+    ASSERT3 ("ProlongQuadratic::apply_",
+             "fine array %c-axis %d must be 2 times coarse axis %d",
+             xyz[i],nf3[i],nc3[i],
+             nf3[i]==2*nc3[i] || nf3[i]==2*(nc3[i]-2));
+  }
+
+  // Cello only supports a refinement factor of 2, so kernels are
+  // specialized by rank only
+
+  if (rank == 1) {
+    if (accumulate) apply_rank_<T,1,true>  (values_f,mf3,of3,nf3,
+                                            values_c,mc3,oc3,nc3);
+    else            apply_rank_<T,1,false> (values_f,mf3,of3,nf3,
+                                            values_c,mc3,oc3,nc3);
+    return (sizeof(T) * nc3[0]);
+  } else if (rank == 2) {
+    if (accumulate) apply_rank_<T,2,true>  (values_f,mf3,of3,nf3,
+                                            values_c,mc3,oc3,nc3);
+    else            apply_rank_<T,2,false> (values_f,mf3,of3,nf3,
+                                            values_c,mc3,oc3,nc3);
+    return (sizeof(T) * nc3[0]*nc3[1]);
+  } else {
+    if (accumulate) apply_rank_<T,3,true>  (values_f,mf3,of3,nf3,
+                                            values_c,mc3,oc3,nc3);
+    else            apply_rank_<T,3,false> (values_f,mf3,of3,nf3,
+                                            values_c,mc3,oc3,nc3);
+    return (sizeof(T) * nc3[0]*nc3[1]*nc3[2]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T, int RANK, bool ACCUMULATE>
+void ProlongQuadratic::apply_rank_
+(       T * values_f, int mf3[3], int of3[3], int nf3[3],
+	const T * values_c, int mc3[3], int oc3[3], int nc3[3])
+{
+  // Loop over coarse cells covering the fine region, writing the
+  // 2^RANK child values of each.  The x loop has no data-dependent
+  // branches and is written to vectorize.
+
+  const int dcx = 1;
+  const int dcy = mc3[0];
+  const int dcz = mc3[0]*mc3[1];
+
+  const int dfx = 1;
+  const int dfy = mf3[0];
+  const int dfz = mf3[0]*mf3[1];
+
+  // coarse offset of the first coarse cell: 1 if coarse ghost cells
+  // are available, 0 if not
+
+  const int c0x = (nf3[0]==2*nc3[0]) ? 0 : 1;
+  const int c0y = (RANK >= 2 && nf3[1]!=2*nc3[1]) ? 1 : 0;
+  const int c0z = (RANK >= 3 && nf3[2]!=2*nc3[2]) ? 1 : 0;
+
+  const int ncx = nf3[0]/2;
+  const int ncy = (RANK >= 2) ? nf3[1]/2 : 1;
+  const int ncz = (RANK >= 3) ? nf3[2]/2 : 1;
+
+  for (int kz=0; kz<ncz; kz++) {
+
+    const int icz = kz + c0z;
+    const bool hmz = (RANK >= 3) && (icz > 0);
+    const bool hpz = (RANK >= 3) && (icz < nc3[2]-1);
+    const int omz = hmz ? -dcz : 0;
+    const int opz = hpz ?  dcz : 0;
+
+    for (int ky=0; ky<ncy; ky++) {
+
+      const int icy = ky + c0y;
+      const bool hmy = (RANK >= 2) && (icy > 0);
+      const bool hpy = (RANK >= 2) && (icy < nc3[1]-1);
+      const int omy = hmy ? -dcy : 0;
+      const int opy = hpy ?  dcy : 0;
+
+      const int i_c0 = (oc3[0]+c0x)
+        + mc3[0]*((oc3[1]+icy) + mc3[1]*(oc3[2]+icz));
+      const int i_f0 = of3[0]
+        + mf3[0]*((of3[1]+2*ky) + mf3[1]*(of3[2]+2*kz));
+
+      for (int kx=0; kx<ncx; kx++) {
+
+        const int icx = kx + c0x;
+        const bool hmx = (icx > 0);
+        const bool hpx = (icx < nc3[0]-1);
+        const int omx = hmx ? -dcx : 0;
+        const int opx = hpx ?  dcx : 0;
+
+        const int i_c = i_c0 + kx;
+        const int i_f = i_f0 + 2*kx;
+
+        const T u0 = values_c[i_c];
+
+        bool sx, sy = false, sz = false;
+
+        const T bx = slope_(values_c[i_c+omx],u0,values_c[i_c+opx],sx);
+        const T by = (RANK >= 2) ?
+          slope_(values_c[i_c+omy],u0,values_c[i_c+opy],sy) : T(0);
+        const T bz = (RANK >= 3) ?
+          slope_(values_c[i_c+omz],u0,values_c[i_c+opz],sz) : T(0);
+
+        // cross terms, only where both slopes are smooth
+
+        const T dxy = (RANK >= 2 && sx && sy) ? T
+          (0.25*(values_c[i_c+opx+opy] - values_c[i_c+opx+omy]
+                 - values_c[i_c+omx+opy] + values_c[i_c+omx+omy]))
+          : T(0);
+        const T dxz = (RANK >= 3 && sx && sz) ? T
+          (0.25*(values_c[i_c+opx+opz] - values_c[i_c+opx+omz]
+                 - values_c[i_c+omx+opz] + values_c[i_c+omx+omz]))
+          : T(0);
+        const T dyz = (RANK >= 3 && sy && sz) ? T
+          (0.25*(values_c[i_c+opy+opz] - values_c[i_c+opy+omz]
+                 - values_c[i_c+omy+opz] + values_c[i_c+omy+omz]))
+          : T(0);
+
+        // average of the reconstruction over each child: linear terms
+        // average to +/- b/4, cross terms to +/- d/16, and the
+        // quadratic terms to zero
+
+        const T ax = 0.25*bx, ay = 0.25*by, az = 0.25*bz;
+        const T cxy = 0.0625*dxy, cxz = 0.0625*dxz, cyz = 0.0625*dyz;
+
+        for (int jz=0; jz<((RANK>=3) ? 2 : 1); jz++) {
+          const T wz = (RANK >= 3) ? T(2*jz-1) : T(0);
+          for (int jy=0; jy<((RANK>=2) ? 2 : 1); jy++) {
+            const T wy = (RANK >= 2) ? T(2*jy-1) : T(0);
+            const T uyz = u0 + wy*ay + wz*az + wy*wz*cyz;
+            const T bxyz = ax + wy*cxy + wz*cxz;
+            const int j_f = i_f + jy*dfy + jz*dfz;
+            if (ACCUMULATE) {
+              values_f[j_f]       += uyz - bxyz;
+              values_f[j_f + dfx] += uyz + bxyz;
+            } else {
+              values_f[j_f]       = uyz - bxyz;
+              values_f[j_f + dfx] = uyz + bxyz;
+            }
+          }
+        }
+      }
+    }
+  }
+}
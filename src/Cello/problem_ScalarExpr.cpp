@@ -40,6 +40,20 @@ void ScalarExpr::copy_(const ScalarExpr & scalar_expr) throw()
 
 //----------------------------------------------------------------------
 
+int ScalarExpr::dependence () const
+{
+  if (! param_) return value_constant;
+
+  int dependence = value_constant;
+  if (param_->uses_variable('t')) dependence |= value_time;
+  if (param_->uses_variable('x') ||
+      param_->uses_variable('y') ||
+      param_->uses_variable('z')) dependence |= value_space;
+  return dependence;
+}
+
+//----------------------------------------------------------------------
+
 double ScalarExpr::evaluate (double t, double x, double y, double z, 
 			     std::shared_ptr<Mask> mask, double deflt) const
 {
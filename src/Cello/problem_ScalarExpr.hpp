@@ -70,7 +70,9 @@ public: // interface
     evaluate(value,t,ndx,nx,x,ndy,ny,y,ndz,nz,z,0,0);
   }
 
-  
+  /// Return which of t and x,y,z the expression depends on
+  int dependence () const;
+
 private: // functions
 
   void copy_(const ScalarExpr & scalar_expr) throw();
@@ -72,6 +72,18 @@ double Value::evaluate (double t, double x, double y, double z) throw ()
 
 //----------------------------------------------------------------------
 
+int Value::dependence () const throw ()
+{
+  int dependence = value_constant;
+  for (size_t index = 0; index < scalar_expr_list_.size(); index++) {
+    dependence |= (mask_list_[index] != nullptr) ?
+      value_space_time : scalar_expr_list_[index]->dependence();
+  }
+  return dependence;
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void Value::evaluate
 (T * values, double t,
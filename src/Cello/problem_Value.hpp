@@ -52,6 +52,10 @@ public: // interface
 
   double evaluate (double t, double x, double y, double z) throw ();
 
+  /// Return which of t and x,y,z the value depends on.  Masked
+  /// expressions are assumed to depend on both.
+  int dependence () const throw ();
+
 private: // functions
 
   void copy_(const Value & value) throw();
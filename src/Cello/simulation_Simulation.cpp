@@ -414,6 +414,7 @@ void Simulation::initialize_performance_() throw()
   p->new_region(perf_stopping,           "stopping");
   p->new_region(perf_block,              "block");
   p->new_region(perf_exit,               "exit");
+  p->new_region(perf_boundary,           "boundary");
 #ifdef CONFIG_USE_GRACKLE
   p->new_region(perf_grackle,            "grackle");
 #endif
@@ -871,10 +872,15 @@ void Simulation::monitor_performance()
   // 5 field_face
   // 6 particle_data
   // 7 num-particles
+  // 8 field-compress-bytes-raw
+  // 9 field-compress-bytes
+  // 10 field-compress-usec
+  // 11 coarsen-local
+  // 12 coarsen-remote
   // NL num-blocks-<L>
   // 
   
-  int n = 1 + 7 + ( 1 + hierarchy_->max_level()) + nr*nc;
+  int n = 1 + 12 + ( 1 + hierarchy_->max_level()) + nr*nc;
 
   long long * counters_region = new long long [nc];
   long long * counters_reduce = new long long [n];
@@ -883,13 +889,18 @@ void Simulation::monitor_performance()
 
   int m=0;
   counters_reduce[m++] = n; // 0
-  counters_reduce[m++] = MsgCoarsen::counter[in];     // 1
-  counters_reduce[m++] = MsgRefine::counter[in];      // 2
-  counters_reduce[m++] = MsgRefresh::counter[in];     // 3
-  counters_reduce[m++] = DataMsg::counter[in];        // 4
-  counters_reduce[m++] = FieldFace::counter[in];      // 5
-  counters_reduce[m++] = ParticleData::counter[in];   // 6
+  counters_reduce[m++] = cello::message_counters(in).msg_coarsen;     // 1
+  counters_reduce[m++] = cello::message_counters(in).msg_refine;      // 2
+  counters_reduce[m++] = cello::message_counters(in).msg_refresh;     // 3
+  counters_reduce[m++] = cello::message_counters(in).data_msg;        // 4
+  counters_reduce[m++] = cello::message_counters(in).field_face;      // 5
+  counters_reduce[m++] = cello::message_counters(in).particle_data;   // 6
   counters_reduce[m++] = hierarchy_->num_particles(); // 7
+  counters_reduce[m++] = cello::message_counters(in).compress_bytes_raw; // 8
+  counters_reduce[m++] = cello::message_counters(in).compress_bytes;     // 9
+  counters_reduce[m++] = cello::message_counters(in).compress_usec;      // 10
+  counters_reduce[m++] = cello::message_counters(in).coarsen_local;      // 11
+  counters_reduce[m++] = cello::message_counters(in).coarsen_remote;     // 12
 
   for (int i=0; i<=hierarchy_->max_level(); i++) 
     counters_reduce[m++] = hierarchy_->num_blocks(i);
@@ -920,6 +931,15 @@ void Simulation::monitor_performance()
   delete [] counters_reduce;
   delete [] counters_region;
 
+  // Append this process's new EventTrace events, if tracing is enabled
+
+  if (performance_->event_trace()->is_active()) {
+    char file_name[256];
+    snprintf (file_name,sizeof(file_name),
+              config_->performance_trace_file.c_str(),CkMyPe());
+    performance_->flush_trace(file_name);
+  }
+
 }
 
 //----------------------------------------------------------------------
@@ -939,6 +959,11 @@ void Simulation::r_monitor_performance(CkReductionMsg * msg)
   long long field_face  = counters_reduce[m++];   // 5
   long long particle_data = counters_reduce[m++]; // 6
   long long num_particles = counters_reduce[m++]; // 7
+  long long compress_bytes_raw = counters_reduce[m++]; // 8
+  long long compress_bytes     = counters_reduce[m++]; // 9
+  long long compress_usec      = counters_reduce[m++]; // 10
+  long long coarsen_local      = counters_reduce[m++]; // 11
+  long long coarsen_remote     = counters_reduce[m++]; // 12
 
   monitor()->print("Performance","counter num-msg-coarsen %ld", msg_coarsen);
   monitor()->print("Performance","counter num-msg-refine %ld", msg_refine);
@@ -946,10 +971,23 @@ void Simulation::r_monitor_performance(CkReductionMsg * msg)
   monitor()->print("Performance","counter num-data-msg %ld", data_msg);
   monitor()->print("Performance","counter num-field-face %ld", field_face);
   monitor()->print("Performance","counter num-particle-data %ld", particle_data);
+  monitor()->print("Performance","counter num-coarsen-local %ld", coarsen_local);
+  monitor()->print("Performance","counter num-coarsen-remote %ld", coarsen_remote);
 
   monitor()->print("Performance","simulation num-particles total %ld",
 		   num_particles);
 
+  if (compress_bytes_raw > 0) {
+    monitor()->print("Performance","counter field-compress-bytes-raw %ld",
+		     compress_bytes_raw);
+    monitor()->print("Performance","counter field-compress-bytes %ld",
+		     compress_bytes);
+    monitor()->print("Performance","counter field-compress-ratio %g",
+		     double(compress_bytes_raw)/compress_bytes);
+    monitor()->print("Performance","counter field-compress-usec %ld",
+		     compress_usec);
+  }
+
   // compute total blocks and leaf blocks
   int num_total_blocks = 0;
   long long num_leaf_blocks = counters_reduce[m];;
@@ -0,0 +1,148 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FieldCompress.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Unit tests for the FieldCompress class
+
+#include "main.hpp" 
+#include "test.hpp"
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+/// Compress and decompress n bytes of array, returning the compressed
+/// size or -1 if the result differs from the input
+
+template <class T>
+int round_trip (const T * array, int n, int element_size)
+{
+  std::vector<char> buffer;
+  const int n_c = FieldCompress::compress
+    ((const char *)array,n,element_size,buffer);
+
+  std::vector<char> result (n+1,0);
+  bool ok = FieldCompress::decompress
+    (&buffer[0],n_c,&result[0],n);
+
+  ok = ok && (memcmp (array,&result[0],n) == 0);
+
+  return ok ? n_c : -1;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("FieldCompress");
+
+  const int n = 16*16*4;
+
+  //--------------------------------------------------
+
+  unit_func("compress() smooth");
+
+  std::vector<double> smooth_d (n);
+  std::vector<float>  smooth_f (n);
+  for (int i=0; i<n; i++) {
+    smooth_d[i] = -1.0/(1.0 + 0.001*i);
+    smooth_f[i] = -1.0f/(1.0f + 0.001f*i);
+  }
+
+  int n_c = round_trip(&smooth_d[0],n*sizeof(double),sizeof(double));
+  unit_assert (n_c > 0);
+  unit_assert (n_c < int(0.875*n*sizeof(double)));
+
+  n_c = round_trip(&smooth_f[0],n*sizeof(float),sizeof(float));
+  unit_assert (n_c > 0);
+  unit_assert (n_c < int(0.875*n*sizeof(float)));
+
+  //--------------------------------------------------
+
+  unit_func("compress() constant");
+
+  std::vector<double> constant (n,3.25);
+  n_c = round_trip(&constant[0],n*sizeof(double),sizeof(double));
+  unit_assert (n_c > 0);
+  unit_assert (n_c < int(0.05*n*sizeof(double)));
+
+  //--------------------------------------------------
+
+  unit_func("compress() random");
+
+  std::vector<double> random (n);
+  srand(1);
+  for (int i=0; i<n; i++) random[i] = rand();
+  unit_assert (round_trip(&random[0],n*sizeof(double),sizeof(double)) > 0);
+
+  //--------------------------------------------------
+
+  unit_func("compress() partial element");
+
+  unit_assert (round_trip(&smooth_d[0],n*sizeof(double)-3,sizeof(double)) > 0);
+  unit_assert (round_trip(&smooth_d[0],7,sizeof(double)) > 0);
+  unit_assert (round_trip(&smooth_d[0],0,sizeof(double)) > 0);
+
+  //--------------------------------------------------
+
+  unit_func("compress() mixed precision");
+
+  // a double field followed by a float field, as in a face array
+  // with fields of different precisions
+
+  {
+    const int n_d = n*sizeof(double);
+    const int n_f = n*sizeof(float);
+    std::vector<char> mixed (n_d + n_f);
+    memcpy (&mixed[0],   &smooth_d[0], n_d);
+    memcpy (&mixed[n_d], &smooth_f[0], n_f);
+
+    std::vector<int> segment_bytes (2), element_size (2);
+    segment_bytes[0] = n_d; element_size[0] = sizeof(double);
+    segment_bytes[1] = n_f; element_size[1] = sizeof(float);
+
+    std::vector<char> buffer;
+    const int n_m = FieldCompress::compress
+      (&mixed[0], n_d + n_f, segment_bytes, element_size, buffer);
+
+    std::vector<char> result (n_d + n_f);
+    unit_assert (FieldCompress::decompress
+                 (&buffer[0],n_m,&result[0],n_d + n_f));
+    unit_assert (result == mixed);
+
+    // shuffling each field with its own element size compresses
+    // better than shuffling with the first field's
+
+    std::vector<char> buffer_first;
+    const int n_first = FieldCompress::compress
+      (&mixed[0], n_d + n_f, sizeof(double), buffer_first);
+    unit_assert (n_m < n_first);
+  }
+
+  //--------------------------------------------------
+
+  unit_func("decompress() corrupt");
+
+  std::vector<char> buffer;
+  n_c = FieldCompress::compress
+    ((const char *)&smooth_d[0],n*sizeof(double),sizeof(double),buffer);
+  std::vector<char> result (n*sizeof(double));
+  unit_assert (! FieldCompress::decompress
+	       (&buffer[0],n_c/2,&result[0],n*sizeof(double)));
+  unit_assert (! FieldCompress::decompress
+	       (&buffer[0],n_c,&result[0],n*sizeof(double)-8));
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
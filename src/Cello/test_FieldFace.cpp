@@ -9,6 +9,7 @@
 #include "test.hpp"
 
 #include "data.hpp"
+#include "performance.hpp"
 
 //----------------------------------------------------------------------
 
@@ -392,6 +393,87 @@ PARALLEL_MAIN_BEGIN
   unit_func("face_to_array / array_to_face");
   unit_assert(test_fields(field_descr,field_data,nbx,nby,nbz,mx,my,mz));
 
+  //----------------------------------------------------------------------
+  // Ghost pack / unpack throughput
+  //----------------------------------------------------------------------
+
+  const int num_sizes = 3;
+  const int block_size[num_sizes] = {8, 16, 32};
+  const int num_repeat = 20;
+
+  for (int is=0; is<num_sizes; is++) {
+
+    const int mb = block_size[is];
+
+    FieldData data_src (field_descr, mb,mb,mb);
+    FieldData data_dst (field_descr, mb,mb,mb);
+    data_src.allocate_permanent(field_descr,true);
+    data_dst.allocate_permanent(field_descr,true);
+
+    Field field_src (field_descr,&data_src);
+    Field field_dst (field_descr,&data_dst);
+
+    std::vector<int> field_list;
+    field_list.push_back(0);
+    field_list.push_back(1);
+    field_list.push_back(2);
+
+    Refresh refresh;
+    refresh.set_field_list(field_list);
+
+    long plan_count = 0;
+    long long bytes = 0;
+
+    Timer timer;
+    timer.start();
+
+    for (int ir=0; ir<num_repeat; ir++) {
+
+      // after the first repeat all copy plans should be reused
+
+      if (ir == 1) plan_count = cello::message_counters().field_face_plan;
+
+      for (int axis=0; axis<3; axis++) {
+	for (int face=-1; face<=1; face+=2) {
+
+	  int f3[3] = {0,0,0};
+	  f3[axis] = face;
+
+	  FieldFace face_src (field_src);
+	  face_src.set_refresh_type(refresh_same);
+	  face_src.set_ghost(true,true,true);
+	  face_src.set_face(f3[0],f3[1],f3[2]);
+	  face_src.set_refresh(&refresh,false);
+
+	  FieldFace face_dst (field_dst);
+	  face_dst.set_refresh_type(refresh_same);
+	  face_dst.set_ghost(true,true,true);
+	  face_dst.set_face(-f3[0],-f3[1],-f3[2]);
+	  face_dst.set_refresh(&refresh,false);
+
+	  int n;
+	  char * array;
+
+	  face_src.face_to_array (field_src, &n, &array);
+	  face_dst.array_to_face (array,field_dst);
+	  bytes += 2*n;
+
+	  delete [] array;
+	}
+      }
+    }
+
+    const double time = timer.value();
+
+    unit_func("plan reuse");
+    unit_assert (cello::message_counters().field_face_plan == plan_count);
+
+    printf ("FieldFace pack/unpack %2d^3 block: %lld bytes in %f s",
+	    mb,bytes,time);
+    if (time > 0.0) printf (" (%f MB/s)",1e-6*bytes/time);
+    printf ("\n");
+  }
+
   //----------------------------------------------------------------------	
   // clean up
   //----------------------------------------------------------------------	
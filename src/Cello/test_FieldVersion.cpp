@@ -0,0 +1,133 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FieldVersion.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test program for the FieldVersion class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "mesh.hpp"
+
+const int n = 8;
+
+// Number of times pressure has been computed
+
+int num_computed = 0;
+
+//----------------------------------------------------------------------
+
+/// Compute pressure from density and specific energy the way a derived
+/// field is computed into its permanent field: skip if current,
+/// otherwise compute and mark as current
+
+void compute_pressure (FieldVersion & field_version, double gamma,
+		       double * p, const double * d, const double * e)
+{
+  const std::vector<double> param = { gamma };
+  if (field_version.is_current("pressure",0,param)) return;
+  for (int i=0; i<n; i++) p[i] = (gamma - 1.0)*d[i]*e[i];
+  ++num_computed;
+  field_version.set_current("pressure",0,param);
+}
+
+//----------------------------------------------------------------------
+
+/// Return whether the pressure matches its value computed directly
+
+bool is_pressure (double gamma,
+		  const double * p, const double * d, const double * e)
+{
+  bool match = true;
+  for (int i=0; i<n; i++) match = match && (p[i] == (gamma - 1.0)*d[i]*e[i]);
+  return match;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("FieldVersion");
+
+  double d[n], e[n], p[n];
+  for (int i=0; i<n; i++) {
+    d[i] = 1.0 + 0.5*i;
+    e[i] = 2.0 + 0.25*i;
+    p[i] = -1.0;
+  }
+
+  FieldVersion field_version;
+
+  //--------------------------------------------------
+
+  unit_func("modified()");
+
+  unit_assert (field_version.version() == 0);
+  unit_assert (! field_version.is_current("pressure",0,{1.4}));
+  field_version.modified();
+  unit_assert (field_version.version() == 1);
+
+  //--------------------------------------------------
+
+  unit_func("is_current()");
+
+  // A Method begins (Block::compute_continue_() calls field_modified())
+  // and computes pressure
+
+  field_version.modified();
+  compute_pressure (field_version, 1.4, p,d,e);
+  unit_assert (num_computed == 1);
+  unit_assert (is_pressure (1.4, p,d,e));
+
+  // Computing it again in the same Method reuses it
+
+  compute_pressure (field_version, 1.4, p,d,e);
+#ifdef DEBUG_DERIVED_CACHE
+  unit_assert (num_computed == 2);
+#else
+  unit_assert (num_computed == 1);
+#endif
+  unit_assert (is_pressure (1.4, p,d,e));
+
+  // Different compute parameters or history are not current
+
+  unit_assert (! field_version.is_current("pressure",0,{5.0/3.0}));
+  unit_assert (! field_version.is_current("pressure",1,{1.4}));
+  unit_assert (! field_version.is_current("temperature",0,{1.4}));
+
+  //--------------------------------------------------
+
+  unit_func("modified() within Method");
+
+  // The Method modifies a field and then recomputes pressure: after
+  // modified() the new energy must be used
+
+  num_computed = 0;
+  for (int i=0; i<n; i++) e[i] *= 3.0;
+  field_version.modified();
+  unit_assert (! field_version.is_current("pressure",0,{1.4}));
+  compute_pressure (field_version, 1.4, p,d,e);
+  unit_assert (num_computed == 1);
+  unit_assert (is_pressure (1.4, p,d,e));
+
+  // Recomputing with a different gamma in the same Method is not
+  // reused either
+
+  compute_pressure (field_version, 5.0/3.0, p,d,e);
+  unit_assert (num_computed == 2);
+  unit_assert (is_pressure (5.0/3.0, p,d,e));
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,85 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_InitialFile.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test program for the InitialFile class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "problem.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("InitialFile");
+
+  //--------------------------------------------------
+
+  unit_func("parent_name() root");
+
+  // Root-level Blocks have no child bits, and so no parent
+
+  unit_assert (InitialFile::parent_name("B01")        == "");
+  unit_assert (InitialFile::parent_name("B01_10")     == "");
+  unit_assert (InitialFile::parent_name("B1_0_1")     == "");
+
+  // Root array of a single Block along each axis has no array bits
+
+  unit_assert (InitialFile::parent_name("B")          == "");
+  unit_assert (InitialFile::parent_name("B_")         == "");
+
+  //--------------------------------------------------
+
+  unit_func("parent_name() negative levels");
+
+  // Blocks coarser than the root level have fewer array bits and no
+  // child bits, so are not refined from the data dump
+
+  unit_assert (InitialFile::parent_name("B0")         == "");
+  unit_assert (InitialFile::parent_name("B0_1")       == "");
+
+  //--------------------------------------------------
+
+  unit_func("parent_name() level 1");
+
+  unit_assert (InitialFile::parent_name("B01:1")           == "B01");
+  unit_assert (InitialFile::parent_name("B01:1_10:0")      == "B01_10");
+  unit_assert (InitialFile::parent_name("B1:0_0:1_1:1")    == "B1_0_1");
+  unit_assert (InitialFile::parent_name("B:1")             == "B");
+  unit_assert (InitialFile::parent_name("B:1_:0")          == "B_");
+
+  //--------------------------------------------------
+
+  unit_func("parent_name() deep levels");
+
+  unit_assert (InitialFile::parent_name("B01:101_10:011")  == "B01:10_10:01");
+  unit_assert (InitialFile::parent_name("B1:01_0:11_1:00") == "B1:0_0:1_1:0");
+  unit_assert (InitialFile::parent_name("B:10_:01")        == "B:1_:0");
+
+  // Walking up from a level 6 Block reaches its root Block after
+  // exactly six steps
+
+  std::string name = "B10:110010_01:011101";
+  int level = 0;
+  std::string root = name;
+  while ((name = InitialFile::parent_name(name)) != "") {
+    root = name;
+    ++level;
+  }
+  unit_assert (level == 6);
+  unit_assert (root == "B10_01");
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
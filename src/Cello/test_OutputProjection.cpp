@@ -0,0 +1,138 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_OutputProjection.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test program for the OutputProjection block reduction
+
+#include "main.hpp"
+#include "test.hpp"
+#include <math.h>
+
+#include "io.hpp"
+
+// Block size, including one ghost zone along x and y that must not
+// be reduced
+
+const int mx = 6, my = 5, mz = 3;
+const int nx = 4, ny = 3, nz = 3;
+const int gx = 1, gy = 1, gz = 0;
+
+double value (int ix, int iy, int iz)
+{ return sin(1.0 + ix + 3.0*iy + 7.0*iz) + 0.1*ix*iy; }
+
+float weight (int ix, int iy, int iz)
+{ return 1.0f + ix + 0.5f*iy + 0.25f*iz; }
+
+//----------------------------------------------------------------------
+
+/// Reduce the field along axis using OutputProjection::reduce_block()
+/// and compare with a direct reduction; return whether they agree
+
+bool test_reduce (int op, int axis, bool weighted, double dz)
+{
+  const int n3[3] = {nx,ny,nz};
+  const int df3[3] = {1, mx, mx*my};
+  const int dw3[3] = {1, mx, mx*my};
+
+  std::vector<double> f (mx*my*mz, 1e30);
+  std::vector<float>  w (mx*my*mz, 1e30f);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+	f[i] = value(ix,iy,iz);
+	w[i] = weight(ix,iy,iz);
+      }
+    }
+  }
+
+  // plane in field memory order of the remaining axes
+
+  const int a0 = (axis == 0) ? 1 : 0;
+  const int a1 = (axis == 2) ? 1 : 2;
+  int ds3[3];
+  ds3[axis] = 0;
+  ds3[a0] = 1;
+  ds3[a1] = n3[a0];
+  const int np = n3[a0]*n3[a1];
+
+  const double max = std::numeric_limits<double>::max();
+  const double value0 =
+    (op == reduce_min) ? max : ((op == reduce_max) ? -max : 0.0);
+
+  std::vector<double> pv (np,value0), pw (np,0.0);
+  std::vector<double> ev (np,value0), ew (np,0.0);
+
+  const int i0 = gx + mx*(gy + my*gz);
+  OutputProjection::reduce_block
+    (op, &f[i0], weighted ? &w[i0] : (const float *) NULL,
+     n3,df3,dw3,ds3,dz,&pv[0],&pw[0]);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	const int ip = ix*ds3[0] + iy*ds3[1] + iz*ds3[2];
+	const double v = value(ix,iy,iz);
+	const double a = dz*(weighted ? weight(ix,iy,iz) : 1.0f);
+	if (op == reduce_min) ev[ip] = std::min(ev[ip],v);
+	if (op == reduce_max) ev[ip] = std::max(ev[ip],v);
+	if (op == reduce_sum) ev[ip] += dz*v;
+	if (op == reduce_avg) { ev[ip] += a*v; ew[ip] += a; }
+      }
+    }
+  }
+
+  bool match = true;
+  for (int ip=0; ip<np; ip++) {
+    match = match && (fabs(pv[ip] - ev[ip]) <= 1e-12*(1.0+fabs(ev[ip])));
+    if (op == reduce_avg) {
+      match = match && (fabs(pw[ip] - ew[ip]) <= 1e-12*(1.0+fabs(ew[ip])));
+    }
+  }
+  return match;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("OutputProjection");
+
+  const char * axis_name[3] = {"x","y","z"};
+  char buffer[40+1];
+
+  for (int axis=0; axis<3; axis++) {
+
+    snprintf (buffer,40,"reduce_block() min %s",axis_name[axis]);
+    unit_func (buffer);
+    unit_assert (test_reduce (reduce_min, axis, false, 1.0));
+
+    snprintf (buffer,40,"reduce_block() max %s",axis_name[axis]);
+    unit_func (buffer);
+    unit_assert (test_reduce (reduce_max, axis, false, 1.0));
+
+    snprintf (buffer,40,"reduce_block() sum %s",axis_name[axis]);
+    unit_func (buffer);
+    unit_assert (test_reduce (reduce_sum, axis, false, 0.25));
+
+    snprintf (buffer,40,"reduce_block() avg %s",axis_name[axis]);
+    unit_func (buffer);
+    unit_assert (test_reduce (reduce_avg, axis, false, 0.25));
+
+    snprintf (buffer,40,"reduce_block() weighted avg %s",axis_name[axis]);
+    unit_func (buffer);
+    unit_assert (test_reduce (reduce_avg, axis, true, 0.25));
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -1051,6 +1051,27 @@ PARALLEL_MAIN_BEGIN
   delete [] buffer;
   // printf ("error_gather_int %d\n",error_gather_int);
 
+  //--------------------------------------------------
+  // splice()
+  //--------------------------------------------------
+
+  unit_func("splice()");
+  ParticleData splice_p_data;
+  splice_p_data.allocate(particle_descr);
+  Particle splice_p (particle_descr,&splice_p_data);
+
+  // move batches into empty destination
+  const int np_splice = new_p.num_particles(it_dark);
+  unit_assert (splice_p.splice(it_dark,&new_p_data) == np_splice);
+  unit_assert (splice_p.num_particles(it_dark) == np_splice);
+  unit_assert (new_p.num_particles(it_dark) == 0);
+  unit_assert (new_p.num_batches(it_dark) == 0);
+
+  // copy into non-empty destination
+  unit_assert (splice_p.splice(it_dark,&pd_dst) == count_total);
+  unit_assert (splice_p.num_particles(it_dark) == np_splice + count_total);
+  unit_assert (p_dst.num_particles(it_dark) == 0);
+
   //--------------------------------------------------
   //   Grouping
   //--------------------------------------------------
@@ -0,0 +1,234 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ProlongQuadratic.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test program for the ProlongQuadratic class
+
+#include "main.hpp"
+#include "test.hpp"
+#include <math.h>
+#include "mesh.hpp"
+
+// Cell average of 0.5*x^2 + 0.25*x*y + 0.125*y*z + 0.75*z + 2 over
+// [x0,x1] x [y0,y1] x [z0,z1].  Its coarse cell averages are
+// monotone on the test domain, so the limiter is inactive and fine
+// cell averages should be reproduced exactly.
+
+double fun_avg (double x0, double x1,
+                double y0, double y1,
+                double z0, double z1)
+{
+  const double xm = 0.5*(x0+x1);
+  const double ym = 0.5*(y0+y1);
+  const double zm = 0.5*(z0+z1);
+  return 0.5*(x0*x0 + x0*x1 + x1*x1)/3.0
+    + 0.25*xm*ym + 0.125*ym*zm + 0.75*zm + 2.0;
+}
+
+// Coarse cell i covers [2i,2i+2] + 8 along each axis, fine cell i
+// covers [i,i+1] + 8, so that coarse cell 0 is the first cell of the
+// fine region when coarse ghosts are not used
+
+double x_c(int i) { return 2.0*i + 8.0; }
+double x_f(int i) { return 1.0*i + 8.0; }
+
+// Coordinate along an axis that is only active for rank >= r
+
+double coord(int rank, int r, double x) { return (rank >= r) ? x : 0.0; }
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ProlongQuadratic");
+
+  ProlongQuadratic * prolong = new ProlongQuadratic;
+
+  unit_assert (prolong != NULL);
+
+  unit_assert (prolong->name() == "quadratic");
+
+  int m3_f[3],n3_f[3],i3_f[3];
+  int m3_c[3],n3_c[3],i3_c[3];
+
+  //--------------------------------------------------
+
+  for (int rank=1; rank<=3; rank++) {
+    for (int g=0; g<2; g++) {
+
+      char buffer[40+1];
+      snprintf (buffer,40,"apply() %dD (%d)",rank,g);
+      unit_func (buffer);
+
+      // coarse ghosts along every axis if g == 1
+
+      for (int axis=0; axis<3; axis++) {
+        const bool active = axis < rank;
+        m3_f[axis] = active ? 14 + axis : 1;
+        m3_c[axis] = active ? 11 + axis : 1;
+        i3_f[axis] = active ? 2 : 0;
+        i3_c[axis] = active ? 2 - g : 0;
+        n3_f[axis] = active ? 8 : 1;
+        n3_c[axis] = active ? 4 + 2*g : 1;
+      }
+
+      const int m_c = m3_c[0]*m3_c[1]*m3_c[2];
+      const int m_f = m3_f[0]*m3_f[1]*m3_f[2];
+      double * v_c = new double [m_c];
+      double * v_f = new double [m_f];
+
+      std::fill_n(v_c,m_c,0.0);
+      std::fill_n(v_f,m_f,0.0);
+
+      for (int iz=0; iz<n3_c[2]; iz++) {
+        const int jz = (rank >= 3) ? iz - g : 0;
+        for (int iy=0; iy<n3_c[1]; iy++) {
+          const int jy = (rank >= 2) ? iy - g : 0;
+          for (int ix=0; ix<n3_c[0]; ix++) {
+            const int jx = ix - g;
+            int i = (ix+i3_c[0]) + m3_c[0]*
+              ((iy+i3_c[1]) + m3_c[1]*(iz+i3_c[2]));
+            v_c[i] = fun_avg (x_c(jx),x_c(jx+1),
+                              coord(rank,2,x_c(jy)),coord(rank,2,x_c(jy+1)),
+                              coord(rank,3,x_c(jz)),coord(rank,3,x_c(jz+1)));
+          }
+        }
+      }
+
+      prolong->apply (precision_double,
+                      v_f, m3_f, i3_f, n3_f,
+                      v_c, m3_c, i3_c, n3_c);
+
+      // exact in the interior, where centered slopes are used; with
+      // coarse ghosts this is every fine cell
+
+      bool exact = true;
+      for (int iz=0; iz<n3_f[2]; iz++) {
+        const bool in_z = (rank < 3) || g==1 || (iz>1 && iz<n3_f[2]-2);
+        for (int iy=0; iy<n3_f[1]; iy++) {
+          const bool in_y = (rank < 2) || g==1 || (iy>1 && iy<n3_f[1]-2);
+          for (int ix=0; ix<n3_f[0]; ix++) {
+            const bool in_x = g==1 || (ix>1 && ix<n3_f[0]-2);
+            if (in_x && in_y && in_z) {
+              int i = (ix+i3_f[0]) + m3_f[0]*
+                ((iy+i3_f[1]) + m3_f[1]*(iz+i3_f[2]));
+              const int jy = (rank >= 2) ? iy : 0;
+              const int jz = (rank >= 3) ? iz : 0;
+              const double f = fun_avg
+                (x_f(ix),x_f(ix+1),
+                 coord(rank,2,x_f(jy)),coord(rank,2,x_f(jy+1)),
+                 coord(rank,3,x_f(jz)),coord(rank,3,x_f(jz+1)));
+              exact = exact && (fabs(v_f[i] - f) < 1e-12*fabs(f));
+            }
+          }
+        }
+      }
+      unit_assert (exact);
+
+      // conservative everywhere: children average to the parent
+
+      bool conserved = true;
+      const int nx = 2;
+      const int ny = (rank >= 2) ? 2 : 1;
+      const int nz = (rank >= 3) ? 2 : 1;
+      for (int kz=0; kz<n3_f[2]/nz; kz++) {
+        for (int ky=0; ky<n3_f[1]/ny; ky++) {
+          for (int kx=0; kx<n3_f[0]/nx; kx++) {
+            double sum = 0.0;
+            for (int jz=0; jz<nz; jz++) {
+              for (int jy=0; jy<ny; jy++) {
+                for (int jx=0; jx<nx; jx++) {
+                  sum += v_f[(nx*kx+jx+i3_f[0]) + m3_f[0]*
+                             ((ny*ky+jy+i3_f[1]) +
+                              m3_f[1]*(nz*kz+jz+i3_f[2]))];
+                }
+              }
+            }
+            const int gy = (rank >= 2) ? g : 0;
+            const int gz = (rank >= 3) ? g : 0;
+            const double u = v_c[(kx+g+i3_c[0]) + m3_c[0]*
+                                 ((ky+gy+i3_c[1]) +
+                                  m3_c[1]*(kz+gz+i3_c[2]))];
+            conserved = conserved &&
+              (fabs(sum/(nx*ny*nz) - u) < 1e-12*fabs(u));
+          }
+        }
+      }
+      unit_assert (conserved);
+
+      delete [] v_c;
+      delete [] v_f;
+    }
+  }
+
+  //--------------------------------------------------
+
+  unit_func ("apply() limited");
+
+  {
+    // a step in 1D must not produce new extrema
+
+    m3_f[0] = 12; m3_f[1] = 1; m3_f[2] = 1;
+    m3_c[0] = 8;  m3_c[1] = 1; m3_c[2] = 1;
+    i3_f[0] = 2;  i3_f[1] = 0; i3_f[2] = 0;
+    i3_c[0] = 1;  i3_c[1] = 0; i3_c[2] = 0;
+    n3_f[0] = 8;  n3_f[1] = 1; n3_f[2] = 1;
+    n3_c[0] = 6;  n3_c[1] = 1; n3_c[2] = 1;
+
+    double v_c[8] = { 0.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0 };
+    double v_f[12];
+    std::fill_n(v_f,12,0.5);
+
+    prolong->apply (precision_double,
+                    v_f, m3_f, i3_f, n3_f,
+                    v_c, m3_c, i3_c, n3_c);
+
+    bool bounded = true;
+    for (int ix=i3_f[0]; ix<i3_f[0]+n3_f[0]; ix++) {
+      bounded = bounded && (0.0 <= v_f[ix] && v_f[ix] <= 1.0);
+    }
+    unit_assert (bounded);
+  }
+
+  unit_func ("apply() limited boundary");
+
+  {
+    // an extremum at the edge of the coarse region, where only one
+    // neighbor exists, must not overshoot either
+
+    m3_f[0] = 8;  m3_f[1] = 1; m3_f[2] = 1;
+    m3_c[0] = 4;  m3_c[1] = 1; m3_c[2] = 1;
+    i3_f[0] = 0;  i3_f[1] = 0; i3_f[2] = 0;
+    i3_c[0] = 0;  i3_c[1] = 0; i3_c[2] = 0;
+    n3_f[0] = 8;  n3_f[1] = 1; n3_f[2] = 1;
+    n3_c[0] = 4;  n3_c[1] = 1; n3_c[2] = 1;
+
+    double v_c[4] = { 1.0, 0.0, 0.0, 1.0 };
+    double v_f[8];
+    std::fill_n(v_f,8,0.5);
+
+    prolong->apply (precision_double,
+                    v_f, m3_f, i3_f, n3_f,
+                    v_c, m3_c, i3_c, n3_c);
+
+    bool bounded = true;
+    for (int ix=0; ix<8; ix++) {
+      bounded = bounded && (0.0 <= v_f[ix] && v_f[ix] <= 1.0);
+    }
+    unit_assert (bounded);
+  }
+
+  //--------------------------------------------------
+
+  delete prolong;
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
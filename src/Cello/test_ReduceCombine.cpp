@@ -0,0 +1,219 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ReduceCombine.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test program for the ReduceCombine class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "charm.hpp"
+
+//----------------------------------------------------------------------
+
+/// Pack the records of the given ReduceCombine into a buffer
+std::vector<char> pack (const ReduceCombine & reduce)
+{
+  std::vector<char> buffer (reduce.data_size());
+  if (buffer.size() > 0) reduce.save_data(&buffer[0]);
+  return buffer;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ReduceCombine");
+
+  long double value;
+
+  //--------------------------------------------------
+
+  unit_func("key()");
+
+  unit_assert (ReduceCombine::key("dt") == ReduceCombine::key("dt"));
+  unit_assert (ReduceCombine::key("dt") != ReduceCombine::key("stop"));
+  unit_assert (ReduceCombine::key("dt") >= 0);
+  unit_assert (ReduceCombine::key("") >= 0);
+
+  // Distinct names used on a process have distinct keys; key()
+  // asserts this itself, so only the keys returned are checked here
+
+  std::set<int> keys;
+  char name[20+1];
+  for (int i=0; i<1000; i++) {
+    snprintf (name,20,"value:%d",i);
+    keys.insert (ReduceCombine::key(name));
+    unit_assert (ReduceCombine::key(name) == ReduceCombine::key(name));
+  }
+  unit_assert (keys.size() == 1000);
+
+  //--------------------------------------------------
+
+  unit_func("combine()");
+
+  unit_assert (ReduceCombine::combine(reduce_min, 2.0, -3.0) == -3.0);
+  unit_assert (ReduceCombine::combine(reduce_max, 2.0, -3.0) ==  2.0);
+  unit_assert (ReduceCombine::combine(reduce_sum, 2.0, -3.0) == -1.0);
+
+  //--------------------------------------------------
+
+  unit_func("deposit()");
+
+  ReduceCombine reduce;
+
+  unit_assert (reduce.num_values() == 0);
+  unit_assert (reduce.data_size() == 0);
+
+  reduce.deposit ("min", reduce_min, 5.0);
+  reduce.deposit ("min", reduce_min, -1.5);
+  reduce.deposit ("min", reduce_min, 3.0);
+
+  reduce.deposit ("max", reduce_max, 5.0);
+  reduce.deposit ("max", reduce_max, -1.5);
+  reduce.deposit ("max", reduce_max, 7.0);
+
+  reduce.deposit ("sum", reduce_sum, 1.0);
+  reduce.deposit ("sum", reduce_sum, 2.0);
+  reduce.deposit ("sum", reduce_sum, 0.25);
+
+  unit_assert (reduce.num_values() == 3);
+  unit_assert (reduce.data_size() ==
+	       3*int(sizeof(ReduceCombine::record_type)));
+
+  unit_func("value()");
+
+  unit_assert (reduce.value("min",&value) && value == -1.5);
+  unit_assert (reduce.value("max",&value) && value ==  7.0);
+  unit_assert (reduce.value("sum",&value) && value ==  3.25);
+  unit_assert (reduce.value("sum",NULL));
+
+  value = 42.0;
+  unit_assert (! reduce.value("missing",&value));
+  unit_assert (value == 42.0);
+
+  //--------------------------------------------------
+
+  unit_func("save_data()");
+
+  std::vector<char> buffer = pack(reduce);
+
+  const ReduceCombine::record_type * records =
+    (const ReduceCombine::record_type *) &buffer[0];
+
+  unit_assert (records[0].key < records[1].key);
+  unit_assert (records[1].key < records[2].key);
+
+  bool found_sum = false;
+  for (int i=0; i<3; i++) {
+    if (records[i].key == ReduceCombine::key("sum")) {
+      found_sum = (records[i].op == reduce_sum && records[i].value == 3.25);
+    }
+  }
+  unit_assert (found_sum);
+
+  unit_func("load_data()");
+
+  ReduceCombine copy;
+  copy.deposit ("stale", reduce_sum, 1.0);
+  copy.load_data (&buffer[0], buffer.size());
+
+  unit_assert (copy.num_values() == 3);
+  unit_assert (! copy.value("stale",&value));
+  unit_assert (copy.value("min",&value) && value == -1.5);
+  unit_assert (copy.value("max",&value) && value ==  7.0);
+  unit_assert (copy.value("sum",&value) && value ==  3.25);
+  unit_assert (pack(copy) == buffer);
+
+  copy.load_data (NULL, 0);
+  unit_assert (copy.num_values() == 0);
+
+  //--------------------------------------------------
+
+  unit_func("merge()");
+
+  // Disjoint keys: all records are kept
+
+  ReduceCombine block_a, block_b;
+  block_a.deposit ("dt",   reduce_min, 0.5);
+  block_b.deposit ("stop", reduce_min, 1.0);
+
+  ReduceCombine merged;
+  std::vector<char> buffer_a = pack(block_a);
+  std::vector<char> buffer_b = pack(block_b);
+  unit_assert (merged.merge (&buffer_a[0], buffer_a.size()));
+  unit_assert (merged.merge (&buffer_b[0], buffer_b.size()));
+
+  unit_assert (merged.num_values() == 2);
+  unit_assert (merged.value("dt",&value)   && value == 0.5);
+  unit_assert (merged.value("stop",&value) && value == 1.0);
+
+  // Overlapping keys: matching keys are combined, others kept
+
+  ReduceCombine block_c;
+  block_c.deposit ("dt",   reduce_min, 0.25);
+  block_c.deposit ("mass", reduce_sum, 2.0);
+  block_c.deposit ("vmax", reduce_max, 3.0);
+  std::vector<char> buffer_c = pack(block_c);
+  unit_assert (merged.merge (&buffer_c[0], buffer_c.size()));
+
+  ReduceCombine block_d;
+  block_d.deposit ("dt",   reduce_min, 0.75);
+  block_d.deposit ("mass", reduce_sum, 1.5);
+  block_d.deposit ("vmax", reduce_max, 4.0);
+  std::vector<char> buffer_d = pack(block_d);
+  unit_assert (merged.merge (&buffer_d[0], buffer_d.size()));
+
+  unit_assert (merged.num_values() == 4);
+  unit_assert (merged.value("dt",&value)   && value == 0.25);
+  unit_assert (merged.value("stop",&value) && value == 1.0);
+  unit_assert (merged.value("mass",&value) && value == 3.5);
+  unit_assert (merged.value("vmax",&value) && value == 4.0);
+
+  // Empty contributions leave the result unchanged
+
+  std::vector<char> merged_buffer = pack(merged);
+  unit_assert (merged.merge (NULL, 0));
+  unit_assert (pack(merged) == merged_buffer);
+
+  // Merging is independent of the order of contributions
+
+  ReduceCombine reversed;
+  unit_assert (reversed.merge (&buffer_d[0], buffer_d.size()));
+  unit_assert (reversed.merge (&buffer_c[0], buffer_c.size()));
+  unit_assert (reversed.merge (&buffer_b[0], buffer_b.size()));
+  unit_assert (reversed.merge (&buffer_a[0], buffer_a.size()));
+  unit_assert (pack(reversed) == merged_buffer);
+
+  // Mismatched operations for the same key are reported, which
+  // r_reduce_combine() asserts against
+
+  ReduceCombine block_e;
+  block_e.deposit ("dt", reduce_max, 0.1);
+  std::vector<char> buffer_e = pack(block_e);
+  unit_assert (! merged.merge (&buffer_e[0], buffer_e.size()));
+  unit_assert (merged.value("dt",&value) && value == 0.25);
+
+  //--------------------------------------------------
+
+  unit_func("clear()");
+
+  merged.clear();
+  unit_assert (merged.num_values() == 0);
+  unit_assert (merged.data_size() == 0);
+  unit_assert (! merged.value("dt",&value));
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -32,6 +32,10 @@
 #define MASK3_STR1  "\"input/testValue.png\""
 #define EXPR3_VAL2  (1.0 - t - 10.0*x - 100.0*y - 1000.0*z)
 #define EXPR3_STR2 "(1.0 - t - 10.0*x - 100.0*y - 1000.0*z)"
+
+#define EXPR4_STR "2.5"
+#define EXPR5_STR "(1.0 + 2.0*t)"
+#define EXPR6_STR "(x*y - z)"
 //----------------------------------------------------------------------
 
 void generate_input()
@@ -49,6 +53,9 @@ void generate_input()
   fp << "    value1 = [" EXPR1_STR "];  \n";
   fp << "    value2 = [" EXPR2_STR1 ",\n" MASK2_STR1 ",\n" EXPR2_STR2 ",\n" MASK2_STR2 ",\n" EXPR2_STR3 "];\n";
   fp << "    value3 = [" EXPR3_STR1 ",\n" MASK3_STR1 ",\n" EXPR3_STR2 "];\n";
+  fp << "    value4 = " EXPR4_STR ";\n";
+  fp << "    value5 = " EXPR5_STR ";\n";
+  fp << "    value6 = " EXPR6_STR ";\n";
   fp << "}\n";
 
   fp.close();
@@ -176,6 +183,23 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  //--------------------------------------------------
+
+  unit_func ("dependence()");
+
+  Value * value4 = new Value(&parameters, "Group:value4");
+  Value * value5 = new Value(&parameters, "Group:value5");
+  Value * value6 = new Value(&parameters, "Group:value6");
+
+  unit_assert (value1->dependence() == value_space_time);
+  unit_assert (value2->dependence() == value_space_time);
+  unit_assert (value3->dependence() == value_space_time);
+  unit_assert (value4->dependence() == value_constant);
+  unit_assert (value5->dependence() == value_time);
+  unit_assert (value6->dependence() == value_space);
+
+  unit_assert (value5->evaluate(t,0.0,0.0,0.0) == 1.0 + 2.0*t);
+
   //----------------------------------------------------------------------
 
   unit_finalize();
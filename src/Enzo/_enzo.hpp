@@ -85,9 +85,11 @@ enum enzo_sync_id {
   enzo_sync_id_method_ppml,
   enzo_sync_id_method_turbulence,
   enzo_sync_id_solver_bicgstab,
+  enzo_sync_id_solver_bicgstab_guess,
   enzo_sync_id_solver_bicgstab_loop_25,
   enzo_sync_id_solver_bicgstab_loop_85,
   enzo_sync_id_solver_cg,
+  enzo_sync_id_solver_cg_guess,
   enzo_sync_id_solver_cg_loop_0a,
   enzo_sync_id_solver_cg_loop_0b,
   enzo_sync_id_solver_cg_loop_2a,
@@ -97,6 +99,7 @@ enum enzo_sync_id {
   enzo_sync_id_solver_dd_smooth,
   enzo_sync_id_solver_mg0,
   enzo_sync_id_solver_mg0_coarse,
+  enzo_sync_id_solver_mg0_guess,
   enzo_sync_id_solver_mg0_last,
   enzo_sync_id_solver_mg0_post,
   enzo_sync_id_solver_mg0_pre,
@@ -249,6 +252,7 @@ extern "C" {
   #include "enzo_EnzoComputeCoolingTime.hpp"
 #endif
 
+#include "enzo_EnzoSolverAgglomerate.hpp"
 #include "enzo_EnzoSolverBiCgStab.hpp"
 #include "enzo_EnzoSolverCg.hpp"
 #include "enzo_EnzoSolverDd.hpp"
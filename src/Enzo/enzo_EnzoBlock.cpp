@@ -14,57 +14,7 @@
 
 //======================================================================
 
-int EnzoBlock::UseMinimumPressureSupport[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::MinimumPressureSupportParameter[CONFIG_NODE_SIZE];
-
-// Chemistry
-
-int EnzoBlock::MultiSpecies[CONFIG_NODE_SIZE];
-
-// Physics
-
-int EnzoBlock::PressureFree[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::Gamma[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::GravitationalConstant[CONFIG_NODE_SIZE];
-
-// Problem-specific
-
-int EnzoBlock::ProblemType[CONFIG_NODE_SIZE];
-
-// Method PPM
-
-int EnzoBlock::PPMFlatteningParameter[CONFIG_NODE_SIZE];
-int EnzoBlock::PPMDiffusionParameter[CONFIG_NODE_SIZE];
-int EnzoBlock::PPMSteepeningParameter[CONFIG_NODE_SIZE];
-
-// Numerics
-
-int EnzoBlock::DualEnergyFormalism[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::DualEnergyFormalismEta1[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::DualEnergyFormalismEta2[CONFIG_NODE_SIZE];
-
-enzo_float EnzoBlock::pressure_floor[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::density_floor[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::number_density_floor[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::temperature_floor[CONFIG_NODE_SIZE];
-
-enzo_float EnzoBlock::InitialRedshift[CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::InitialTimeInCodeUnits[CONFIG_NODE_SIZE];
-
-// Domain
-
-enzo_float EnzoBlock::DomainLeftEdge [3*CONFIG_NODE_SIZE];
-enzo_float EnzoBlock::DomainRightEdge[3*CONFIG_NODE_SIZE];
-
-// PPM
-
-int EnzoBlock::GridRank[CONFIG_NODE_SIZE];
-
-int EnzoBlock::ghost_depth[3*CONFIG_NODE_SIZE];
-
-// Fields
-
-int EnzoBlock::NumberOfBaryonFields[CONFIG_NODE_SIZE];
+EnzoBlockParams EnzoBlock::static_params[CONFIG_NODE_SIZE];
 
 //----------------------------------------------------------------------
 
@@ -88,74 +38,76 @@ void EnzoBlock::initialize(const EnzoConfig * enzo_config)
 
   for (int in=0; in<CONFIG_NODE_SIZE; in++) {
 
-    GridRank[in] = 0;
-    NumberOfBaryonFields[in] = 0;
+    EnzoBlockParams & params = static_params[in];
+
+    params.GridRank = 0;
+    params.NumberOfBaryonFields = 0;
 
     int i;
 
     for (i=0; i<MAX_DIMENSION; i++) {
-      DomainLeftEdge [in*3+i] = 0;
-      DomainRightEdge[in*3+i] = 0;
-      ghost_depth[in*3+i] = 0;
+      params.DomainLeftEdge[i] = 0;
+      params.DomainRightEdge[i] = 0;
+      params.ghost_depth[i] = 0;
     }
 
-    Gamma[in]               = enzo_config->field_gamma;
+    params.Gamma               = enzo_config->field_gamma;
 
-    GridRank[in]            = enzo_config->mesh_root_rank;
+    params.GridRank            = enzo_config->mesh_root_rank;
 
     // Chemistry parameters
 
-    MultiSpecies[in] = 0;    // 0:0 1:6 2:9 3:12
+    params.MultiSpecies = 0;    // 0:0 1:6 2:9 3:12
 
     // Gravity parameters
 
-    GravitationalConstant[in]           = 1.0;  // used only in SetMinimumSupport()
+    params.GravitationalConstant           = 1.0;  // used only in SetMinimumSupport()
 
     //Problem specific parameter
 
-    ProblemType[in] = 0;
+    params.ProblemType = 0;
 
     // PPM parameters
 
-    PressureFree[in]              = enzo_config->ppm_pressure_free;
-    UseMinimumPressureSupport[in] = enzo_config->ppm_use_minimum_pressure_support;
-    MinimumPressureSupportParameter[in] = 
+    params.PressureFree              = enzo_config->ppm_pressure_free;
+    params.UseMinimumPressureSupport = enzo_config->ppm_use_minimum_pressure_support;
+    params.MinimumPressureSupportParameter = 
       enzo_config->ppm_minimum_pressure_support_parameter;
     
-    PPMFlatteningParameter[in]    = enzo_config->ppm_flattening;
-    PPMDiffusionParameter[in]     = enzo_config->ppm_diffusion;
-    PPMSteepeningParameter[in]    = enzo_config->ppm_steepening;
-    pressure_floor[in]            = enzo_config->ppm_pressure_floor;
-    density_floor[in]             = enzo_config->ppm_density_floor;
-    temperature_floor[in]         = enzo_config->ppm_temperature_floor;
-    number_density_floor[in]      = enzo_config->ppm_number_density_floor;
-    DualEnergyFormalism[in]       = enzo_config->ppm_dual_energy;
-    DualEnergyFormalismEta1[in]   = enzo_config->ppm_dual_energy_eta_1;
-    DualEnergyFormalismEta2[in]   = enzo_config->ppm_dual_energy_eta_2;
-
-    ghost_depth[in*3+0] = gx;
-    ghost_depth[in*3+1] = gy;
-    ghost_depth[in*3+2] = gz;
-
-    NumberOfBaryonFields[in] = enzo_config->field_list.size();
+    params.PPMFlatteningParameter    = enzo_config->ppm_flattening;
+    params.PPMDiffusionParameter     = enzo_config->ppm_diffusion;
+    params.PPMSteepeningParameter    = enzo_config->ppm_steepening;
+    params.pressure_floor            = enzo_config->ppm_pressure_floor;
+    params.density_floor             = enzo_config->ppm_density_floor;
+    params.temperature_floor         = enzo_config->ppm_temperature_floor;
+    params.number_density_floor      = enzo_config->ppm_number_density_floor;
+    params.DualEnergyFormalism       = enzo_config->ppm_dual_energy;
+    params.DualEnergyFormalismEta1   = enzo_config->ppm_dual_energy_eta_1;
+    params.DualEnergyFormalismEta2   = enzo_config->ppm_dual_energy_eta_2;
+
+    params.ghost_depth[0] = gx;
+    params.ghost_depth[1] = gy;
+    params.ghost_depth[2] = gz;
+
+    params.NumberOfBaryonFields = enzo_config->field_list.size();
 
     // Check NumberOfBaryonFields
 
-    if (NumberOfBaryonFields[in] > MAX_NUMBER_OF_BARYON_FIELDS) {
+    if (params.NumberOfBaryonFields > MAX_NUMBER_OF_BARYON_FIELDS) {
       ERROR2 ("EnzoBlock::initialize",
 	      "MAX_NUMBER_OF_BARYON_FIELDS = %d is too small for %d fields",
-	      MAX_NUMBER_OF_BARYON_FIELDS,NumberOfBaryonFields[in] );
+	      MAX_NUMBER_OF_BARYON_FIELDS,params.NumberOfBaryonFields );
     }
 
-    DomainLeftEdge [in*3+0] = enzo_config->domain_lower[0];
-    DomainLeftEdge [in*3+1] = enzo_config->domain_lower[1];
-    DomainLeftEdge [in*3+2] = enzo_config->domain_lower[2];
+    params.DomainLeftEdge[0] = enzo_config->domain_lower[0];
+    params.DomainLeftEdge[1] = enzo_config->domain_lower[1];
+    params.DomainLeftEdge[2] = enzo_config->domain_lower[2];
 
-    DomainRightEdge[in*3+0] = enzo_config->domain_upper[0];
-    DomainRightEdge[in*3+1] = enzo_config->domain_upper[1];
-    DomainRightEdge[in*3+2] = enzo_config->domain_upper[2];
+    params.DomainRightEdge[0] = enzo_config->domain_upper[0];
+    params.DomainRightEdge[1] = enzo_config->domain_upper[1];
+    params.DomainRightEdge[2] = enzo_config->domain_upper[2];
 
-    InitialTimeInCodeUnits[in] = time;
+    params.InitialTimeInCodeUnits = time;
 
   }
 
@@ -191,6 +143,9 @@ EnzoBlock::EnzoBlock
     redshift(0.0),
     SubgridFluxes(NULL)
 {
+#ifdef CONFIG_USE_GRACKLE
+  memset (&grackle_fields_,0,sizeof(grackle_fields_));
+#endif
 }
 
 //----------------------------------------------------------------------
@@ -216,6 +171,9 @@ void EnzoBlock::initialize_enzo_()
     GridEndIndex[i] = 0;
     CellWidth[i] = 0;
   }
+#ifdef CONFIG_USE_GRACKLE
+  memset (&grackle_fields_,0,sizeof(grackle_fields_));
+#endif
 }
 
 //----------------------------------------------------------------------
@@ -263,79 +221,79 @@ void EnzoBlock::pup(PUP::er &p)
 
 void EnzoBlock::write(FILE * fp) throw ()
 {
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
 
   fprintf (fp,"EnzoBlock: UseMinimumPressureSupport %d\n",
-	   UseMinimumPressureSupport[in]);
+	   params.UseMinimumPressureSupport);
   fprintf (fp,"EnzoBlock: MinimumPressureSupportParameter %g\n",
-	   MinimumPressureSupportParameter[in]);
+	   params.MinimumPressureSupportParameter);
 
   // Chemistry
 
   fprintf (fp,"EnzoBlock: MultiSpecies %d\n",
-	   MultiSpecies[in]);
+	   params.MultiSpecies);
 
   // Physics
 
   fprintf (fp,"EnzoBlock: PressureFree %d\n",
-	   PressureFree[in]);
+	   params.PressureFree);
   fprintf (fp,"EnzoBlock: Gamma %g\n",
-	   Gamma[in]);
+	   params.Gamma);
   fprintf (fp,"EnzoBlock: GravitationalConstant %g\n",
-	   GravitationalConstant[in]);
+	   params.GravitationalConstant);
 
   // Problem-specific
 
   fprintf (fp,"EnzoBlock: ProblemType %d\n",
-	   ProblemType[in]);
+	   params.ProblemType);
 
   // Method PPM
 
   fprintf (fp,"EnzoBlock: PPMFlatteningParameter %d\n",
-	   PPMFlatteningParameter[in]);
+	   params.PPMFlatteningParameter);
   fprintf (fp,"EnzoBlock: PPMDiffusionParameter %d\n",
-	   PPMDiffusionParameter[in]);
+	   params.PPMDiffusionParameter);
   fprintf (fp,"EnzoBlock: PPMSteepeningParameter %d\n",
-	   PPMSteepeningParameter[in]);
+	   params.PPMSteepeningParameter);
 
   // Numerics
 
   fprintf (fp,"EnzoBlock: DualEnergyFormalism %d\n",
-	   DualEnergyFormalism[in]);
+	   params.DualEnergyFormalism);
   fprintf (fp,"EnzoBlock: DualEnergyFormalismEta1 %g\n",
-	   DualEnergyFormalismEta1[in]);
+	   params.DualEnergyFormalismEta1);
   fprintf (fp,"EnzoBlock: DualEnergyFormalismEta2 %g\n",
-	   DualEnergyFormalismEta2[in]);
+	   params.DualEnergyFormalismEta2);
   fprintf (fp,"EnzoBlock: pressure_floor %g\n",
-	   pressure_floor[in]);
+	   params.pressure_floor);
   fprintf (fp,"EnzoBlock: density_density_floor %g\n",
-	   density_floor[in]);
+	   params.density_floor);
   fprintf (fp,"EnzoBlock: number_density_floor %g\n",
-	   number_density_floor[in]);
+	   params.number_density_floor);
   fprintf (fp,"EnzoBlock: temperature_floor %g\n",
-	   temperature_floor[in]);
+	   params.temperature_floor);
 
   fprintf (fp,"EnzoBlock: InitialRedshift %g\n",
-	   InitialRedshift[in]);
+	   params.InitialRedshift);
   fprintf (fp,"EnzoBlock: InitialTimeInCodeUnits %g\n",
-	   InitialTimeInCodeUnits[in]);
+	   params.InitialTimeInCodeUnits);
 
   // Domain
 
   fprintf (fp,"EnzoBlock: DomainLeftEdge %g %g %g\n",
-	   DomainLeftEdge [in*3+0],
-	   DomainLeftEdge [in*3+1],
-	   DomainLeftEdge [in*3+2]);
+	   params.DomainLeftEdge[0],
+	   params.DomainLeftEdge[1],
+	   params.DomainLeftEdge[2]);
   fprintf (fp,"EnzoBlock: DomainRightEdge %g %g %g\n",
-	   DomainRightEdge[in*3+0],
-	   DomainRightEdge[in*3+1],
-	   DomainRightEdge[in*3+2]);
+	   params.DomainRightEdge[0],
+	   params.DomainRightEdge[1],
+	   params.DomainRightEdge[2]);
 
   // Fields
 
   // Grid
 
-  fprintf (fp,"EnzoBlock: GridRank %d\n",    GridRank[in]);
+  fprintf (fp,"EnzoBlock: GridRank %d\n",    params.GridRank);
   fprintf (fp,"EnzoBlock: GridDimension %d %d %d\n",
 	   GridDimension[0],GridDimension[1],GridDimension[2]);
   fprintf (fp,"EnzoBlock: GridStartIndex %d %d %d\n",
@@ -349,13 +307,13 @@ void EnzoBlock::write(FILE * fp) throw ()
 	   CellWidth[0], CellWidth[1], CellWidth[2] );
 
   fprintf (fp,"EnzoBlock: ghost %d %d %d\n",
-	   ghost_depth[in*3+0],
-	   ghost_depth[in*3+1],
-	   ghost_depth[in*3+2]);
+	   params.ghost_depth[0],
+	   params.ghost_depth[1],
+	   params.ghost_depth[2]);
 
 
   fprintf (fp,"EnzoBlock: NumberOfBaryonFields %d\n",
-	   NumberOfBaryonFields[in]);
+	   params.NumberOfBaryonFields);
 
   // problem
 
@@ -413,11 +371,11 @@ void EnzoBlock::initialize () throw()
 
   int gx,gy,gz;
 
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
 
-  gx = EnzoBlock::ghost_depth[in*3+0];
-  gy = EnzoBlock::ghost_depth[in*3+1];
-  gz = EnzoBlock::ghost_depth[in*3+2];
+  gx = params.ghost_depth[0];
+  gy = params.ghost_depth[1];
+  gz = params.ghost_depth[2];
 
   GridDimension[0]  = nx + 2*gx;
   GridDimension[1]  = ny + 2*gy;
@@ -12,90 +12,110 @@
 
 #include "enzo.decl.h"
 
-class EnzoBlock : public BASE_ENZO_BLOCK
+//----------------------------------------------------------------------
 
-{
+struct alignas(64) EnzoBlockParams {
 
-  /// @class    EnzoBlock
+  /// @struct   EnzoBlockParams
   /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] An EnzoBlock is a Block with Enzo data
-
-  friend class IoEnzoBlock;
-
-  friend class EnzoSimulation;
-  friend class EnzoTimestep;
-  friend class EnzoTimestepPpm;
-  friend class EnzoTimestepPpml;
-  friend class EnzoInitialImplosion2;
-  friend class EnzoInitialSedovArray2;
+  /// @brief    [\ref Enzo] Read-only Enzo parameters used by EnzoBlock
+  /// methods.  Aligned to a cache line so that copies for different
+  /// PEs in an SMP process do not share one.
 
-  //----------------------------------------------------------------------
-  // functions
+  // Cosmology
 
-  static void initialize (const EnzoConfig * enzo_config);
-
-  //----------------------------------------------------------------------
-  // variables
-  
-public:
-
-  // /// Cosmology
-
-  static int UseMinimumPressureSupport[CONFIG_NODE_SIZE];
-  static enzo_float MinimumPressureSupportParameter[CONFIG_NODE_SIZE];
+  int UseMinimumPressureSupport;
+  enzo_float MinimumPressureSupportParameter;
 
   // Chemistry
 
-  static int MultiSpecies[CONFIG_NODE_SIZE];
+  int MultiSpecies;
 
   // Physics
 
-  static int PressureFree[CONFIG_NODE_SIZE];
-  static enzo_float Gamma[CONFIG_NODE_SIZE];
-  static enzo_float GravitationalConstant[CONFIG_NODE_SIZE];
+  int PressureFree;
+  enzo_float Gamma;
+  enzo_float GravitationalConstant;
 
   // Problem-specific
 
-  static int ProblemType[CONFIG_NODE_SIZE];
+  int ProblemType;
 
   // Method PPM
 
-  static int PPMFlatteningParameter[CONFIG_NODE_SIZE];
-  static int PPMDiffusionParameter[CONFIG_NODE_SIZE];
-  static int PPMSteepeningParameter[CONFIG_NODE_SIZE];
-
-  // Parallel
-
-  //  static int ProcessorNumber;
+  int PPMFlatteningParameter;
+  int PPMDiffusionParameter;
+  int PPMSteepeningParameter;
 
   // Numerics
 
-  static int DualEnergyFormalism[CONFIG_NODE_SIZE];
-  static enzo_float DualEnergyFormalismEta1[CONFIG_NODE_SIZE];
-  static enzo_float DualEnergyFormalismEta2[CONFIG_NODE_SIZE];
+  int DualEnergyFormalism;
+  enzo_float DualEnergyFormalismEta1;
+  enzo_float DualEnergyFormalismEta2;
 
-  static enzo_float pressure_floor[CONFIG_NODE_SIZE];
-  static enzo_float density_floor[CONFIG_NODE_SIZE];
-  static enzo_float number_density_floor[CONFIG_NODE_SIZE];
-  static enzo_float temperature_floor[CONFIG_NODE_SIZE];
+  enzo_float pressure_floor;
+  enzo_float density_floor;
+  enzo_float number_density_floor;
+  enzo_float temperature_floor;
 
-  static enzo_float InitialRedshift[CONFIG_NODE_SIZE];
-  static enzo_float InitialTimeInCodeUnits[CONFIG_NODE_SIZE];
+  enzo_float InitialRedshift;
+  enzo_float InitialTimeInCodeUnits;
 
   // Domain
 
-  static enzo_float DomainLeftEdge [3*CONFIG_NODE_SIZE];
-  static enzo_float DomainRightEdge[3*CONFIG_NODE_SIZE];
+  enzo_float DomainLeftEdge [3];
+  enzo_float DomainRightEdge[3];
 
   // PPM
 
-  static int GridRank[CONFIG_NODE_SIZE];
+  int GridRank;
 
-  static int ghost_depth[3*CONFIG_NODE_SIZE];
+  int ghost_depth[3];
 
   // Fields
 
-  static int NumberOfBaryonFields[CONFIG_NODE_SIZE];  // active baryon fields
+  int NumberOfBaryonFields;  // active baryon fields
+
+};
+
+PUPbytes(EnzoBlockParams)
+
+//----------------------------------------------------------------------
+
+class EnzoBlock : public BASE_ENZO_BLOCK
+
+{
+
+  /// @class    EnzoBlock
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] An EnzoBlock is a Block with Enzo data
+
+  friend class IoEnzoBlock;
+
+  friend class EnzoSimulation;
+  friend class EnzoTimestep;
+  friend class EnzoTimestepPpm;
+  friend class EnzoTimestepPpml;
+  friend class EnzoInitialImplosion2;
+  friend class EnzoInitialSedovArray2;
+
+  //----------------------------------------------------------------------
+  // functions
+
+  static void initialize (const EnzoConfig * enzo_config);
+
+  //----------------------------------------------------------------------
+  // variables
+  
+public:
+
+  /// Parameters shared by all EnzoBlocks, one copy per PE
+  static EnzoBlockParams static_params[CONFIG_NODE_SIZE];
+
+  /// Return the parameters of the calling PE.  Methods should look
+  /// them up once per call rather than on every access
+  static const EnzoBlockParams & params()
+  { return static_params[cello::index_static()]; }
 
 public: // interface
 
@@ -123,6 +143,9 @@ public: // interface
       GridEndIndex[i] = 0; 
       CellWidth[i] = 0.0;
     }
+#ifdef CONFIG_USE_GRACKLE
+    memset (&grackle_fields_,0,sizeof(grackle_fields_));
+#endif
     performance_stop_(perf_block);
   }
 
@@ -142,6 +165,9 @@ public: // interface
       GridEndIndex[i] = 0; 
       CellWidth[i] = 0.0;
     }
+#ifdef CONFIG_USE_GRACKLE
+    memset (&grackle_fields_,0,sizeof(grackle_fields_));
+#endif
     performance_stop_(perf_block);
   }
 
@@ -213,6 +239,11 @@ public: /// entry methods
 
   //--------------------------------------------------
 
+  /// Continue a Block after its batched Grackle solve
+  void p_method_grackle_batch_done();
+
+  //--------------------------------------------------
+
   /// Synchronize after potential solve and before accelerations
   void r_method_gravity_continue();
 
@@ -221,6 +252,9 @@ public: /// entry methods
 
   //--------------------------------------------------
 
+  /// EnzoSolverCg entry method: initial guess X refreshed
+  void p_solver_cg_guess () ;
+
   /// EnzoSolverCg entry method: DOT ==> refresh P
   void r_solver_cg_loop_0a (CkReductionMsg * msg) ;  
 
@@ -247,6 +281,9 @@ public: /// entry methods
 
   //--------------------------------------------------
   
+  /// EnzoSolverBiCGStab entry method: initial guess X refreshed
+  void p_solver_bicgstab_guess();
+
   /// EnzoSolverBiCGStab entry method: SUM(B) and COUNT(B)
   void r_solver_bicgstab_start_1(CkReductionMsg* msg);
 
@@ -284,6 +321,12 @@ public: /// entry methods
 			   std::vector<int> is_array,
 			   int i_function);
 
+  /// EnzoSolverAgglomerate
+
+  void p_solver_agglomerate_gather
+  (int is, Index index, int ib3[3], int order, int n, char * a);
+  void p_solver_agglomerate_scatter (int is, int n, char * a);
+
 /// EnzoSolverDd
   
   void p_solver_dd_restrict_recv(FieldMsg * msg);
@@ -301,6 +344,7 @@ public: /// entry methods
 
   // EnzoSolverMg0
 
+  void p_solver_mg0_guess();
   void r_solver_mg0_begin_solve(CkReductionMsg* msg);  
   void p_solver_mg0_restrict();
   void p_solver_mg0_solve_coarse();
@@ -350,6 +394,15 @@ public: // attributes (YIKES!)
   int GridEndIndex[MAX_DIMENSION]; 
   enzo_float CellWidth[MAX_DIMENSION];
 
+#ifdef CONFIG_USE_GRACKLE
+  /// Grackle field binding cached by EnzoMethodGrackle::grackle_fields();
+  /// not migrated, and rebuilt when the Block's field data moves
+  grackle_field_data grackle_fields_;
+
+  /// Grid dimension, start, and end arrays referenced by grackle_fields_
+  int grackle_grid_[9];
+#endif
+
 };
 
 #endif /* ENZO_ENZO_BLOCK_HPP */
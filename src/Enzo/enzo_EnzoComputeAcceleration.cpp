@@ -213,21 +213,18 @@ void EnzoComputeAcceleration::compute_(Block * block)
 
     double dt_shift = 0.5*block->dt() / cosmo_a;
     //  double dt_shift = 0.0;
-    if (rank_ >= 1) {
-      EnzoComputeCicInterp interp_x
-	("acceleration_x", "dark", "ax",dt_shift);
-      interp_x.compute(block);
-    }
-    if (rank_ >= 2) {
-      EnzoComputeCicInterp interp_y
-	("acceleration_y", "dark", "ay",dt_shift);
-      interp_y.compute(block);
-    }
-    if (rank_ >= 3) {
-      EnzoComputeCicInterp interp_z
-	("acceleration_z", "dark", "az",dt_shift);
-      interp_z.compute(block);
-    }
+
+    // Interpolate all acceleration components in a single pass
+
+    const std::string field_names[3] =
+      { "acceleration_x", "acceleration_y", "acceleration_z" };
+    const std::string attribute_names[3] = { "ax", "ay", "az" };
+
+    EnzoComputeCicInterp interp
+      (std::vector<std::string> (field_names, field_names + rank_), "dark",
+       std::vector<std::string> (attribute_names, attribute_names + rank_),
+       dt_shift);
+    interp.compute(block);
   }
 }
 
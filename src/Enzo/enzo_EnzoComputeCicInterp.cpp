@@ -19,14 +19,44 @@ EnzoComputeCicInterp::EnzoComputeCicInterp
  std::string     particle_attribute,
  double          dt)
   : it_p_ (cello::particle_descr()->type_index (particle_type)),
-    ia_p_ (cello::particle_descr()->attribute_index (it_p_,particle_attribute)),
-    if_ (cello::field_descr()->field_id (field_name)),
+    ia_p_ (1,cello::particle_descr()->attribute_index
+	   (it_p_,particle_attribute)),
+    if_ (1,cello::field_descr()->field_id (field_name)),
     dt_(dt)
 {
 }
 
 //----------------------------------------------------------------------
 
+EnzoComputeCicInterp::EnzoComputeCicInterp  
+(std::vector<std::string> field_names,
+ std::string              particle_type,
+ std::vector<std::string> particle_attributes,
+ double                   dt)
+  : it_p_ (cello::particle_descr()->type_index (particle_type)),
+    ia_p_ (),
+    if_ (),
+    dt_(dt)
+{
+  ASSERT2 ("EnzoComputeCicInterp::EnzoComputeCicInterp()",
+	   "Number of fields %d must equal number of attributes %d",
+	   field_names.size(),particle_attributes.size(),
+	   field_names.size() == particle_attributes.size());
+
+  ASSERT1 ("EnzoComputeCicInterp::EnzoComputeCicInterp()",
+	   "Number of fields %d must be between 1 and 3",
+	   field_names.size(),
+	   1 <= field_names.size() && field_names.size() <= 3);
+
+  for (size_t i=0; i<field_names.size(); i++) {
+    ia_p_.push_back(cello::particle_descr()->attribute_index
+		    (it_p_,particle_attributes[i]));
+    if_.push_back(cello::field_descr()->field_id (field_names[i]));
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoComputeCicInterp::pup (PUP::er &p)
 {
 
@@ -62,7 +92,16 @@ void EnzoComputeCicInterp::compute_(Block * block)
   Field field = enzo_block->data()->field();
   Particle particle = enzo_block->data()->particle();
 
-  enzo_float * vf = (enzo_float*)field.values(if_);
+  // fields and attributes to interpolate
+
+  const int nc = if_.size();
+
+  enzo_float * vf[3] = {nullptr, nullptr, nullptr};
+  int da[3] = {0,0,0};
+  for (int ic=0; ic<nc; ic++) {
+    vf[ic] = (enzo_float*)field.values(if_[ic]);
+    da[ic] = particle.stride(it_p_,ia_p_[ic]);
+  }
 
   const int ia_x = particle.attribute_position(it_p_,0);
   const int ia_y = particle.attribute_position(it_p_,1);
@@ -73,7 +112,6 @@ void EnzoComputeCicInterp::compute_(Block * block)
   const int ia_vz = particle.attribute_velocity(it_p_,2);
 
   const int dp =  particle.stride(it_p_,ia_x);
-  const int da =  particle.stride(it_p_,ia_p_);
   const int dv =  particle.stride(it_p_,ia_vx);
 
   const int rank = cello::rank();
@@ -105,11 +143,14 @@ void EnzoComputeCicInterp::compute_(Block * block)
   
   const int nb = particle.num_batches(it_p_);
 
+  enzo_float * vp[3] = {nullptr, nullptr, nullptr};
+
   if (rank == 1) {
 
     for (int ib=0; ib<nb; ib++) {
 
-      enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
+      for (int ic=0; ic<nc; ic++)
+	vp[ic] = (enzo_float*) particle.attribute_array(it_p_, ia_p_[ic], ib);
 
       const int np = particle.num_particles(it_p_,ib);
 
@@ -125,20 +166,22 @@ void EnzoComputeCicInterp::compute_(Block * block)
 
 	int ix0 = gx + floor(tx);
 
-	int ix1 = ix0 + 1;
-
 	enzo_float x0 = 1.0 - (tx - floor(tx));
 
 	enzo_float x1 = 1.0 - x0;
 
-	vp[ip*da] = x0*vf[ix0] + x1*vf[ix1];
+	for (int ic=0; ic<nc; ic++) {
+	  const enzo_float * vf0 = vf[ic] + ix0;
+	  vp[ic][ip*da[ic]] = x0*vf0[i000] + x1*vf0[i100];
+	}
       }
     }
   } else if (rank == 2) {
 
     for (int ib=0; ib<nb; ib++) {
 
-      enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
+      for (int ic=0; ic<nc; ic++)
+	vp[ic] = (enzo_float*) particle.attribute_array(it_p_, ia_p_[ic], ib);
 
       const int np = particle.num_particles(it_p_,ib);
 
@@ -167,11 +210,18 @@ void EnzoComputeCicInterp::compute_(Block * block)
 	enzo_float x1 = 1.0 - x0;
 	enzo_float y1 = 1.0 - y0;
 
-	enzo_float * vf0 = vf+ix0+mx*iy0;
-	
-	vp[ip*da] = x0*(y0*vf0[i000] + y1*vf0[i010])
-	  +         x1*(y0*vf0[i100] + y1*vf0[i110]);
+	// weights are shared by all fields
+
+	const enzo_float w00 = x0*y0, w01 = x0*y1;
+	const enzo_float w10 = x1*y0, w11 = x1*y1;
 
+	const int i0 = ix0+mx*iy0;
+
+	for (int ic=0; ic<nc; ic++) {
+	  const enzo_float * vf0 = vf[ic] + i0;
+	  vp[ic][ip*da[ic]] = w00*vf0[i000] + w01*vf0[i010]
+	    +                 w10*vf0[i100] + w11*vf0[i110];
+	}
       }
     }
 
@@ -179,7 +229,8 @@ void EnzoComputeCicInterp::compute_(Block * block)
 
     for (int ib=0; ib<nb; ib++) {
 
-      enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
+      for (int ic=0; ic<nc; ic++)
+	vp[ic] = (enzo_float*) particle.attribute_array(it_p_, ia_p_[ic], ib);
 
       const int np = particle.num_particles(it_p_,ib);
 
@@ -216,14 +267,22 @@ void EnzoComputeCicInterp::compute_(Block * block)
 	enzo_float y1 = 1.0 - y0;
 	enzo_float z1 = 1.0 - z0;
 
-	enzo_float * vf0 = vf + ix0+mx*(iy0+my*iz0);
+	// weights are shared by all fields
+
+	const enzo_float w000 = x0*y0*z0, w001 = x0*y0*z1;
+	const enzo_float w010 = x0*y1*z0, w011 = x0*y1*z1;
+	const enzo_float w100 = x1*y0*z0, w101 = x1*y0*z1;
+	const enzo_float w110 = x1*y1*z0, w111 = x1*y1*z1;
+
+	const int i0 = ix0+mx*(iy0+my*iz0);
 
-	vp[ip*da] = x0*(y0*(z0*vf0[i000] + z1*vf0[i001]) +
-			y1*(z0*vf0[i010] + z1*vf0[i011])) 
-	  +         x1*(y0*(z0*vf0[i100] + z1*vf0[i101]) +
-			y1*(z0*vf0[i110] + z1*vf0[i111]));
+	for (int ic=0; ic<nc; ic++) {
+	  const enzo_float * vf0 = vf[ic] + i0;
+	  vp[ic][ip*da[ic]] =
+	    w000*vf0[i000] + w001*vf0[i001] + w010*vf0[i010] + w011*vf0[i011] +
+	    w100*vf0[i100] + w101*vf0[i101] + w110*vf0[i110] + w111*vf0[i111];
+	}
       }
     }
   }
-}  
-
+}
@@ -13,6 +13,9 @@ class EnzoComputeCicInterp : public Compute {
   /// @class    EnzoComputeCicInterp
   /// @ingroup  Enzo
   /// @brief    [\ref Enzo] Encapsulate CIC (Cloud-in-cell) particle-field interpolation
+  ///
+  /// Up to three fields may be interpolated in one pass, e.g. the
+  /// acceleration components, sharing particle positions and weights
 
 public: // interface
 
@@ -22,6 +25,14 @@ public: // interface
 			std::string particle_attribute,
 			double dt = 0.0);
 
+  /// Create a new EnzoComputeCicInterp object that interpolates
+  /// several fields to the corresponding particle attributes, computing
+  /// CIC weights once per particle
+  EnzoComputeCicInterp (std::vector<std::string> field_names,
+			std::string particle_type,
+			std::vector<std::string> particle_attributes,
+			double dt = 0.0);
+
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoComputeCicInterp);
   
@@ -29,8 +40,8 @@ public: // interface
   EnzoComputeCicInterp (CkMigrateMessage *m)
     : Compute(m),
       it_p_(0),
-      ia_p_(0),
-      if_(0),
+      ia_p_(),
+      if_(),
       dt_(0.0)
   { }
 
@@ -49,11 +60,11 @@ private: // attributes
   /// particle type
   int it_p_;
 
-  /// particle attribute
-  int ia_p_;
+  /// particle attribute for each field
+  std::vector<int> ia_p_;
 
-  /// id of field type
-  int if_;
+  /// id of each field
+  std::vector<int> if_;
 
   /// dt at which to apply the interpolation
   double dt_;
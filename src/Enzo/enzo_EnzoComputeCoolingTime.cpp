@@ -81,6 +81,19 @@ void EnzoComputeCoolingTime::compute_(Block * block,
          "Grackle must be enabled in order to compute the cooling time",
          enzo_config->method_grackle_use_grackle );
 
+  // Skip if the permanent cooling time field is already current
+
+  const bool is_permanent = field.is_field("cooling_time") &&
+    (ct == (enzo_float*) field.values("cooling_time", i_hist_));
+
+  // Grackle parameters are global, so there are no compute parameters
+  // to match
+
+  const std::vector<double> param;
+
+  if (is_permanent && block->is_derived_current("cooling_time",i_hist_,param))
+    return;
+
   code_units grackle_units_;
   grackle_field_data grackle_fields_;
 
@@ -92,14 +105,16 @@ void EnzoComputeCoolingTime::compute_(Block * block,
 
   // if grackle fields are not provided, define them
   bool delete_grackle_fields = false;
-  if (!grackle_fields){
+  if (!grackle_fields && i_hist_ == 0){
+    grackle_fields  = EnzoMethodGrackle::grackle_fields(enzo_block);
+  } else if (!grackle_fields){
     grackle_fields  = &grackle_fields_;
     EnzoMethodGrackle::setup_grackle_fields(enzo_block, grackle_fields, i_hist_);
     delete_grackle_fields = true;
   }
 
   // temperature is returned in units of K
-  if (calculate_cooling_time(&grackle_units_, &grackle_fields_, ct) == ENZO_FAIL){
+  if (calculate_cooling_time(grackle_units, grackle_fields, ct) == ENZO_FAIL){
     ERROR("EnzoComputeCoolingTime::compute_()",
           "Error in call to Grackle's compute_temperature routine.\n");
   }
@@ -107,7 +122,8 @@ void EnzoComputeCoolingTime::compute_(Block * block,
   if (delete_grackle_fields){
     EnzoMethodGrackle::delete_grackle_fields(grackle_fields);
   }
-  return;
+
+  if (is_permanent) block->set_derived_current("cooling_time",i_hist_,param);
 }
 
 #endif
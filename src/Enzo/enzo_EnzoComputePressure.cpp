@@ -84,6 +84,15 @@ void EnzoComputePressure::compute_(Block * block,
 
   Field field = enzo_block->data()->field();
 
+  // Skip if the permanent pressure field is already current
+
+  const bool is_permanent = field.is_field("pressure") &&
+    (p == (enzo_float*) field.values("pressure", i_hist_));
+
+  const std::vector<double> param = { gamma_, double(comoving_coordinates_) };
+
+  if (is_permanent && block->is_derived_current("pressure",i_hist_,param))
+    return;
 
   if (enzo::config()->method_grackle_use_grackle){
 #ifdef CONFIG_USE_GRACKLE
@@ -98,7 +107,9 @@ void EnzoComputePressure::compute_(Block * block,
 
     // if grackle fields are not provided, define them
     bool delete_grackle_fields = false;
-    if (!grackle_fields){
+    if (!grackle_fields && i_hist_ == 0){
+      grackle_fields  = EnzoMethodGrackle::grackle_fields(enzo_block);
+    } else if (!grackle_fields){
       grackle_fields  = &grackle_fields_;
   		// NOTE: Add option here to pass history index to setup to
 		//       allow for computation of old baryon fields ....
@@ -127,14 +138,7 @@ void EnzoComputePressure::compute_(Block * block,
 
     const int rank = cello::rank();
 
-    enzo_float * d = (enzo_float*) field.values("density", i_hist_);
-
-    enzo_float * v3[3] =
-      { (enzo_float*) (              field.values("velocity_x", i_hist_)),
-        (enzo_float*) ((rank >= 2) ? field.values("velocity_y", i_hist_) : NULL),
-        (enzo_float*) ((rank >= 3) ? field.values("velocity_z", i_hist_) : NULL) };
-
-    enzo_float * te = (enzo_float*) field.values("total_energy", i_hist_);
+    const enzo_float * d = (enzo_float*) field.values("density", i_hist_);
 
     int nx,ny,nz;
     field.size(&nx,&ny,&nz);
@@ -144,14 +148,26 @@ void EnzoComputePressure::compute_(Block * block,
     if (rank < 2) gy = 0;
     if (rank < 3) gz = 0;
 
-    int m = (nx+2*gx) * (ny+2*gy) * (nz+2*gz);
-    enzo_float gm1 = gamma_ - 1.0;
-    for (int i=0; i<m; i++) {
-      enzo_float e= te[i];
-      e -= 0.5*v3[0][i]*v3[0][i];
-      if (rank >= 2) e -= 0.5*v3[1][i]*v3[1][i];
-      if (rank >= 3) e -= 0.5*v3[2][i]*v3[2][i];
-      p[i] = gm1 * d[i] * e;
+    const int m = (nx+2*gx) * (ny+2*gy) * (nz+2*gz);
+    const enzo_float gm1 = gamma_ - 1.0;
+
+    const enzo_float * te =
+      (enzo_float*) field.values("total_energy", i_hist_);
+
+    const enzo_float * v3[3] =
+      { (enzo_float*) (              field.values("velocity_x", i_hist_)),
+	(enzo_float*) ((rank >= 2) ? field.values("velocity_y", i_hist_) : NULL),
+	(enzo_float*) ((rank >= 3) ? field.values("velocity_z", i_hist_) : NULL) };
+
+    // Pressure from total energy, with loops specialized by rank so
+    // the inner loops have no branches
+
+    if (rank == 1) {
+      compute_total_<1>(p,d,te,v3,gm1,m);
+    } else if (rank == 2) {
+      compute_total_<2>(p,d,te,v3,gm1,m);
+    } else {
+      compute_total_<3>(p,d,te,v3,gm1,m);
     }
   }
 
@@ -160,5 +176,24 @@ void EnzoComputePressure::compute_(Block * block,
 	//          location of field pointer declarations above
 	//          (inside / outside of Grackle ifdef)
 
- return;
+  if (is_permanent) block->set_derived_current("pressure",i_hist_,param);
+}
+
+//----------------------------------------------------------------------
+
+template <int RANK>
+void EnzoComputePressure::compute_total_
+(enzo_float * p, const enzo_float * d, const enzo_float * te,
+ const enzo_float * const v3[3], enzo_float gm1, int m) throw()
+{
+  const enzo_float * vx = v3[0];
+  const enzo_float * vy = v3[1];
+  const enzo_float * vz = v3[2];
+  for (int i=0; i<m; i++) {
+    enzo_float e = te[i];
+    e -= 0.5*vx[i]*vx[i];
+    if (RANK >= 2) e -= 0.5*vy[i]*vy[i];
+    if (RANK >= 3) e -= 0.5*vz[i]*vz[i];
+    p[i] = gm1 * d[i] * e;
+  }
 }
@@ -52,7 +52,13 @@ public: // interface
 #endif
     );
 
-    
+protected: // functions
+
+  /// Compute pressure from the total energy and velocity
+  template <int RANK>
+  static void compute_total_
+  (enzo_float * p, const enzo_float * d, const enzo_float * te,
+   const enzo_float * const v3[3], enzo_float gm1, int m) throw();
 
 protected: // attributes
 
@@ -89,7 +89,22 @@ void EnzoComputeTemperature::compute_(Block * block,
 
   Field field = enzo_block->data()->field();
 
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
+
+  // Skip if the permanent temperature field is already current.  Not
+  // cached if pressure is not recomputed, since the result then
+  // depends on whatever the pressure field holds
+
+  const bool is_permanent = recompute_pressure &&
+    field.is_field("temperature") &&
+    (t == (enzo_float*) field.values("temperature", i_hist_));
+
+  const std::vector<double> param =
+    { density_floor_, temperature_floor_, mol_weight_, params.Gamma,
+      double(comoving_coordinates_) };
+
+  if (is_permanent && block->is_derived_current("temperature",i_hist_,param))
+    return;
 
   if (enzo::config()->method_grackle_use_grackle){
 
@@ -105,7 +120,9 @@ void EnzoComputeTemperature::compute_(Block * block,
 
     // if grackle fields are not provided, define them
     bool delete_grackle_fields = false;
-    if (!grackle_fields){
+    if (!grackle_fields && i_hist_ == 0){
+      grackle_fields  = EnzoMethodGrackle::grackle_fields(enzo_block);
+    } else if (!grackle_fields){
       grackle_fields  = &grackle_fields_;
       EnzoMethodGrackle::setup_grackle_fields(enzo_block, grackle_fields, i_hist_);
       delete_grackle_fields = true;
@@ -138,21 +155,29 @@ void EnzoComputeTemperature::compute_(Block * block,
 
     const int m = mx*my*mz;
 
-    enzo_float * d = (enzo_float*) field.values("density", i_hist_);
+    const enzo_float * d = (enzo_float*) field.values("density", i_hist_);
     enzo_float * p = (enzo_float*) field.values("pressure", i_hist_);
 
-    EnzoComputePressure compute_pressure(EnzoBlock::Gamma[in],
+    EnzoComputePressure compute_pressure(params.Gamma,
                                        comoving_coordinates_);
     compute_pressure.set_history(i_hist_);
 
     if (recompute_pressure) compute_pressure.compute(block, p);
 
+    // Hoist loop invariants, including the virtual units call, out
+    // of the loop so it vectorizes
+
+    const enzo_float d_floor = density_floor_;
+    const enzo_float t_floor = temperature_floor_;
+    const double     mu      = mol_weight_;
+    const double     t_units = enzo_units->temperature();
+
     for (int i=0; i<m; i++) {
-      enzo_float density     = std::max(d[i], (enzo_float) density_floor_);
-      enzo_float temperature = p[i] * mol_weight_ / density;
-      t[i] = std::max(temperature, (enzo_float)temperature_floor_) * enzo_units->temperature();
+      enzo_float density     = std::max(d[i], d_floor);
+      enzo_float temperature = p[i] * mu / density;
+      t[i] = std::max(temperature, t_floor) * t_units;
     }
   }
 
-  return;
+  if (is_permanent) block->set_derived_current("temperature",i_hist_,param);
 }
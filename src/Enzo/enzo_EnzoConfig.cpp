@@ -31,6 +31,7 @@ EnzoConfig::EnzoConfig() throw ()
   ppm_steepening(false),
   ppm_use_minimum_pressure_support(false),
   ppm_mol_weight(0.0),
+  ppm_threads(0),
   field_gamma(0.0),
   physics_cosmology(false),
   physics_cosmology_hubble_constant_now(0.0),
@@ -124,12 +125,14 @@ EnzoConfig::EnzoConfig() throw ()
   method_grackle_chemistry(),
   method_grackle_use_cooling_timestep(false),
   method_grackle_radiation_redshift(-1.0),
+  method_grackle_batch_size(0),
 #endif
   // EnzoMethodGravity
   method_gravity_grav_const(0.0),
   method_gravity_solver(""),
   method_gravity_order(4),
   method_gravity_accumulate(false),
+  method_gravity_initial_guess("zero"),
   /// EnzoMethodPmDeposit
   method_pm_deposit_alpha(0.5),
   /// EnzoMethodPmUpdate
@@ -141,11 +144,15 @@ EnzoConfig::EnzoConfig() throw ()
   solver_coarse_solve(),
   solver_domain_solve(),
   solver_weight(),
+  solver_sweeps_per_refresh(),
   solver_restart_cycle(),
   /// EnzoSolver<Krylov>
   solver_precondition(),
+  solver_precision(),
+  solver_refine_tol(),
   solver_local(),
   solver_coarse_level(),
+  solver_cycles(),
   solver_is_unigrid(),
   stopping_redshift()
 
@@ -199,6 +206,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | ppm_steepening;
   p | ppm_use_minimum_pressure_support;
   p | ppm_mol_weight;
+  p | ppm_threads;
 
   p | field_gamma;
 
@@ -300,6 +308,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_gravity_solver;
   p | method_gravity_order;
   p | method_gravity_accumulate;
+  p | method_gravity_initial_guess;
 
   p | method_pm_deposit_alpha;
   p | method_pm_update_max_dt;
@@ -310,10 +319,14 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_coarse_solve;
   p | solver_domain_solve;
   p | solver_weight;
+  p | solver_sweeps_per_refresh;
   p | solver_restart_cycle;
   p | solver_precondition;
+  p | solver_precision;
+  p | solver_refine_tol;
   p | solver_local;
   p | solver_coarse_level;
+  p | solver_cycles;
   p | solver_is_unigrid;
 
   p | stopping_redshift;
@@ -327,6 +340,7 @@ void EnzoConfig::pup (PUP::er &p)
 #ifdef CONFIG_USE_GRACKLE
   p  | method_grackle_use_cooling_timestep;
   p  | method_grackle_radiation_redshift;
+  p  | method_grackle_batch_size;
 
   int is_null = (method_grackle_chemistry==NULL);
   p | is_null;
@@ -413,6 +427,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:ppm:use_minimum_pressure_support",false);
   ppm_mol_weight = p->value_float
     ("Method:ppm:mol_weight",0.6);
+  ppm_threads = p->value_integer
+    ("Method:ppm:threads",0);
 
   // InitialMusic
 
@@ -645,6 +661,9 @@ void EnzoConfig::read(Parameters * p) throw()
   method_gravity_accumulate = p->value_logical
     ("Method:gravity:accumulate",true);
 
+  method_gravity_initial_guess = p->value_string
+    ("Method:gravity:initial_guess","zero");
+
   //--------------------------------------------------
   // Physics
   //--------------------------------------------------
@@ -711,10 +730,14 @@ void EnzoConfig::read(Parameters * p) throw()
   solver_post_smooth. resize(num_solvers);
   solver_last_smooth. resize(num_solvers);
   solver_weight.      resize(num_solvers);
+  solver_sweeps_per_refresh.resize(num_solvers);
   solver_restart_cycle.resize(num_solvers);
   solver_precondition.resize(num_solvers);
+  solver_precision.   resize(num_solvers);
+  solver_refine_tol.  resize(num_solvers);
   solver_local.       resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
+  solver_cycles.      resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
 
   for (int index_solver=0; index_solver<num_solvers; index_solver++) {
@@ -769,9 +792,18 @@ void EnzoConfig::read(Parameters * p) throw()
     solver_weight[index_solver] =
       p->value_float(solver_name + ":weight",1.0);
 
+    solver_sweeps_per_refresh[index_solver] =
+      p->value_integer(solver_name + ":sweeps_per_refresh",1);
+
     solver_restart_cycle[index_solver] =
       p->value_integer(solver_name + ":restart_cycle",1);
 
+    solver_precision[index_solver] =
+      p->value_string (solver_name + ":precision","default");
+
+    solver_refine_tol[index_solver] =
+      p->value_float (solver_name + ":refine_tol",1e-6);
+
     solver_local[index_solver] =
       p->value_logical (solver_name + ":local",false);
 
@@ -779,6 +811,9 @@ void EnzoConfig::read(Parameters * p) throw()
       p->value_integer (solver_name + ":coarse_level",
 			solver_min_level[index_solver]);
 
+    solver_cycles[index_solver] =
+      p->value_integer (solver_name + ":cycles",0);
+
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
@@ -828,6 +863,11 @@ void EnzoConfig::read(Parameters * p) throw()
     method_grackle_radiation_redshift = p->value_float
       ("Method:grackle:radiation_redshift", -1.0);
 
+    // maximum number of cells per batched solve, or 0 to solve each
+    // Block separately
+    method_grackle_batch_size = p->value_integer
+      ("Method:grackle:batch_size", 0);
+
     // Set Grackle parameters from parameter file
     grackle_data->with_radiative_cooling = p->value_integer
       ("Method:grackle:with_radiative_cooling",
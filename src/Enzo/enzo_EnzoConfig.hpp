@@ -116,6 +116,7 @@ public: // interface
       ppm_steepening(false),
       ppm_use_minimum_pressure_support(false),
       ppm_mol_weight(0.0),
+      ppm_threads(0),
       field_gamma(0.0),
       // Cosmology
       physics_cosmology(false),
@@ -211,12 +212,14 @@ public: // interface
       method_grackle_chemistry(),
       method_grackle_use_cooling_timestep(false),
       method_grackle_radiation_redshift(-1.0),
+      method_grackle_batch_size(0),
 #endif
       // EnzoMethodGravity
       method_gravity_grav_const(0.0),
       method_gravity_solver(""),
       method_gravity_order(4),
       method_gravity_accumulate(false),
+      method_gravity_initial_guess("zero"),
       // EnzoMethodPmDeposit
       method_pm_deposit_alpha(0.5),
       // EnzoMethodPmUpdate
@@ -228,11 +231,15 @@ public: // interface
       solver_coarse_solve(),
       solver_domain_solve(),
       solver_weight(),
+      solver_sweeps_per_refresh(),
       solver_restart_cycle(),
       // EnzoSolver<Krylov>
       solver_precondition(),
+      solver_precision(),
+      solver_refine_tol(),
       solver_local(),
       solver_coarse_level(),
+      solver_cycles(),
       solver_is_unigrid(),
       // EnzoStopping
       stopping_redshift()
@@ -278,6 +285,7 @@ public: // attributes
   bool                       ppm_steepening;
   bool                       ppm_use_minimum_pressure_support;
   double                     ppm_mol_weight;
+  int                        ppm_threads;
 
   double                     field_gamma;
 
@@ -400,6 +408,7 @@ public: // attributes
   chemistry_data *           method_grackle_chemistry;
   bool                       method_grackle_use_cooling_timestep;
   double                     method_grackle_radiation_redshift;
+  int                        method_grackle_batch_size;
 #endif /* CONFIG_USE_GRACKLE */
 
   /// EnzoMethodGravity
@@ -407,6 +416,7 @@ public: // attributes
   std::string                method_gravity_solver;
   int                        method_gravity_order;
   bool                       method_gravity_accumulate;
+  std::string                method_gravity_initial_guess;
 
   /// EnzoMethodPmDeposit
 
@@ -444,6 +454,10 @@ public: // attributes
 
   std::vector<double>        solver_weight;
 
+  /// Number of Jacobi smoother sweeps between ghost zone refreshes
+
+  std::vector<int>           solver_sweeps_per_refresh;
+
   /// Whether to start the iterative solver using the previous solution
 
   std::vector<int>           solver_restart_cycle;
@@ -453,11 +467,21 @@ public: // attributes
   /// Solver index for Krylov solver preconditioner
   std::vector<int>           solver_precondition;
 
+  /// Precision of Krylov solver vectors: "default", "single", or
+  /// "mixed" for single with double-precision iterative refinement
+  std::vector<std::string>   solver_precision;
+
+  /// Reduction in the residual between iterative refinement steps
+  std::vector<double>        solver_refine_tol;
+
   /// Whether the solver is for an isolated Block, e.g. for
   /// Mg0 coarse grid solver
   std::vector<int>           solver_local;
 
   std::vector<int>           solver_coarse_level;
+
+  /// Number of V-cycles for the MG0 solver when used as a preconditioner
+  std::vector<int>           solver_cycles;
   std::vector<int>           solver_is_unigrid;
 
   /// Stop at specified redshift for cosmology
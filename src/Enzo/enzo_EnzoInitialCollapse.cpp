@@ -97,9 +97,9 @@ void EnzoInitialCollapse::enforce_block
 
   // Initialize Fields
 
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
 
-  const double gamma = EnzoBlock::Gamma[in];
+  const double gamma = params.Gamma;
   const double energy = 1e-3*(cello::kboltz)*temperature_ / ((gamma - 1.0) * (1.0 * cello::mass_hydrogen));
   
   // ...compute ellipsoid density
@@ -199,11 +199,11 @@ void EnzoInitialGrackleTest::enforce_block
 
   // Finally compute temperature and pressure if fields are tracked
   // for output
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
   int comoving_coordinates = enzo_config->physics_cosmology;
 
   if (pressure){
-    EnzoComputePressure compute_pressure (EnzoBlock::Gamma[in],
+    EnzoComputePressure compute_pressure (params.Gamma,
                                           comoving_coordinates);
 
     // Note: using compute_ method to avoid re-generating grackle_fields
@@ -66,7 +66,7 @@ void EnzoInitialImplosion2::enforce_block
   // WARNING("EnzoInitialImplosion2",
   // 		  "Assumes same ghost zone depth for all fields");
 
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
 
   int mx,my;
   field.dimensions(0,&mx,&my);
@@ -80,12 +80,12 @@ void EnzoInitialImplosion2::enforce_block
 	d[i]  = 0.125;
 	vx[i] = 0.0;
 	vy[i] = 0.0;
-	te[i] = 0.14 / ((EnzoBlock::Gamma[in] - 1.0) * d[i]);
+	te[i] = 0.14 / ((params.Gamma - 1.0) * d[i]);
       } else {
 	d[i]  = 1.0;
 	vx[i] = 0.0;
 	vy[i] = 0.0;
-	te[i] = 1.0 / ((EnzoBlock::Gamma[in] - 1.0) * d[i]);
+	te[i] = 1.0 / ((params.Gamma - 1.0) * d[i]);
       }
     }
   }
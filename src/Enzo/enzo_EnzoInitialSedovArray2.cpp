@@ -85,12 +85,12 @@ void EnzoInitialSedovArray2::enforce_block
   const double sedov_radius = radius_relative_/array_[0];
   const double sedov_radius_2 = sedov_radius*sedov_radius;
 
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
 
   const double sedov_te_in = 
-    pressure_in_  / ((EnzoBlock::Gamma[in] - 1.0) * density_);
+    pressure_in_  / ((params.Gamma - 1.0) * density_);
   const double sedov_te_out= 
-    pressure_out_ / ((EnzoBlock::Gamma[in] - 1.0) * density_);
+    pressure_out_ / ((params.Gamma - 1.0) * density_);
 
   int gx,gy;
   field.ghost_depth(0,&gx,&gy);
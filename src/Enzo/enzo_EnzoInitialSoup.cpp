@@ -125,12 +125,12 @@ void EnzoInitialSoup::enforce_block
   double hya = (ypd-ymd) / array_[1];
   double hza = (zpd-zmd) / array_[2];
 
-  const int in = cello::index_static();
+  const EnzoBlockParams & params = EnzoBlock::params();
 
   const double te_in = 
-    pressure_in_  / ((EnzoBlock::Gamma[in] - 1.0) * density_);
+    pressure_in_  / ((params.Gamma - 1.0) * density_);
   const double te_out= 
-    pressure_out_ / ((EnzoBlock::Gamma[in] - 1.0) * density_);
+    pressure_out_ / ((params.Gamma - 1.0) * density_);
 
   // background
   for (int iz=0; iz<mz; iz++) {
@@ -20,10 +20,18 @@ void EnzoMatrixLaplace::matvec (int i_y, int i_x, Block * block,
   field.dimensions(0,&mx_,&my_,&mz_);
   block->cell_width (&hx_,&hy_,&hz_);
   
-  enzo_float * X = (enzo_float * ) field.values(i_x);
-  enzo_float * Y = (enzo_float * ) field.values(i_y);
-  
-  matvec_(Y,X,g0);
+  // Precision of the vectors, which may differ from enzo_float for
+  // solver temporaries, e.g. for mixed-precision Krylov solvers
+
+  const int precision = field.precision(i_x);
+
+  ASSERT3 ("EnzoMatrixLaplace::matvec()",
+	   "Field %d precision %d differs from field %d",
+	   i_y,field.precision(i_y),i_x,
+	   precision == field.precision(i_y));
+
+  matvec (precision_type(precision),
+	  field.values(i_y),field.values(i_x),g0);
 }
 
 //----------------------------------------------------------------------
@@ -32,7 +40,18 @@ void EnzoMatrixLaplace::matvec
 (precision_type precision,
  void * y, void * x, int g0) throw()
 {
-  matvec_((enzo_float *)(y),(enzo_float *)(x),g0);
+  if (precision == precision_single) {
+    matvec_((float *)(y),(const float *)(x),g0);
+  } else if (precision == precision_double) {
+    matvec_((double *)(y),(const double *)(x),g0);
+  } else if (precision == precision_quadruple) {
+    matvec_((long double *)(y),(const long double *)(x),g0);
+  } else if (precision == precision_default) {
+    matvec_((enzo_float *)(y),(const enzo_float *)(x),g0);
+  } else {
+    ERROR1 ("EnzoMatrixLaplace::matvec()",
+	    "precision %d not recognized", precision);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -44,15 +63,134 @@ void EnzoMatrixLaplace::diagonal (int i_x, Block * block, int g0) throw()
   field.dimensions (i_x,&mx_,&my_,&mz_);
   block->cell_width    (&hx_,&hy_,&hz_);
 
-  enzo_float * X = (enzo_float * ) field.values(i_x);
+  const int precision = field.precision(i_x);
+
+  if (precision == precision_single) {
+    diagonal_((float *) field.values(i_x),g0);
+  } else if (precision == precision_double) {
+    diagonal_((double *) field.values(i_x),g0);
+  } else if (precision == precision_quadruple) {
+    diagonal_((long double *) field.values(i_x),g0);
+  } else {
+    ERROR1 ("EnzoMatrixLaplace::diagonal()",
+	    "precision %d not recognized", precision);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixLaplace::jacobi
+(int i_y, int i_x, int i_b, double w, Block * block, const int g0[3]) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  const int precision = field.precision(i_x);
+
+  ASSERT ("EnzoMatrixLaplace::jacobi()",
+	  "Fields Y, X, and B must have the same precision",
+	  precision == field.precision(i_y) &&
+	  precision == field.precision(i_b));
+
+  if (precision == precision_single) {
+    jacobi_ ((float *) field.values(i_y),
+	     (const float *) field.values(i_x),
+	     (const float *) field.values(i_b), w, g0);
+  } else if (precision == precision_double) {
+    jacobi_ ((double *) field.values(i_y),
+	     (const double *) field.values(i_x),
+	     (const double *) field.values(i_b), w, g0);
+  } else if (precision == precision_quadruple) {
+    jacobi_ ((long double *) field.values(i_y),
+	     (const long double *) field.values(i_x),
+	     (const long double *) field.values(i_b), w, g0);
+  } else {
+    ERROR1 ("EnzoMatrixLaplace::jacobi()",
+	    "precision %d not recognized", precision);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMatrixLaplace::jacobi_
+(T * Y, const T * X, const T * B, double w, const int g0[3]) const throw()
+{
+  // Stencil coefficients c[0..NG] for d2/dx2 scaled by h^2, as in matvec_()
+
+  if (order_ == 2) {
+    const double c[] = { -2.0, 1.0 };
+    jacobi_<1>(Y,X,B,w,c,g0);
+  } else if (order_ == 4) {
+    const double c[] = { -30.0/12.0, 16.0/12.0, -1.0/12.0 };
+    jacobi_<2>(Y,X,B,w,c,g0);
+  } else if (order_ == 6) {
+    const double c[] = { -2720.0/1080.0, 1455.0/1080.0,
+			 -96.0/1080.0, 1.0/1080.0 };
+    jacobi_<3>(Y,X,B,w,c,g0);
+  } else {
+    ERROR1 ("EnzoMatrixLaplace::jacobi()",
+	    "Order %d operator is not supported",
+	    order_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <int NG, class T>
+void EnzoMatrixLaplace::jacobi_
+(T * Y, const T * X, const T * B,
+ double w, const double c[], const int g0[3]) const throw()
+{
+  const int rank = cello::rank();
+
+  const int m3[3] = { mx_, my_, mz_ };
+  const int d3[3] = { 1, mx_, mx_*my_ };
+  const double h3[3] = { hx_, hy_, hz_ };
+
+  // per-axis stencil coefficients and the (constant) diagonal
 
-  diagonal_(X,g0);
+  T ca[3][NG+1];
+  double diagonal = 0.0;
+  for (int axis=0; axis<rank; axis++) {
+    const double h2 = 1.0 / (h3[axis]*h3[axis]);
+    for (int r=0; r<=NG; r++) ca[axis][r] = c[r]*h2;
+    diagonal += c[0]*h2;
+  }
+  const T c0 = diagonal;
+  const T wd = w / diagonal;
+
+  int i0[3],i1[3];
+  for (int axis=0; axis<3; axis++) {
+    i0[axis] = (axis < rank) ? g0[axis] : 0;
+    i1[axis] = m3[axis] - i0[axis];
+  }
+
+  for (int iz=i0[2]; iz<i1[2]; iz++) {
+    for (int iy=i0[1]; iy<i1[1]; iy++) {
+      for (int ix=i0[0]; ix<i1[0]; ix++) {
+	const int i = ix + mx_*(iy + my_*iz);
+	const T * xp = X + i;
+	T ax = c0*xp[0];
+	for (int axis=0; axis<rank; axis++) {
+	  const int d = d3[axis];
+	  for (int r=1; r<=NG; r++) {
+	    ax += ca[axis][r]*(xp[-r*d] + xp[r*d]);
+	  }
+	}
+	Y[i] = xp[0] + wd*(B[i] - ax);
+      }
+    }
+  }
 }
 
 //----------------------------------------------------------------------
 
+template <class T>
 void EnzoMatrixLaplace::matvec_
-(enzo_float * Y, enzo_float * X, int g0) const throw()
+(T * Y, const T * X, int g0) const throw()
 {
   const int idx = 1;
   const int idy = mx_;
@@ -104,22 +242,22 @@ void EnzoMatrixLaplace::matvec_
 
     g0 = std::max(2,g0);
 
-    const enzo_float c0 = -30.0;
-    const enzo_float c1 = 16.0;
-    const enzo_float c2 = -1.0;
-    const enzo_float dx = (rank >= 1) ? 1.0/(12.0*hx_*hx_) : 0.0;
-    const enzo_float dy = (rank >= 2) ? 1.0/(12.0*hy_*hy_) : 0.0;
-    const enzo_float dz = (rank >= 3) ? 1.0/(12.0*hz_*hz_) : 0.0;
-
-    const enzo_float c0x = c0*dx;
-    const enzo_float c1x = c1*dx;
-    const enzo_float c2x = c2*dx;
-    const enzo_float c0y = c0*dy;
-    const enzo_float c1y = c1*dy;
-    const enzo_float c2y = c2*dy;
-    const enzo_float c0z = c0*dz;
-    const enzo_float c1z = c1*dz;
-    const enzo_float c2z = c2*dz;
+    const T c0 = -30.0;
+    const T c1 = 16.0;
+    const T c2 = -1.0;
+    const T dx = (rank >= 1) ? 1.0/(12.0*hx_*hx_) : 0.0;
+    const T dy = (rank >= 2) ? 1.0/(12.0*hy_*hy_) : 0.0;
+    const T dz = (rank >= 3) ? 1.0/(12.0*hz_*hz_) : 0.0;
+
+    const T c0x = c0*dx;
+    const T c1x = c1*dx;
+    const T c2x = c2*dx;
+    const T c0y = c0*dy;
+    const T c1y = c1*dy;
+    const T c2y = c2*dy;
+    const T c0z = c0*dz;
+    const T c1z = c1*dz;
+    const T c2z = c2*dz;
 
     if (rank == 1) {
 
@@ -150,7 +288,7 @@ void EnzoMatrixLaplace::matvec_
 	for   (int iy=g0; iy<my_-g0; iy++) {
 	  for (int ix=g0; ix<mx_-g0; ix++) {
 	    const int i = ix + mx_*(iy + my_*iz);
-	    enzo_float * xp = X + i;
+	    const T * xp = X + i;
 	    Y[i] = (c0x*(xp[0]) +
 		    c1x*(xp[-idx] +xp[idx]) +
 		    c2x*(xp[-idx2]+xp[idx2]))
@@ -175,13 +313,13 @@ void EnzoMatrixLaplace::matvec_
 
     g0 = std::max(3,g0);
 
-    const enzo_float c0 = -2720.0;
-    const enzo_float c1 = 1455.0;
-    const enzo_float c2 = -96.0;
-    const enzo_float c3 = 1.0;
-    const enzo_float dx = (rank >= 1) ? 1.0/(1080.0*hx_*hx_) : 0.0;
-    const enzo_float dy = (rank >= 2) ? 1.0/(1080.0*hy_*hy_) : 0.0;
-    const enzo_float dz = (rank >= 3) ? 1.0/(1080.0*hz_*hz_) : 0.0;
+    const T c0 = -2720.0;
+    const T c1 = 1455.0;
+    const T c2 = -96.0;
+    const T c3 = 1.0;
+    const T dx = (rank >= 1) ? 1.0/(1080.0*hx_*hx_) : 0.0;
+    const T dy = (rank >= 2) ? 1.0/(1080.0*hy_*hy_) : 0.0;
+    const T dz = (rank >= 3) ? 1.0/(1080.0*hz_*hz_) : 0.0;
 
     if (rank == 1) {
 
@@ -222,7 +360,7 @@ void EnzoMatrixLaplace::matvec_
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idy] +X[i+idy]) +
 		    c2*(X[i-idy2]+X[i+idy2]) +
-		    c2*(X[i-idy3]+X[i+idy3])) * dy
+		    c3*(X[i-idy3]+X[i+idy3])) * dy
 	      +    (c0*(X[i]) +
 		    c1*(X[i-idz] +X[i+idz]) +
 		    c2*(X[i-idz2]+X[i+idz2]) +
@@ -240,7 +378,8 @@ void EnzoMatrixLaplace::matvec_
 
 //----------------------------------------------------------------------
 
-void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
+template <class T>
+void EnzoMatrixLaplace::diagonal_ (T * X, int g0) const throw()
 {
   const int rank = cello::rank();
 
@@ -282,10 +421,10 @@ void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
 
   } else if (order_ == 4) {
 
-    const enzo_float c0 = -30.0;
-    const enzo_float dx = (rank >= 1) ? 1.0/(12.0*hx_*hx_) : 0.0;
-    const enzo_float dy = (rank >= 2) ? 1.0/(12.0*hy_*hy_) : 0.0;
-    const enzo_float dz = (rank >= 3) ? 1.0/(12.0*hz_*hz_) : 0.0;
+    const T c0 = -30.0;
+    const T dx = (rank >= 1) ? 1.0/(12.0*hx_*hx_) : 0.0;
+    const T dy = (rank >= 2) ? 1.0/(12.0*hy_*hy_) : 0.0;
+    const T dz = (rank >= 3) ? 1.0/(12.0*hz_*hz_) : 0.0;
 
     g0 = std::max(2,g0);
 
@@ -323,10 +462,10 @@ void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
 
     // Sixth-order 19-point discretization
 
-    const enzo_float c0 = -2720.0;
-    const enzo_float dx = (rank >= 1) ? 1.0/(1080.0*hx_*hx_) : 0.0;
-    const enzo_float dy = (rank >= 2) ? 1.0/(1080.0*hy_*hy_) : 0.0;
-    const enzo_float dz = (rank >= 3) ? 1.0/(1080.0*hz_*hz_) : 0.0;
+    const T c0 = -2720.0;
+    const T dx = (rank >= 1) ? 1.0/(1080.0*hx_*hx_) : 0.0;
+    const T dy = (rank >= 2) ? 1.0/(1080.0*hy_*hy_) : 0.0;
+    const T dz = (rank >= 3) ? 1.0/(1080.0*hz_*hz_) : 0.0;
       
     if (rank == 1) {
       
@@ -76,6 +76,15 @@ public: // interface
     hy_ = hy;
     hz_ = hz;
   }
+
+  /// Set array dimensions.  Required for lower-level methods that
+  /// don't have access to the Block
+  void set_dimensions (int mx, int my, int mz)
+  {
+    mx_ = mx;
+    my_ = my;
+    mz_ = mz;
+  }
   
 public: // virtual functions
 
@@ -91,6 +100,14 @@ public: // virtual functions
   /// Extract the diagonal into the given field
   virtual void diagonal (int id_x, Block * block, int g0=1) throw();
 
+  /// Weighted Jacobi sweep Y <-- X + w*(B - A*X) / diag(A), fusing
+  /// diagonal(), matvec(), and residual() into a single pass over
+  /// zones at least g0[axis] from the array edges.  Y and X must be
+  /// different fields, and g0 must be at least ghost_depth() along
+  /// each active axis
+  void jacobi (int id_y, int id_x, int id_b, double w,
+	       Block * block, const int g0[3]) throw();
+
   /// Whether the matrix is singular or not
   virtual bool is_singular() const throw()
   { return true; }
@@ -99,11 +116,25 @@ public: // virtual functions
   virtual int ghost_depth() const throw()
   { return (order_ == 2) ? 1 : ( (order_ == 4) ? 2 : 3); }
 
+  /// Order of the operator
+  int order() const throw()
+  { return order_; }
+
 protected: // functions
 
-  void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
+  template <class T>
+  void matvec_ (T * Y, const T * X, int g0) const throw();
+
+  template <class T>
+  void diagonal_ (T * X, int g0) const throw();
+
+  template <class T>
+  void jacobi_ (T * Y, const T * X, const T * B,
+		double w, const int g0[3]) const throw();
 
-  void diagonal_ (enzo_float * X, int g0) const throw();
+  template <int NG, class T>
+  void jacobi_ (T * Y, const T * X, const T * B,
+		double w, const double c[], const int g0[3]) const throw();
 
 protected: // attributes
 
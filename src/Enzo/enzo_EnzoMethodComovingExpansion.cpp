@@ -99,7 +99,7 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
 
       /* If we can, compute the pressure at the mid-point.
       	 We can, because we will always have an old baryon field now. */
-      const int in = cello::index_static();
+      EnzoBlockParams params = EnzoBlock::params();
 
       // hard-code hydromethod for PPM for now
       int HydroMethod = 0;
@@ -150,7 +150,7 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
 
       // Compute the pressure *now*
       enzo_float * pressure_now     = (enzo_float *) field.values("pressure");
-      EnzoComputePressure compute_pressure (EnzoBlock::Gamma[in],
+      EnzoComputePressure compute_pressure (params.Gamma,
                                             comoving_coordinates_);
       compute_pressure.compute(block, pressure_now);
 
@@ -158,7 +158,7 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
       enzo_float * pressure = NULL;
 
       if (has_history) {
-        EnzoComputePressure compute_pressure_old (EnzoBlock::Gamma[in],
+        EnzoComputePressure compute_pressure_old (params.Gamma,
                                                  comoving_coordinates_);
         compute_pressure_old.set_history(i_old);
 
@@ -181,8 +181,8 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
 
       FORTRAN_NAME(expand_terms)
 	(
-	 &rank, &m, &EnzoBlock::DualEnergyFormalism[in], &Coefficient,
-	 (int*) &HydroMethod, &EnzoBlock::Gamma[in],
+	 &rank, &m, &params.DualEnergyFormalism, &Coefficient,
+	 (int*) &HydroMethod, &params.Gamma,
 	 pressure,
 	 density_new, total_energy_new, internal_energy_new,
 	 velocity_x_new, velocity_y_new, velocity_z_new,
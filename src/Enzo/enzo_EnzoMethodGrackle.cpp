@@ -123,6 +123,9 @@ EnzoMethodGrackle::EnzoMethodGrackle
                        enzo_sync_id_method_grackle);
   refresh(ir)->add_all_fields();
 
+  batch_count_ = 0;
+  batch_leaf_count_ = 0;
+
   /// Define Grackle's internal data structures
   grackle_chemistry_data_defined_ = false;
   this->initialize_grackle_chemistry_data(time);
@@ -135,34 +138,43 @@ EnzoMethodGrackle::EnzoMethodGrackle
 void EnzoMethodGrackle::compute ( Block * block) throw()
 {
 
-  if (block->is_leaf()){
-
-  #ifndef CONFIG_USE_GRACKLE
+#ifndef CONFIG_USE_GRACKLE
 
+  if (block->is_leaf()){
     ERROR("EnzoMethodGrackle::compute()",
     "Trying to use method 'grackle' with "
     "Grackle configuration turned off!");
+  }
 
-  #else /* CONFIG_USE_GRACKLE */
+#else /* CONFIG_USE_GRACKLE */
 
-    EnzoBlock * enzo_block = enzo::block(block);
+  EnzoBlock * enzo_block = enzo::block(block);
 
-    // Start timer
-    Simulation * simulation = cello::simulation();
-    if (simulation)
-      simulation->performance()->start_region(perf_grackle,__FILE__,__LINE__);
+  // Start timer
+  Simulation * simulation = cello::simulation();
+  if (simulation)
+    simulation->performance()->start_region(perf_grackle,__FILE__,__LINE__);
 
-    this->initialize_grackle_chemistry_data(block->time());
+  if (enzo::config()->method_grackle_batch_size > 0) {
 
-    this->compute_(enzo_block);
+    // compute_done() is called when the Block's batch is solved
+    this->compute_batch_(enzo_block);
 
-    enzo_block->compute_done();
+  } else {
+
+    if (block->is_leaf()){
+      this->initialize_grackle_chemistry_data(block->time());
+      this->compute_(enzo_block);
+    }
 
-    if (simulation)
-      simulation->performance()->stop_region(perf_grackle,__FILE__,__LINE__);
-  #endif
+    enzo_block->compute_done();
   }
 
+  if (simulation)
+    simulation->performance()->stop_region(perf_grackle,__FILE__,__LINE__);
+
+#endif /* CONFIG_USE_GRACKLE */
+
   return;
 
 }
@@ -275,7 +287,101 @@ void EnzoMethodGrackle::setup_grackle_fields(EnzoBlock * enzo_block,
                                              grackle_field_data * grackle_fields_,
                                              int i_hist /*default 0 */
                                              ) throw()
+{
+  int grid[9];
+  bind_grackle_fields_(enzo_block, grackle_fields_, grid, i_hist);
+
+  // grid arrays deallocated in delete_grackle_fields()
+  grackle_fields_->grid_dimension = new int[3];
+  grackle_fields_->grid_start     = new int[3];
+  grackle_fields_->grid_end       = new int[3];
+
+  for (int i=0; i<3; i++){
+    grackle_fields_->grid_dimension[i] = grid[i];
+    grackle_fields_->grid_start[i]     = grid[i+3];
+    grackle_fields_->grid_end[i]       = grid[i+6];
+  }
+
+  return;
+}
+
+//----------------------------------------------------------------------------
+
+grackle_field_data * EnzoMethodGrackle::grackle_fields
+(EnzoBlock * enzo_block) throw()
+{
+  grackle_field_data * grackle_fields_ = &enzo_block->grackle_fields_;
+
+  // Field data is allocated once per Block, so the binding is only
+  // stale if the density array has moved
+
+  Field field = enzo_block->data()->field();
+  const int id_density = field.field_id("density");
+
+  if (grackle_fields_->density != (gr_float *) field.values(id_density)) {
+    bind_grackle_fields_(enzo_block, grackle_fields_,
+                         enzo_block->grackle_grid_, 0);
+  }
+
+  return grackle_fields_;
+}
+
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Fields bound to grackle_field_data members, in the same order as
+  // grackle_field_member below
+
+  const int num_grackle_fields = 18;
+
+  const char * grackle_field_name[num_grackle_fields] = {
+    "density", "internal_energy",
+    "velocity_x", "velocity_y", "velocity_z",
+    "HI_density", "HII_density",
+    "HeI_density", "HeII_density", "HeIII_density", "e_density",
+    "HM_density", "H2I_density", "H2II_density",
+    "DI_density", "DII_density", "HDI_density",
+    "metal_density"
+  };
+
+  gr_float * grackle_field_data::* grackle_field_member[num_grackle_fields] = {
+    &grackle_field_data::density, &grackle_field_data::internal_energy,
+    &grackle_field_data::x_velocity, &grackle_field_data::y_velocity,
+    &grackle_field_data::z_velocity,
+    &grackle_field_data::HI_density, &grackle_field_data::HII_density,
+    &grackle_field_data::HeI_density, &grackle_field_data::HeII_density,
+    &grackle_field_data::HeIII_density, &grackle_field_data::e_density,
+    &grackle_field_data::HM_density, &grackle_field_data::H2I_density,
+    &grackle_field_data::H2II_density,
+    &grackle_field_data::DI_density, &grackle_field_data::DII_density,
+    &grackle_field_data::HDI_density,
+    &grackle_field_data::metal_density
+  };
+
+  // Field ids, or -1 if undefined, looked up on first use
+
+  std::vector<int> grackle_field_ids_()
   {
+    FieldDescr * field_descr = cello::field_descr();
+    std::vector<int> ids (num_grackle_fields);
+    for (int i=0; i<num_grackle_fields; i++) {
+      ids[i] = field_descr->is_field(grackle_field_name[i]) ?
+        field_descr->field_id(grackle_field_name[i]) : -1;
+    }
+    return ids;
+  }
+
+}
+
+//----------------------------------------------------------------------------
+
+void EnzoMethodGrackle::bind_grackle_fields_(EnzoBlock * enzo_block,
+                                             grackle_field_data * grackle_fields_,
+                                             int * grid,
+                                             int i_hist) throw()
+{
+  static const std::vector<int> id = grackle_field_ids_();
 
   // Setup Grackle field struct for storing field data
   Field field = enzo_block->data()->field();
@@ -286,80 +392,41 @@ void EnzoMethodGrackle::setup_grackle_fields(EnzoBlock * enzo_block,
   int nx,ny,nz;
   field.size (&nx,&ny,&nz);
 
-  int ngx = nx + 2*gx;
-  int ngy = ny + 2*gy;
-  int ngz = nz + 2*gz;
+  int * grid_dimension = grid;
+  int * grid_start     = grid + 3;
+  int * grid_end       = grid + 6;
 
-  gr_int grid_dimension[3] = {ngx, ngy, ngz};
-  gr_int grid_start[3]     = {gx,      gy,      gz};
-  gr_int grid_end[3]       = {gx+nx-1, gy+ny-1, gz+nz-1} ;
-
-  const gr_int rank = cello::rank();
+  grid_dimension[0] = nx + 2*gx;
+  grid_dimension[1] = ny + 2*gy;
+  grid_dimension[2] = nz + 2*gz;
+  grid_start[0] = gx;
+  grid_start[1] = gy;
+  grid_start[2] = gz;
+  grid_end[0] = gx+nx-1;
+  grid_end[1] = gy+ny-1;
+  grid_end[2] = gz+nz-1;
 
   // Grackle grid dimenstion and grid size
-  grackle_fields_->grid_rank      = rank;
-  grackle_fields_->grid_dimension = new int[3];
-  grackle_fields_->grid_start     = new int[3];
-  grackle_fields_->grid_end       = new int[3];
-
-  for (int i=0; i<3; i++){
-    grackle_fields_->grid_dimension[i] = grid_dimension[i];
-    grackle_fields_->grid_start[i]     = grid_start[i];
-    grackle_fields_->grid_end[i]       = grid_end[i];
-  }
+  grackle_fields_->grid_rank      = cello::rank();
+  grackle_fields_->grid_dimension = grid_dimension;
+  grackle_fields_->grid_start     = grid_start;
+  grackle_fields_->grid_end       = grid_end;
 
   double hx, hy, hz;
   enzo_block->cell_width(&hx,&hy,&hz);
   grackle_fields_->grid_dx = hx;
 
-  // Setup all fields to be passed into grackle
-  grackle_fields_->density         = (gr_float *) field.values("density", i_hist);
-  grackle_fields_->internal_energy = (gr_float *) field.values("internal_energy", i_hist);
-  grackle_fields_->x_velocity      = (gr_float *) field.values("velocity_x", i_hist);
-  grackle_fields_->y_velocity      = (gr_float *) field.values("velocity_y", i_hist);
-  grackle_fields_->z_velocity      = (gr_float *) field.values("velocity_z", i_hist);
-
-  // Get chemical species fields if they exist
-
-  // primordial_chemistry == 0 fields
-  grackle_fields_->HI_density      = field.is_field("HI_density") ?
-                       (gr_float *) field.values("HI_density", i_hist)     : NULL;
-  grackle_fields_->HII_density     = field.is_field("HII_density") ?
-                       (gr_float *) field.values("HII_density", i_hist)    : NULL;;
-  grackle_fields_->HeI_density     = field.is_field("HeI_density") ?
-                       (gr_float *) field.values("HeI_density", i_hist)    : NULL;
-  grackle_fields_->HeII_density    = field.is_field("HeII_density") ?
-                       (gr_float *) field.values("HeII_density", i_hist)   : NULL;
-  grackle_fields_->HeIII_density   = field.is_field("HeIII_density") ?
-                       (gr_float *) field.values("HeIII_density", i_hist)  : NULL;
-  grackle_fields_->e_density       = field.is_field("e_density") ?
-                       (gr_float *) field.values("e_density", i_hist)      : NULL;
-
-  // primordial_chemistry == 1 fields
-  grackle_fields_->HM_density      = field.is_field("HM_density") ?
-                       (gr_float *) field.values("HM_density", i_hist)     : NULL;
-  grackle_fields_->H2I_density     = field.is_field("H2I_density") ?
-                       (gr_float *) field.values("H2I_density", i_hist) : NULL;
-  grackle_fields_->H2II_density    = field.is_field("H2II_density") ?
-                       (gr_float *) field.values("H2II_density", i_hist) : NULL;
-
-  // primordial_chemistry == 2 fields
-  grackle_fields_->DI_density      = field.is_field("DI_density") ?
-                       (gr_float *) field.values("DI_density", i_hist) : NULL;
-  grackle_fields_->DII_density     = field.is_field("DII_density") ?
-                       (gr_float *) field.values("DII_density", i_hist) : NULL;
-  grackle_fields_->HDI_density     = field.is_field("HDI_density") ?
-                       (gr_float *) field.values("HDI_density", i_hist) : NULL;
-
-  grackle_fields_->metal_density   = field.is_field("metal_density") ?
-                       (gr_float *) field.values("metal_density", i_hist) : NULL;
+  // Setup all fields to be passed into grackle, including chemical
+  // species fields if they exist
 
-  /* Leave these as NULL for now and save for future development */
-  gr_float * volumetric_heating_rate = NULL;
-  gr_float * specific_heating_rate = NULL;
+  for (int i=0; i<num_grackle_fields; i++) {
+    grackle_fields_->*grackle_field_member[i] = (id[i] >= 0) ?
+      (gr_float *) field.values(id[i], i_hist) : NULL;
+  }
 
-  grackle_fields_->volumetric_heating_rate = volumetric_heating_rate;
-  grackle_fields_->specific_heating_rate   = specific_heating_rate;
+  /* Leave these as NULL for now and save for future development */
+  grackle_fields_->volumetric_heating_rate = NULL;
+  grackle_fields_->specific_heating_rate   = NULL;
 
   return;
 }
@@ -429,9 +496,37 @@ void EnzoMethodGrackle::update_grackle_density_fields(
 void EnzoMethodGrackle::compute_ ( EnzoBlock * enzo_block) throw()
 {
 
-  EnzoUnits * enzo_units = enzo::units();
   const EnzoConfig * enzo_config = enzo::config();
 
+  /* Set code units for use in grackle */
+  setup_grackle_units(enzo_block, &this->grackle_units_);
+
+  grackle_field_data * grackle_fields_ = grackle_fields(enzo_block);
+
+  // Solve chemistry
+  double dt = enzo_block->dt;
+  if (solve_chemistry(&grackle_units_, grackle_fields_, dt) == ENZO_FAIL) {
+    ERROR("EnzoMethodGrackle::compute()",
+    "Error in solve_chemistry.\n");
+  }
+
+  correct_total_energy_(enzo_block);
+
+  // For testing purposes - reset internal energies with changes in mu
+  if (enzo_config->initial_grackle_test_reset_energies){
+    this->ResetEnergies(enzo_block);
+  }
+
+  return;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::correct_total_energy_ ( EnzoBlock * enzo_block) throw()
+{
+  /* Correct total energy for changes in internal energy, in the
+     active zones updated by Grackle */
+
   Field field = enzo_block->data()->field();
 
   int gx,gy,gz;
@@ -440,45 +535,240 @@ void EnzoMethodGrackle::compute_ ( EnzoBlock * enzo_block) throw()
   int nx,ny,nz;
   field.size (&nx,&ny,&nz);
 
-  int ngx = nx + 2*gx;
-  int ngy = ny + 2*gy;
-  int ngz = nz + 2*gz;
+  const int ngx = nx + 2*gx;
+  const int ngy = ny + 2*gy;
 
   const int rank = cello::rank();
 
-  /* Set code units for use in grackle */
-  grackle_field_data grackle_fields_;
+  grackle_field_data * grackle_fields_ = grackle_fields(enzo_block);
 
-  setup_grackle_units(enzo_block, &this->grackle_units_);
-  setup_grackle_fields(enzo_block, &grackle_fields_);
+  enzo_float * te = (enzo_float *) field.values("total_energy");
+  const gr_float * e  = grackle_fields_->internal_energy;
+  const gr_float * vx = grackle_fields_->x_velocity;
+  const gr_float * vy = grackle_fields_->y_velocity;
+  const gr_float * vz = grackle_fields_->z_velocity;
 
-  // Solve chemistry
-  double dt = enzo_block->dt;
-  if (solve_chemistry(&grackle_units_, &grackle_fields_, dt) == ENZO_FAIL) {
-    ERROR("EnzoMethodGrackle::compute()",
+  for (int iz=gz; iz<gz+nz; iz++) {
+    for (int iy=gy; iy<gy+ny; iy++) {
+      const int i0 = gx + ngx*(iy + ngy*iz);
+      if (rank == 1) {
+        for (int i=i0; i<i0+nx; i++) {
+          te[i] = e[i] + 0.5*vx[i]*vx[i];
+        }
+      } else if (rank == 2) {
+        for (int i=i0; i<i0+nx; i++) {
+          te[i] = e[i] + 0.5*(vx[i]*vx[i] + vy[i]*vy[i]);
+        }
+      } else {
+        for (int i=i0; i<i0+nx; i++) {
+          te[i] = e[i] + 0.5*(vx[i]*vx[i] + vy[i]*vy[i] + vz[i]*vz[i]);
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_batch_ ( EnzoBlock * enzo_block) throw()
+{
+  const int batch_size = enzo::config()->method_grackle_batch_size;
+
+  // Non-leaf Blocks do not join a batch and continue immediately
+
+  if (! enzo_block->is_leaf()) {
+    enzo_block->compute_done();
+    return;
+  }
+
+  // Count the leaf Blocks on this process when the first one joins,
+  // since only these will join a batch this cycle
+
+  if (batch_count_ == 0) {
+    Hierarchy * hierarchy = cello::hierarchy();
+    const int num_blocks = hierarchy->num_blocks();
+    batch_leaf_count_ = 0;
+    for (int i=0; i<num_blocks; i++) {
+      if (hierarchy->block(i)->is_leaf()) ++batch_leaf_count_;
+    }
+  }
+
+  ++batch_count_;
+
+  this->initialize_grackle_chemistry_data(enzo_block->time());
+
+  int nx,ny,nz;
+  enzo_block->data()->field().size (&nx,&ny,&nz);
+
+  double hx,hy,hz;
+  enzo_block->cell_width(&hx,&hy,&hz);
+
+  const int level = enzo_block->level();
+
+  // Solve the current batch first if this Block would overflow it,
+  // or if its cell width differs, since Grackle takes a single dx
+  // per grid
+
+  std::vector<EnzoBlock *> & blocks = batch_blocks_[level];
+  if (! blocks.empty() &&
+      (batch_cells_[level] + nx*ny*nz > batch_size ||
+       batch_dx_[level] != hx)) solve_batch_(level);
+
+  blocks.push_back(enzo_block);
+  batch_cells_[level] += nx*ny*nz;
+  batch_dx_[level] = hx;
+
+  if (batch_cells_[level] >= batch_size) solve_batch_(level);
+
+  // Solve remaining batches when the last leaf Block on this process
+  // has joined
+
+  if (batch_count_ == batch_leaf_count_) {
+    batch_count_ = 0;
+  batch_leaf_count_ = 0;
+    std::map<int, std::vector<EnzoBlock *> >::iterator it;
+    for (it=batch_blocks_.begin(); it!=batch_blocks_.end(); ++it) {
+      if (! it->second.empty()) solve_batch_(it->first);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::solve_batch_ ( int level ) throw()
+{
+  const EnzoConfig * enzo_config = enzo::config();
+
+  // Remove the batch first, so that Blocks joining while the
+  // resume messages are pending start a new batch
+
+  std::vector<EnzoBlock *> blocks;
+  blocks.swap(batch_blocks_[level]);
+  const int n = batch_cells_[level];
+  batch_cells_[level] = 0;
+
+  const int num_blocks = blocks.size();
+
+  int gx,gy,gz;
+  int nx,ny,nz;
+  {
+    Field field = blocks[0]->data()->field();
+    field.ghost_depth (0,&gx,&gy,&gz);
+    field.size (&nx,&ny,&nz);
+  }
+  const int ngx = nx + 2*gx;
+  const int ngy = ny + 2*gy;
+  const int m = nx*ny*nz;
+
+  ASSERT2 ("EnzoMethodGrackle::solve_batch_()",
+           "Batch size %d is not a multiple of the block size %d",
+           n, m, n == m*num_blocks);
+
+  // Pack the active cells of each field defined into contiguous
+  // arrays, in Block order
+
+  static const std::vector<int> id = grackle_field_ids_();
+
+  int num_fields = 0;
+  for (int i=0; i<num_grackle_fields; i++) {
+    if (id[i] >= 0) ++num_fields;
+  }
+
+  batch_buffer_.resize(num_fields*n);
+
+  grackle_field_data batch_fields;
+  memset(&batch_fields,0,sizeof(batch_fields));
+
+  for (int i=0,k=0; i<num_grackle_fields; i++) {
+    if (id[i] < 0) continue;
+    gr_float * b = &batch_buffer_[(k++)*n];
+    batch_fields.*grackle_field_member[i] = b;
+    for (int ib=0; ib<num_blocks; ib++) {
+      const gr_float * f = grackle_fields(blocks[ib])->*grackle_field_member[i];
+      for (int iz=gz; iz<gz+nz; iz++) {
+        for (int iy=gy; iy<gy+ny; iy++) {
+          const int i0 = gx + ngx*(iy + ngy*iz);
+          std::copy (f + i0, f + i0 + nx, b);
+          b += nx;
+        }
+      }
+    }
+  }
+
+  // Solve the batch as a single one-dimensional grid
+
+  int grid_dimension[3] = {n,1,1};
+  int grid_start[3]     = {0,0,0};
+  int grid_end[3]       = {n-1,0,0};
+
+  batch_fields.grid_rank      = 1;
+  batch_fields.grid_dimension = grid_dimension;
+  batch_fields.grid_start     = grid_start;
+  batch_fields.grid_end       = grid_end;
+
+  // Batches only contain Blocks of equal cell width
+
+  batch_fields.grid_dx = batch_dx_[level];
+
+  setup_grackle_units(blocks[0], &this->grackle_units_);
+
+  const double dt = blocks[0]->dt;
+  if (solve_chemistry(&grackle_units_, &batch_fields, dt) == ENZO_FAIL) {
+    ERROR("EnzoMethodGrackle::solve_batch_()",
     "Error in solve_chemistry.\n");
   }
 
-  /* Correct total energy for changes in internal energy */
-  enzo_float * total_energy    = (enzo_float *) field.values("total_energy");
-  for (int i = 0; i < ngx*ngy*ngz; i++){
-    total_energy[i] = grackle_fields_.internal_energy[i] +
-            0.5 * grackle_fields_.x_velocity[i] * grackle_fields_.x_velocity[i];
-    if (rank > 1) total_energy[i] += 0.5 * grackle_fields_.y_velocity[i] * grackle_fields_.y_velocity[i];
-    if (rank > 2) total_energy[i] += 0.5 * grackle_fields_.z_velocity[i] * grackle_fields_.z_velocity[i];
+  // Unpack the fields updated by Grackle: internal energy and species
+
+  for (int i=0; i<num_grackle_fields; i++) {
+    gr_float * b = batch_fields.*grackle_field_member[i];
+    if (b == NULL ||
+        b == batch_fields.density ||
+        b == batch_fields.x_velocity ||
+        b == batch_fields.y_velocity ||
+        b == batch_fields.z_velocity ||
+        b == batch_fields.metal_density) continue;
+    for (int ib=0; ib<num_blocks; ib++) {
+      gr_float * f = grackle_fields(blocks[ib])->*grackle_field_member[i];
+      for (int iz=gz; iz<gz+nz; iz++) {
+        for (int iy=gy; iy<gy+ny; iy++) {
+          const int i0 = gx + ngx*(iy + ngy*iz);
+          std::copy (b, b + nx, f + i0);
+          b += nx;
+        }
+      }
+    }
   }
 
-  // For testing purposes - reset internal energies with changes in mu
-  if (enzo_config->initial_grackle_test_reset_energies){
-    this->ResetEnergies(enzo_block);
+  for (int ib=0; ib<num_blocks; ib++) {
+    correct_total_energy_(blocks[ib]);
+    // For testing purposes - reset internal energies with changes in mu
+    if (enzo_config->initial_grackle_test_reset_energies){
+      this->ResetEnergies(blocks[ib]);
+    }
   }
 
-  return;
+  // Resume each Block through a message to itself rather than
+  // calling compute_done() here, which for all but the Block that
+  // filled the batch would be from within another Block's compute()
+
+  for (int ib=0; ib<num_blocks; ib++) {
+    enzo::block_array()[blocks[ib]->index()].p_method_grackle_batch_done();
+  }
 }
 #endif // config use grackle
 
 //----------------------------------------------------------------------
 
+void EnzoBlock::p_method_grackle_batch_done()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+  compute_done();
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodGrackle::timestep ( Block * block ) throw()
 {
   const EnzoConfig * config = enzo::config();
@@ -512,12 +802,10 @@ double EnzoMethodGrackle::timestep ( Block * block ) throw()
       delete_cooling_time = true;
     }
 
-    grackle_field_data grackle_fields_;
-
     setup_grackle_units(enzo_block,  &grackle_units_);
-    setup_grackle_fields(enzo_block, &grackle_fields_);
+    grackle_field_data * grackle_fields_ = grackle_fields(enzo_block);
 
-    if (calculate_cooling_time(&grackle_units_, &grackle_fields_, cooling_time) == ENZO_FAIL) {
+    if (calculate_cooling_time(&grackle_units_, grackle_fields_, cooling_time) == ENZO_FAIL) {
       ERROR("EnzoMethodGrackle::compute()",
       "Error in calculate_cooling_time.\n");
     }
@@ -528,8 +816,6 @@ double EnzoMethodGrackle::timestep ( Block * block ) throw()
       delete [] cooling_time;
     }
 
-    delete_grackle_fields(&grackle_fields_);
-
 
   }
 #endif
@@ -58,6 +58,12 @@ public: // interface
 #ifdef CONFIG_USE_GRACKLE
       , grackle_units_()
       , grackle_chemistry_data_defined_(false)
+      , batch_blocks_()
+      , batch_cells_()
+      , batch_dx_()
+      , batch_count_(0)
+      , batch_leaf_count_(0)
+      , batch_buffer_()
 #endif
     {  }
 
@@ -107,6 +113,11 @@ public: // interface
                                    grackle_field_data * grackle_fields,
                                    int i_hist = 0 ) throw();
 
+  /// Return the Grackle field data for the Block's current fields,
+  /// cached in the EnzoBlock and rebound only if its field data has
+  /// moved.  Must not be passed to delete_grackle_fields()
+  static grackle_field_data * grackle_fields(EnzoBlock * enzo_block) throw();
+
   static void update_grackle_density_fields(EnzoBlock * enzo_block,
                                    grackle_field_data * grackle_fields) throw();
 
@@ -152,12 +163,43 @@ protected: // methods
 #ifdef CONFIG_USE_GRACKLE
   void compute_( EnzoBlock * enzo_block) throw();
 
+  /// Point grackle_fields at the Block's field values for history
+  /// i_hist, with grid arrays stored in grid[9]
+  static void bind_grackle_fields_(EnzoBlock * enzo_block,
+                                   grackle_field_data * grackle_fields,
+                                   int * grid, int i_hist) throw();
+
+  /// Set total energy from internal energy and velocity in the
+  /// Block's active zones
+  static void correct_total_energy_ ( EnzoBlock * enzo_block) throw();
+
+  /// Add the Block to its level's batch, solving batches when full or
+  /// when all leaf Blocks on this process have been added
+  void compute_batch_ ( EnzoBlock * enzo_block) throw();
+
+  /// Pack, solve, and unpack the active cells of the batched Blocks
+  /// in the given level, and resume them with
+  /// p_method_grackle_batch_done()
+  void solve_batch_ ( int level ) throw();
+
   void ResetEnergies ( EnzoBlock * enzo_block) throw();
 
 // protected: // attributes
 
   code_units grackle_units_;
   bool grackle_chemistry_data_defined_;
+
+  /// Batched solves (not PUP'ed): leaf Blocks waiting in each level's
+  /// batch, their total number of active cells and cell width, the
+  /// number of leaf Blocks on this process that have joined a batch
+  /// this cycle and the number expected, and storage for the packed
+  /// field arrays
+  std::map<int, std::vector<EnzoBlock *> > batch_blocks_;
+  std::map<int, int> batch_cells_;
+  std::map<int, double> batch_dx_;
+  int batch_count_;
+  int batch_leaf_count_;
+  std::vector<gr_float> batch_buffer_;
 #endif
 
 };
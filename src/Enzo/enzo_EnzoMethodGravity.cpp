@@ -142,13 +142,31 @@ EnzoMethodGravity::EnzoMethodGravity
 (int index_solver,
  double grav_const,
  int order,
- bool accumulate)
+ bool accumulate,
+ std::string initial_guess)
   : Method(),
     index_solver_(index_solver),
     grav_const_(grav_const),
-    order_(order)
+    order_(order),
+    guess_(gravity_guess_zero)
 {
+  if      (initial_guess == "zero")        guess_ = gravity_guess_zero;
+  else if (initial_guess == "previous")    guess_ = gravity_guess_previous;
+  else if (initial_guess == "extrapolate") guess_ = gravity_guess_extrapolate;
+  else {
+    ERROR1 ("EnzoMethodGravity::EnzoMethodGravity()",
+	    "Unknown Method:gravity:initial_guess \"%s\"",
+	    initial_guess.c_str());
+  }
+
   FieldDescr * field_descr = cello::field_descr();
+
+  if (guess_ == gravity_guess_extrapolate &&
+      field_descr->num_history() < 2) {
+    WARNING ("EnzoMethodGravity::EnzoMethodGravity()",
+	     "initial_guess \"extrapolate\" requires Field:history >= 2; "
+	     "using \"previous\" instead");
+  }
   
   const int id  = field_descr->field_id("density");
   const int idt = field_descr->field_id("density_total");
@@ -350,6 +368,7 @@ void EnzoMethodGravity::compute(Block * block) throw()
 
   solver->set_field_x(ix);
   solver->set_field_b(ib);
+  solver->set_use_guess(initial_guess_(block));
   
   solver->apply (A, block);
 
@@ -357,6 +376,100 @@ void EnzoMethodGravity::compute(Block * block) throw()
 
 //----------------------------------------------------------------------
 
+bool EnzoMethodGravity::initial_guess_ (Block * block) throw()
+{
+  // "potential" still holds the previous cycle's solution divided by
+  // its expansion factor; see compute_accelerations()
+
+  if (guess_ == gravity_guess_zero || ! block->is_leaf() ||
+      block->cycle() == 0) return false;
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (0,&mx,&my,&mz);
+  const int m = mx*my*mz;
+
+  const int ix = field.field_id ("potential");
+  enzo_float * X = (enzo_float*) field.values (ix);
+
+  const double time = block->time();
+  const int nh = field.num_history();
+
+  // History fields are only valid in Blocks that existed in the
+  // previous cycles, so blocks created by refinement or coarsening
+  // cannot extrapolate.  The choice is made for all Blocks from the
+  // cycle number, not from each Block's age, so that neighboring
+  // Blocks build their guesses the same way
+
+  const int since_adapt = cycles_since_adapt_(block->cycle());
+
+  const double t1 = (nh >= 1) ? field.history_time(1) : 0.0;
+  const double t2 = (nh >= 2) ? field.history_time(2) : 0.0;
+
+  const bool has_t1 = (nh >= 1 && since_adapt >= 1 && t1 < time);
+  const bool has_t2 = (nh >= 2 && since_adapt >= 2 && t2 < t1 && has_t1);
+
+  // previous solution, at the expansion factor used when it was scaled
+
+  const double a1 = expansion_factor_
+    (0.5*(time + (has_t1 ? t1 : time - block->dt())));
+
+  if (guess_ == gravity_guess_extrapolate && has_t2) {
+
+    // X = X1 + (t - t1) / (t1 - t2) * (X1 - X2)
+
+    const enzo_float * X2 = (const enzo_float*) field.values (ix,2);
+    const double a2 = expansion_factor_ (0.5*(t1 + t2));
+    const double c = (time - t1) / (t1 - t2);
+
+    for (int i=0; i<m; i++) {
+      const double x1 = a1*X[i];
+      X[i] = x1 + c*(x1 - a2*X2[i]);
+    }
+
+  } else if (a1 != 1.0) {
+
+    for (int i=0; i<m; i++) X[i] *= a1;
+
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodGravity::cycles_since_adapt_ (int cycle) const throw()
+{
+  const Config * config = cello::config();
+
+  // the mesh may change in the initial cycle and in every adapt cycle
+
+  const int since_initial = cycle - config->initial_cycle;
+
+  const int interval = config->adapt_interval;
+  const bool is_adaptive = (interval > 0 && config->mesh_max_level > 0);
+
+  return is_adaptive ?
+    std::min (since_initial, cycle % interval) : since_initial;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodGravity::expansion_factor_ (double time) const throw()
+{
+  EnzoPhysicsCosmology * cosmology = enzo::cosmology();
+
+  if (cosmology == NULL) return 1.0;
+
+  enzo_float cosmo_a = 1.0;
+  enzo_float cosmo_dadt = 0.0;
+  cosmology->compute_expansion_factor (&cosmo_a,&cosmo_dadt,time);
+  return cosmo_a;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoBlock::r_method_gravity_continue()
 {
 
@@ -10,6 +10,14 @@
 #ifndef ENZO_ENZO_METHOD_GRAVITY_HPP
 #define ENZO_ENZO_METHOD_GRAVITY_HPP
 
+/// @enum     gravity_guess_type
+/// @brief    Initial guess for the potential in EnzoMethodGravity
+enum gravity_guess_type {
+  gravity_guess_zero,        // zero (default)
+  gravity_guess_previous,    // previous cycle's potential
+  gravity_guess_extrapolate  // linear extrapolation from two previous cycles
+};
+
 class EnzoMethodGravity : public Method {
 
   /// @class    EnzoMethodGravity
@@ -27,12 +35,14 @@ public: // interface
   EnzoMethodGravity(int index_solver,
 		    double grav_const,
 		    int order,
-		    bool accumulate);
+		    bool accumulate,
+		    std::string initial_guess = "zero");
 
   EnzoMethodGravity()
     : index_solver_(-1),
       grav_const_(0.0),
-      order_(4)
+      order_(4),
+      guess_(gravity_guess_zero)
   {};
 
   /// Destructor
@@ -46,7 +56,8 @@ public: // interface
     : Method (m),
       index_solver_(-1),
       grav_const_(0.0),
-      order_(4)
+      order_(4),
+      guess_(gravity_guess_zero)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -64,6 +75,7 @@ public: // interface
     p | index_solver_;
     p | grav_const_;
     p | order_;
+    p | guess_;
 
   }
 
@@ -83,6 +95,18 @@ protected: // methods
 
   void compute_ (EnzoBlock * enzo_block) throw();
 
+  /// Initialize the potential as the initial guess for the solver,
+  /// returning false if X should be initialized to zero instead
+  bool initial_guess_ (Block * block) throw();
+
+  /// Return the number of cycles since the mesh last may have
+  /// changed, which is the same for all Blocks
+  int cycles_since_adapt_ (int cycle) const throw();
+
+  /// Return the cosmological expansion factor at the given time, or
+  /// 1 if cosmology is not used
+  double expansion_factor_ (double time) const throw();
+
   /// Compute maximum timestep for this method
   double timestep_ (Block * block) const throw() ;
   
@@ -98,6 +122,9 @@ protected: // attributes
   /// (Note EnzoMatrixLaplacian supports order=6 as well)
   int order_;
 
+  /// Initial guess for the potential; see enum gravity_guess_type
+  int guess_;
+
 };
 
 
@@ -92,20 +92,18 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
     double dt_shift = 0.5*block->dt()/cosmo_a;
     //    double dt_shift = 0.0;
-    if (rank >= 1) {
-      EnzoComputeCicInterp interp_x ("acceleration_x", "dark", "ax", dt_shift);
-      interp_x.compute(block);
-    }
 
-    if (rank >= 2) {
-      EnzoComputeCicInterp interp_y ("acceleration_y", "dark", "ay", dt_shift);
-      interp_y.compute(block);
-    }
+    // Interpolate all acceleration components in a single pass
 
-    if (rank >= 3) {
-      EnzoComputeCicInterp interp_z ("acceleration_z", "dark", "az", dt_shift);
-      interp_z.compute(block);
-    }
+    const std::string field_names[3] =
+      { "acceleration_x", "acceleration_y", "acceleration_z" };
+    const std::string attribute_names[3] = { "ax", "ay", "az" };
+
+    EnzoComputeCicInterp interp
+      (std::vector<std::string> (field_names, field_names + rank), "dark",
+       std::vector<std::string> (attribute_names, attribute_names + rank),
+       dt_shift);
+    interp.compute(block);
 
     Particle particle = block->data()->particle();
 
@@ -105,9 +105,9 @@ double EnzoMethodPpm::timestep ( Block * block ) const throw()
 
   /* Compute the pressure. */
 
-  const int in = cello::index_static();
+  EnzoBlockParams params = EnzoBlock::params();
 
-  EnzoComputePressure compute_pressure (EnzoBlock::Gamma[in],
+  EnzoComputePressure compute_pressure (params.Gamma,
 					comoving_coordinates_);
   compute_pressure.compute(enzo_block);
 
@@ -139,7 +139,7 @@ double EnzoMethodPpm::timestep ( Block * block ) const throw()
 			&enzo_block->CellWidth[0], 
 			&enzo_block->CellWidth[1], 
 			&enzo_block->CellWidth[2],
-			&EnzoBlock::Gamma[in], &EnzoBlock::PressureFree[in], &cosmo_a,
+			&params.Gamma, &params.PressureFree, &cosmo_a,
 			density, pressure,
 			velocity_x, 
 			velocity_y, 
@@ -94,7 +94,7 @@ double EnzoMethodPpml::timestep (Block * block) const throw()
  
   /* 1) Compute Courant condition for baryons. */
  
-  if (EnzoBlock::NumberOfBaryonFields > 0) {
+  if (EnzoBlock::params().NumberOfBaryonFields > 0) {
  
     /* Find fields: density, total energy, velocity1-3. */
  
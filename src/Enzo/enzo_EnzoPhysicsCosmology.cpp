@@ -60,6 +60,32 @@ enzo_float EnzoPhysicsCosmology::time_from_redshift (enzo_float redshift) const
 
 void EnzoPhysicsCosmology::compute_expansion_factor
 (enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const
+{
+  for (int i=0; i<cache_count_; i++) {
+    if (cache_time_[i] == time) {
+      *cosmo_a    = cache_a_[i];
+      *cosmo_dadt = cache_dadt_[i];
+      return;
+    }
+  }
+
+  solve_expansion_factor (cosmo_a,cosmo_dadt,time);
+
+  // don't cache a failed solve
+  if (*cosmo_a == -1.0) return;
+
+  const int i = cache_next_;
+  cache_time_[i] = time;
+  cache_a_[i]    = *cosmo_a;
+  cache_dadt_[i] = *cosmo_dadt;
+  cache_next_  = (cache_next_ + 1) % cache_size;
+  cache_count_ = std::min(cache_count_ + 1, int(cache_size));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPhysicsCosmology::solve_expansion_factor
+(enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const
 {
 
   //   *a = 1.0;
@@ -67,7 +93,7 @@ void EnzoPhysicsCosmology::compute_expansion_factor
   //     return;
   /* Error check. */
 
-  ASSERT ("EnzoPhysicsCosmology::compute_expansion_factor",
+  ASSERT ("EnzoPhysicsCosmology::solve_expansion_factor",
 	  "Initial time in code units is 0",
 	  (initial_time_in_code_units() != 0) );
 
@@ -151,7 +177,7 @@ void EnzoPhysicsCosmology::compute_expansion_factor
 	       (omega_matter_now_ + omega_curvature_now_*temp +
 		omega_lambda_now_*temp*temp*temp));
 
-  ASSERT ("EnzoPhysicsCosmology::compute_expansion_factor()",
+  ASSERT ("EnzoPhysicsCosmology::solve_expansion_factor()",
 	  "expansion factor a was not initialized correctly",
 	  (*cosmo_a != -1.0) );
   
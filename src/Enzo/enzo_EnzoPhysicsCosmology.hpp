@@ -30,7 +30,9 @@ public: // interface
     final_redshift_(0.0),
     cosmo_a_(0.0),
     cosmo_dadt_(0.0),
-    current_redshift_(-1.0)
+    current_redshift_(-1.0),
+    cache_count_(0),
+    cache_next_(0)
   {
   }
 
@@ -59,7 +61,9 @@ public: // interface
       final_redshift_(final_redshift),
       cosmo_a_(0.0),
       cosmo_dadt_(0.0),
-      current_redshift_(-1.0)
+      current_redshift_(-1.0),
+      cache_count_(0),
+      cache_next_(0)
   {
     ASSERT3 ("EnzoPhysicsCosmology::EnzoPhysicsCosmology()",
 	     "omega_matter_now (%g) must equal "
@@ -86,7 +90,9 @@ public: // interface
       final_redshift_(0.0),
       cosmo_a_(0.0),
       cosmo_dadt_(0.0),
-      current_redshift_(-1.0)
+      current_redshift_(-1.0),
+      cache_count_(0),
+      cache_next_(0)
   {}
 
   /// Virtual destructor
@@ -114,6 +120,9 @@ public: // interface
     p | cosmo_dadt_;
     p | current_redshift_;
 
+    // expansion factor cache is rebuilt after unpacking
+    if (p.isUnpacking()) clear_cache_();
+
   };
 
   enzo_float hubble_constant_now()   { return hubble_constant_now_; }
@@ -128,21 +137,21 @@ public: // interface
   enzo_float final_redshift()        { return final_redshift_; }
 
   void set_hubble_constant_now(enzo_float value)
-  { hubble_constant_now_=value; }
+  { hubble_constant_now_=value; clear_cache_(); }
   void set_omega_matter_now(enzo_float value)
-  { omega_matter_now_=value; }
+  { omega_matter_now_=value; clear_cache_(); }
   void set_omega_baryon_now(enzo_float value)
-  { omega_baryon_now_=value; }
+  { omega_baryon_now_=value; clear_cache_(); }
   void set_omega_cdm_now(enzo_float value)
-  { omega_cdm_now_=value; }
+  { omega_cdm_now_=value; clear_cache_(); }
   void set_omega_lambda_now(enzo_float value)
-  { omega_lambda_now_=value; }
+  { omega_lambda_now_=value; clear_cache_(); }
   void set_comoving_box_size(enzo_float value)
   { comoving_box_size_=value; }
   void set_max_expansion_rate(enzo_float value)
   { max_expansion_rate_=value; }
   void set_initial_redshift(enzo_float value)
-  { initial_redshift_=value; }
+  { initial_redshift_=value; clear_cache_(); }
   void set_final_redshift(enzo_float value)
   { final_redshift_=value; }
 
@@ -176,9 +185,17 @@ public: // interface
   void compute_expansion_timestep
   (enzo_float *dt_expansion, enzo_float time) const;
 
+  /// Return the expansion factor and its derivative at the given
+  /// time.  Recent results are cached, since all Blocks on a process
+  /// request the same few times each cycle.
   void compute_expansion_factor
   (enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const;
 
+  /// Solve for the expansion factor and its derivative without using
+  /// the cache
+  void solve_expansion_factor
+  (enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const;
+
   /// Return current mass units scaling (requires set_current_time())
   double mass_units() const
   {
@@ -237,6 +254,12 @@ public: // virtual methods
 
   virtual std::string type() const { return "cosmology"; }
 
+protected: // functions
+
+  /// Discard cached expansion factors, e.g. when parameters change
+  void clear_cache_() const
+  { cache_count_ = 0; cache_next_ = 0; }
+
 protected: // attributes
 
   // NOTE: change pup() function whenever attributes change
@@ -257,6 +280,15 @@ protected: // attributes
   enzo_float cosmo_dadt_;
   enzo_float current_redshift_;
 
+  // Cache of recently computed expansion factors, replaced
+  // round-robin (not pup'ed)
+  enum { cache_size = 8 };
+  mutable enzo_float cache_time_[cache_size];
+  mutable enzo_float cache_a_[cache_size];
+  mutable enzo_float cache_dadt_[cache_size];
+  mutable int cache_count_;
+  mutable int cache_next_;
+
 };
 
 #endif /* ENZO_ENZO_PHYSICS_COSMOLOGY_HPP */
@@ -288,8 +288,57 @@ Solver * EnzoProblem::create_solver_
     solve_type = solve_unknown;
   }
 
+  // Precision of Krylov solver vectors, and whether to use iterative
+  // refinement
+
+  const std::string precision_name =
+    enzo_config->solver_precision[index_solver];
+
+  int precision = precision_default;
+  double refine_tol = 0.0;
+
+  if (precision_name == "single") {
+    precision = precision_single;
+  } else if (precision_name == "mixed") {
+    precision = precision_single;
+    refine_tol = enzo_config->solver_refine_tol[index_solver];
+  } else if (precision_name != "default") {
+    ERROR2 ("EnzoProblem::create_solver_()",
+	    "Solver %s precision \"%s\" must be "
+	    "\"default\", \"single\", or \"mixed\"",
+	    enzo_config->solver_list[index_solver].c_str(),
+	    precision_name.c_str());
+  }
+
+  // Mg0 and Jacobi exchange their vectors with X and B, either through
+  // FieldFace restriction and prolongation or by alternating between
+  // X and R in the fused Jacobi update, so their vectors must have the
+  // precision of X.  For the same reason a BiCgStab preconditioner
+  // cannot be applied to single-precision vectors
+
+  const bool is_precision_supported =
+    (solver_type == "cg") ||
+    (solver_type == "bicgstab" &&
+     enzo_config->solver_precondition[index_solver] < 0);
+
+  if (precision != precision_default && ! is_precision_supported) {
+    ERROR2 ("EnzoProblem::create_solver_()",
+	    "Solver %s precision \"%s\" is only supported by \"cg\", "
+	    "and by \"bicgstab\" without a preconditioner",
+	    enzo_config->solver_list[index_solver].c_str(),
+	    precision_name.c_str());
+  }
+
   if (solver_type == "cg") {
 
+    // Whether X may hold an initial guess, in which case the initial
+    // residual B - A*X is needed in the precision of X
+
+    const bool use_guess =
+      (enzo_config->method_gravity_solver ==
+       enzo_config->solver_list[index_solver]) &&
+      (enzo_config->method_gravity_initial_guess != "zero");
+
     solver = new EnzoSolverCg
       (enzo_config->solver_list[index_solver],
        enzo_config->solver_field_x[index_solver],
@@ -301,7 +350,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_max_level[index_solver],
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
-       enzo_config->solver_precondition[index_solver]);
+       enzo_config->solver_precondition[index_solver],
+       precision, refine_tol, use_guess);
 
   } else if (solver_type == "dd") {
 
@@ -339,7 +389,22 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
        enzo_config->solver_precondition[index_solver],
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       precision, refine_tol);
+
+  } else if (solver_type == "agglomerate") {
+
+    solver = new EnzoSolverAgglomerate
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver],
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_res_tol[index_solver]);
 
   } else if (solver_type == "diagonal") {
 
@@ -361,7 +426,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_restart_cycle[index_solver],
        solve_type,
        enzo_config->solver_weight[index_solver],
-       enzo_config->solver_iter_max[index_solver]);
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_sweeps_per_refresh[index_solver]);
 
   } else if (solver_type == "mg0") {
 
@@ -386,7 +452,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_post_smooth[index_solver],
        enzo_config->solver_last_smooth[index_solver],
        restrict,  prolong,
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       enzo_config->solver_cycles[index_solver]);
 
   } else {
     // Not an Enzo Solver--try base class Cello Solver
@@ -563,7 +630,8 @@ Method * EnzoProblem::create_method_
        enzo_config->solver_index.at(solver_name),
        enzo_config->method_gravity_grav_const,
        enzo_config->method_gravity_order,
-       enzo_config->method_gravity_accumulate);
+       enzo_config->method_gravity_accumulate,
+       enzo_config->method_gravity_initial_guess);
 
   } else {
 
@@ -146,16 +146,9 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 		name_.c_str(),mass_min_refine);
 #endif      
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho4[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_block_ (rho4, mx,my,mz, gx,gy,gz, vol,
+		     mass_min_refine, mass_max_coarsen,
+		     &any_refine, &all_coarsen);
     break;
   case precision_double:
     if (out8) {
@@ -175,16 +168,9 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	}
       }
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho8[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_block_ (rho8, mx,my,mz, gx,gy,gz, vol,
+		     mass_min_refine, mass_max_coarsen,
+		     &any_refine, &all_coarsen);
     break;
   case precision_quadruple:
     if (out16) {
@@ -200,16 +186,9 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	}
       }
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  long double mass = vol*rho16[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
-    }
+    evaluate_block_ (rho16, mx,my,mz, gx,gy,gz, vol,
+		     mass_min_refine, mass_max_coarsen,
+		     &any_refine, &all_coarsen);
     break;
   default:
     ERROR2("EnzoRefineMass::apply",
@@ -228,5 +207,38 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 
 }
 
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoRefineMass::evaluate_block_
+(const T * rho,
+ int mx, int my, int mz,
+ int gx, int gy, int gz,
+ double vol,
+ double mass_min_refine,
+ double mass_max_coarsen,
+ bool * any_refine,
+ bool * all_coarsen) const throw()
+{
+  // Reduce maximum density along each x-pencil, returning as soon as
+  // any pencil requires refinement
+
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      const T * r0 = rho + mx*(iy + my*iz);
+      T rho_max = r0[gx];
+      for (int ix=gx; ix<mx-gx; ix++) {
+	rho_max = std::max(rho_max,r0[ix]);
+      }
+      const double mass_max = vol*rho_max;
+      if (mass_max > mass_max_coarsen) *all_coarsen = false;
+      if (mass_max > mass_min_refine) {
+	*any_refine = true;
+	return;
+      }
+    }
+  }
+}
+
 //======================================================================
 
@@ -55,7 +55,21 @@ public: // interface
 
   virtual std::string name () const { return "mass"; };
 
-private:
+private: // functions
+
+  /// Evaluate refine and coarsen conditions over the Block, exiting
+  /// early if refinement is required
+  template <class T>
+  void evaluate_block_ (const T * rho,
+			int mx, int my, int mz,
+			int gx, int gy, int gz,
+			double vol,
+			double mass_min_refine,
+			double mass_max_coarsen,
+			bool * any_refine,
+			bool * all_coarsen) const throw();
+
+private: // attributes
 
   /// Field containing density to compare against
   std::string name_;
@@ -122,6 +122,31 @@ void EnzoRefineShock::evaluate_block_
   (*all_coarsen) = true;
   (*any_refine)  = false;
 
+  if (output == NULL) {
+    evaluate_<false>(v3,te,de,p,output,ndx,ndy,nx,ny,nz,gx,gy,gz,
+		     any_refine,all_coarsen,rank);
+  } else {
+    evaluate_<true> (v3,te,de,p,output,ndx,ndy,nx,ny,nz,gx,gy,gz,
+		     any_refine,all_coarsen,rank);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <bool OUTPUT>
+void EnzoRefineShock::evaluate_
+(const enzo_float * v3[],
+ const enzo_float * te,
+ const enzo_float * de,
+ const enzo_float * p,
+ enzo_float * output,
+ int ndx, int ndy,
+ int nx, int ny, int nz,
+ int gx, int gy, int gz,
+ bool *any_refine,
+ bool * all_coarsen,
+ int rank)
+{
   const int d3[3] = {1, ndx, ndx*ndy};
 
 #ifdef DEBUG_ENZO_REFINE_SHOCK
@@ -130,20 +155,23 @@ void EnzoRefineShock::evaluate_block_
   enzo_float er_min = std::numeric_limits<enzo_float>::max();
   enzo_float er_max = -std::numeric_limits<enzo_float>::max();
 #endif
-  
-  for (int axis=0; axis<rank; axis++) {
 
+  for (int axis=0; axis<rank; axis++) {
+    const int id = d3[axis];
+    const enzo_float * v = v3[axis];
     for (int iz=gz; iz<nz+gz; iz++) {
       for (int iy=gy; iy<ny+gy; iy++) {
+	const int i0 = ndx*(iy + ndy*iz);
+	int n_refine = 0;
+	int n_same   = 0;
 	for (int ix=gx; ix<nx+gx; ix++) {
 
-	  int i = ix + ndx*(iy + ndy*iz);
-	  int id = d3[axis];
+	  const int i = i0 + ix;
 
-	  enzo_float dp = fabs    (p[i+id] - p[i-id]) 
+	  enzo_float dp = fabs (p[i+id] - p[i-id])
 	    / (std::min(p[i+id] , p[i-id])) ;
 
-	  enzo_float dv = v3[axis][i+id] - v3[axis][i-id];
+	  enzo_float dv = v[i+id] - v[i-id];
 
 	  enzo_float e = p[i]/(gamma_ - 1.0);
 
@@ -153,28 +181,33 @@ void EnzoRefineShock::evaluate_block_
 
 	  enzo_float er = e / std::max (std::max(em,e0),ep);
 
-	  bool l_refine = (dv < 0.0) && 
+	  const bool l_refine = (dv < 0.0) &&
 	    (dp > pressure_min_refine_) &&
 	    (er > energy_ratio_min_refine_);
 
-	  bool l_same = (dv < 0.0) &&
+	  const bool l_same = (dv < 0.0) &&
 	    (dp > pressure_max_coarsen_) &&
 	    (er > energy_ratio_max_coarsen_);
 
+	  n_refine += l_refine;
+	  n_same   += l_same;
+
 #ifdef DEBUG_ENZO_REFINE_SHOCK
 	  dp_min = std::min(dp_min,dp);
 	  dp_max = std::max(dp_max,dp);
 	  er_min = std::min(er_min,er);
 	  er_max = std::max(er_max,er);
 #endif
-	  if (l_refine)  *any_refine = true;
-	  if (l_same)    *all_coarsen = false;
-
-	  if (output) {
+	  if (OUTPUT) {
 	    if (l_same)   output[i] =  0;
 	    if (l_refine) output[i] = +1;
 	  }
 	}
+	if (n_same > 0)   *all_coarsen = false;
+	if (n_refine > 0) {
+	  *any_refine = true;
+	  if (! OUTPUT) return;
+	}
       }
     }
   }
@@ -185,7 +218,7 @@ void EnzoRefineShock::evaluate_block_
   CkPrintf ("%s er limits %lf %lf  er min/max %lf %lf\n",
 	    energy_ratio_max_coarsen_,energy_ratio_min_refine_,
 	    er_min,er_max);
-#endif  
+#endif
 }
 //======================================================================
 
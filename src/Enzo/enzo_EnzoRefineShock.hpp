@@ -80,6 +80,23 @@ private: // functions
 			bool *all_coarsen, 
 			int rank);
 
+  /// Shock detection kernel shared by both evaluate_block_() paths.
+  /// With OUTPUT the output field is written for every cell;
+  /// without, conditions are accumulated without branching along each
+  /// x-pencil and the sweep returns at the first pencil that refines
+  template <bool OUTPUT>
+  void evaluate_ ( const enzo_float ** v3,
+		   const enzo_float * te,
+		   const enzo_float * de,
+		   const enzo_float * p,
+		   enzo_float * output,
+		   int ndx, int ndy,
+		   int nx, int ny, int nz,
+		   int gx, int gy, int gz,
+		   bool *any_refine,
+		   bool *all_coarsen,
+		   int rank);
+
 private: // attributes
 
   /// Refine when pressure becomes greater than this somewhere
@@ -0,0 +1,495 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverAgglomerate.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implements the EnzoSolverAgglomerate class
+///
+/// Coarse-level solver that gathers all Blocks of a level onto the
+/// Block at the lower corner of the domain.  Coarse levels typically
+/// have few zones per process, so solving them in parallel is limited
+/// by the latency of the refresh and reduction of each iteration.
+/// Solving the gathered level serially replaces these with a single
+/// gather and scatter per solve.
+///
+///   apply()          each Block in the level sends B to the gathering Block
+///   gather()         assemble B; when complete solve_() and scatter_send_()
+///   scatter()        each Block copies its part of X, including ghosts
+
+#include "cello.hpp"
+#include "enzo.hpp"
+#include "enzo.decl.h"
+
+// #define TRACE_AGGLOMERATE
+
+#ifdef TRACE_AGGLOMERATE
+#  define TRACE_AGG(BLOCK,MSG)						\
+  CkPrintf ("%d %s %s TRACE_AGGLOMERATE %s\n",				\
+	    CkMyPe(),BLOCK->name().c_str(),name_.c_str(),MSG);		\
+  fflush(stdout);
+#else
+#  define TRACE_AGG(BLOCK,MSG) /* ... */
+#endif
+
+//----------------------------------------------------------------------
+
+EnzoSolverAgglomerate::EnzoSolverAgglomerate
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int min_level,
+ int max_level,
+ int iter_max,
+ double res_tol) throw()
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+	   min_level,
+	   max_level),
+    matrix_(NULL),
+    iter_max_(iter_max),
+    res_tol_(res_tol),
+    count_(0),
+    index_list_(),
+    ib3_list_(),
+    b_(),x_(),r_(),d_(),y_()
+{
+  for (int i=0; i<3; i++) {
+    nb3_[i] = 0;
+    n3_[i] = 0;
+    g3_[i] = 0;
+    m3_[i] = 0;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::apply
+( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  TRACE_AGG(block,"apply");
+
+  Solver::begin_(block);
+
+  if ( ! is_finest_(block) ) {
+    Solver::end_(block);
+    return;
+  }
+
+  EnzoMatrixLaplace * laplace = dynamic_cast<EnzoMatrixLaplace *> (A.get());
+
+  ASSERT1 ("EnzoSolverAgglomerate::apply()",
+	   "Solver %s requires an EnzoMatrixLaplace matrix",
+	   name_.c_str(),
+	   laplace != NULL);
+
+  // Pack the interior of B and send it to the gathering Block
+
+  Field field = block->data()->field();
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+  int mx,my,mz;
+  field.dimensions(ib_,&mx,&my,&mz);
+  int gx,gy,gz;
+  field.ghost_depth(ib_,&gx,&gy,&gz);
+
+  const enzo_float * B = (const enzo_float *) field.values(ib_);
+
+  std::vector<enzo_float> buffer (nx*ny*nz);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+	buffer[ix + nx*(iy + ny*iz)] = B[i];
+      }
+    }
+  }
+
+  int ib3[3], nb3[3];
+  block->index_global(&ib3[0],&ib3[1],&ib3[2],&nb3[0],&nb3[1],&nb3[2]);
+
+  const int n = buffer.size()*sizeof(enzo_float);
+
+  enzo::block_array()[index_gather_(block->level())].
+    p_solver_agglomerate_gather (index_,block->index(),ib3,
+				 laplace->order(),n,(char *)(&buffer[0]));
+}
+
+//----------------------------------------------------------------------
+
+Index EnzoSolverAgglomerate::index_gather_ (int level) const throw()
+{
+  // Block containing the lower corner of the domain
+
+  Index index(0,0,0);
+
+  for (int l=0; l<level; l++) {
+    index = index.index_child(0,0,0,min_level_);
+  }
+  if (level < 0) {
+    index = index.index_ancestor(level,min_level_);
+  }
+
+  return index;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_agglomerate_gather
+(int is, Index index, int ib3[3], int order, int n, char * a)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverAgglomerate*> (cello::solver(is))->gather
+    (this,index,ib3,order,n,a);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::gather
+(Block * block, Index index, const int ib3[3],
+ int order, int n, const char * a) throw()
+{
+  TRACE_AGG(block,"gather");
+
+  // Messages may arrive before this Block has called apply(), so
+  // initialize the matrix and gathered arrays on the first message
+
+  if (count_ == 0) {
+
+    matrix_ = std::make_shared<EnzoMatrixLaplace>(order);
+
+    Field field = block->data()->field();
+
+    int ib3_gather[3];
+    block->index_global(&ib3_gather[0],&ib3_gather[1],&ib3_gather[2],
+			&nb3_[0],&nb3_[1],&nb3_[2]);
+
+    field.size(&n3_[0],&n3_[1],&n3_[2]);
+    int gb3[3];
+    field.ghost_depth(ix_,&gb3[0],&gb3[1],&gb3[2]);
+
+    // Ghost zones must hold both the matrix stencil and the ghost
+    // zones of X returned to each Block
+
+    const int rank = cello::rank();
+    const int ga = matrix_->ghost_depth();
+
+    for (int i=0; i<3; i++) {
+      g3_[i] = std::max(gb3[i], (i < rank) ? ga : 0);
+      m3_[i] = nb3_[i]*n3_[i] + 2*g3_[i];
+      ASSERT3 ("EnzoSolverAgglomerate::gather()",
+	       "Level size %d along axis %d is less than ghost depth %d",
+	       nb3_[i]*n3_[i],i,g3_[i],
+	       nb3_[i]*n3_[i] >= g3_[i]);
+    }
+
+    const int m = m3_[0]*m3_[1]*m3_[2];
+
+    b_.assign(m,0.0);
+    x_.assign(m,0.0);
+    r_.assign(m,0.0);
+    d_.assign(m,0.0);
+    y_.assign(m,0.0);
+
+    index_list_.clear();
+    ib3_list_.clear();
+  }
+
+  ASSERT2 ("EnzoSolverAgglomerate::gather()",
+	   "Received %d bytes but expected %d",
+	   n, int(n3_[0]*n3_[1]*n3_[2]*sizeof(enzo_float)),
+	   n == int(n3_[0]*n3_[1]*n3_[2]*sizeof(enzo_float)));
+
+  index_list_.push_back(index);
+  for (int i=0; i<3; i++) ib3_list_.push_back(ib3[i]);
+
+  // Copy B into the gathered array
+
+  const enzo_float * B = (const enzo_float *) a;
+
+  const int ox = g3_[0] + ib3[0]*n3_[0];
+  const int oy = g3_[1] + ib3[1]*n3_[1];
+  const int oz = g3_[2] + ib3[2]*n3_[2];
+  const int mx = m3_[0];
+  const int my = m3_[1];
+
+  for (int iz=0; iz<n3_[2]; iz++) {
+    for (int iy=0; iy<n3_[1]; iy++) {
+      const int i = ox + mx*((iy+oy) + my*(iz+oz));
+      std::copy_n (B + n3_[0]*(iy + n3_[1]*iz), n3_[0], &b_[i]);
+    }
+  }
+
+  if (++count_ == nb3_[0]*nb3_[1]*nb3_[2]) {
+
+    count_ = 0;
+
+    solve_(block);
+
+    scatter_send_(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::solve_ (Block * block) throw()
+{
+  TRACE_AGG(block,"solve");
+
+  EnzoMatrixLaplace * A = matrix_.get();
+
+  double hx,hy,hz;
+  block->cell_width(&hx,&hy,&hz);
+  A->set_cell_width(hx,hy,hz);
+  A->set_dimensions(m3_[0],m3_[1],m3_[2]);
+
+  bool periodic[3][2];
+  block->periodicity(periodic);
+
+  const int m  = m3_[0]*m3_[1]*m3_[2];
+  const int mx = m3_[0];
+  const int my = m3_[1];
+  const int g0 = A->ghost_depth();
+
+  enzo_float * X = &x_[0];
+  enzo_float * R = &r_[0];
+  enzo_float * D = &d_[0];
+  enzo_float * Y = &y_[0];
+
+  const bool is_singular = A->is_singular();
+
+  if (is_singular) project_(&b_[0]);
+
+  for (int i=0; i<m; i++) {
+    X[i] = 0.0;
+    R[i] = b_[i];
+    D[i] = b_[i];
+  }
+
+  long double rr = dot_(R,R);
+  const long double rr0 = rr;
+
+  int iter = 0;
+
+  while (rr0 > 0.0 && rr / rr0 >= res_tol_ && iter < iter_max_) {
+
+    refresh_(D,periodic);
+
+    A->matvec(precision_default,Y,D,g0);
+
+    const long double dy = dot_(D,Y);
+
+    if (dy == 0.0) break;
+
+    const enzo_float a = rr / dy;
+
+    for (int iz=g3_[2]; iz<m3_[2]-g3_[2]; iz++) {
+      for (int iy=g3_[1]; iy<m3_[1]-g3_[1]; iy++) {
+	for (int ix=g3_[0]; ix<m3_[0]-g3_[0]; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  X[i] += a*D[i];
+	  R[i] -= a*Y[i];
+	}
+      }
+    }
+
+    if (is_singular) project_(R);
+
+    const long double rr_new = dot_(R,R);
+
+    const enzo_float b = rr_new / rr;
+
+    for (int iz=g3_[2]; iz<m3_[2]-g3_[2]; iz++) {
+      for (int iy=g3_[1]; iy<m3_[1]-g3_[1]; iy++) {
+	for (int ix=g3_[0]; ix<m3_[0]-g3_[0]; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  D[i] = R[i] + b*D[i];
+	}
+      }
+    }
+
+    rr = rr_new;
+
+    ++iter;
+  }
+
+  if (is_singular) project_(X);
+
+  refresh_(X,periodic);
+
+  if (monitor_iter_ > 0) {
+    Solver::monitor_output_(block,iter,rr0,0.0,rr,0.0,true);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::refresh_
+(enzo_float * X, const bool periodic[3][2]) const throw()
+{
+  // Non-periodic ghost zones are left at zero, since only the
+  // interior of the gathered vectors is updated
+
+  const int s3[3] = { 1, m3_[0], m3_[0]*m3_[1] };
+
+  const int rank = cello::rank();
+
+  for (int axis=0; axis<rank; axis++) {
+
+    if ( ! (periodic[axis][0] && periodic[axis][1]) ) continue;
+
+    const int n = nb3_[axis]*n3_[axis];
+    const int g = g3_[axis];
+
+    for (int face=0; face<2; face++) {
+
+      // ghost zones along axis, all zones along the other axes
+      // (including ghost zones filled along previous axes)
+
+      int im3[3] = {0,0,0};
+      int ip3[3] = {m3_[0],m3_[1],m3_[2]};
+      im3[axis] = (face == 0) ? 0 : g+n;
+      ip3[axis] = (face == 0) ? g : n+2*g;
+      const int offset = (face == 0) ? n*s3[axis] : -n*s3[axis];
+
+      for (int iz=im3[2]; iz<ip3[2]; iz++) {
+	for (int iy=im3[1]; iy<ip3[1]; iy++) {
+	  for (int ix=im3[0]; ix<ip3[0]; ix++) {
+	    int i = ix + s3[1]*iy + s3[2]*iz;
+	    X[i] = X[i+offset];
+	  }
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+long double EnzoSolverAgglomerate::dot_
+(const enzo_float * X, const enzo_float * Y) const throw()
+{
+  const int mx = m3_[0];
+  const int my = m3_[1];
+  long double sum = 0.0;
+  for (int iz=g3_[2]; iz<m3_[2]-g3_[2]; iz++) {
+    for (int iy=g3_[1]; iy<m3_[1]-g3_[1]; iy++) {
+      for (int ix=g3_[0]; ix<m3_[0]-g3_[0]; ix++) {
+	int i = ix + mx*(iy + my*iz);
+	sum += X[i]*Y[i];
+      }
+    }
+  }
+  return sum;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::project_ (enzo_float * X) const throw()
+{
+  const int mx = m3_[0];
+  const int my = m3_[1];
+  long double sum = 0.0;
+  for (int iz=g3_[2]; iz<m3_[2]-g3_[2]; iz++) {
+    for (int iy=g3_[1]; iy<m3_[1]-g3_[1]; iy++) {
+      for (int ix=g3_[0]; ix<m3_[0]-g3_[0]; ix++) {
+	sum += X[ix + mx*(iy + my*iz)];
+      }
+    }
+  }
+  const long double count =
+    (long double)(nb3_[0]*n3_[0])*(nb3_[1]*n3_[1])*(nb3_[2]*n3_[2]);
+  const enzo_float shift = sum / count;
+  for (int iz=g3_[2]; iz<m3_[2]-g3_[2]; iz++) {
+    for (int iy=g3_[1]; iy<m3_[1]-g3_[1]; iy++) {
+      for (int ix=g3_[0]; ix<m3_[0]-g3_[0]; ix++) {
+	X[ix + mx*(iy + my*iz)] -= shift;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::scatter_send_ (Block * block) throw()
+{
+  TRACE_AGG(block,"scatter_send");
+
+  // All Blocks in the level have the same dimensions as this one
+
+  Field field = block->data()->field();
+
+  int mb3[3], gb3[3];
+  field.dimensions (ix_,&mb3[0],&mb3[1],&mb3[2]);
+  field.ghost_depth(ix_,&gb3[0],&gb3[1],&gb3[2]);
+
+  const int mx = m3_[0];
+  const int my = m3_[1];
+
+  std::vector<enzo_float> buffer (mb3[0]*mb3[1]*mb3[2]);
+  const int n = buffer.size()*sizeof(enzo_float);
+
+  for (size_t k=0; k<index_list_.size(); k++) {
+
+    const int * ib3 = &ib3_list_[3*k];
+
+    const int ox = g3_[0] + ib3[0]*n3_[0] - gb3[0];
+    const int oy = g3_[1] + ib3[1]*n3_[1] - gb3[1];
+    const int oz = g3_[2] + ib3[2]*n3_[2] - gb3[2];
+
+    for (int iz=0; iz<mb3[2]; iz++) {
+      for (int iy=0; iy<mb3[1]; iy++) {
+	const int i = ox + mx*((iy+oy) + my*(iz+oz));
+	std::copy_n (&x_[i], mb3[0], &buffer[mb3[0]*(iy + mb3[1]*iz)]);
+      }
+    }
+
+    enzo::block_array()[index_list_[k]].p_solver_agglomerate_scatter
+      (index_,n,(char *)(&buffer[0]));
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_agglomerate_scatter(int is, int n, char * a)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverAgglomerate*> (cello::solver(is))->scatter
+    (this,n,a);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverAgglomerate::scatter
+(Block * block, int n, const char * a) throw()
+{
+  TRACE_AGG(block,"scatter");
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(ix_,&mx,&my,&mz);
+
+  ASSERT2 ("EnzoSolverAgglomerate::scatter()",
+	   "Received %d bytes but expected %d",
+	   n, int(mx*my*mz*sizeof(enzo_float)),
+	   n == int(mx*my*mz*sizeof(enzo_float)));
+
+  std::copy_n ((const enzo_float *) a, mx*my*mz,
+	       (enzo_float *) field.values(ix_));
+
+  Solver::end_(block);
+}
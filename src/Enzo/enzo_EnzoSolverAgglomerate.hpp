@@ -0,0 +1,149 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverAgglomerate.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverAgglomerate class
+
+#ifndef ENZO_ENZO_SOLVER_AGGLOMERATE_HPP
+#define ENZO_ENZO_SOLVER_AGGLOMERATE_HPP
+
+class EnzoSolverAgglomerate : public Solver {
+
+  /// @class    EnzoSolverAgglomerate
+  /// @ingroup  Enzo
+  /// @brief [\ref Enzo] Coarse-level solver that gathers the level
+  /// onto a single Block and solves it there with serial CG
+  ///
+  /// Intended as the coarse_solve solver of "mg0" or "dd".  Each Block
+  /// in the level sends its right-hand side to the Block at the lower
+  /// corner of the domain, which assembles the level into a single
+  /// array, solves it without any further messages or reductions,
+  /// and returns each Block its part of the solution including ghost
+  /// zones.  Requires an EnzoMatrixLaplace matrix.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverAgglomerate(std::string name,
+			std::string field_x,
+			std::string field_b,
+			int monitor_iter,
+			int restart_cycle,
+			int solve_type,
+			int min_level,
+			int max_level,
+			int iter_max,
+			double res_tol) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverAgglomerate);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverAgglomerate (CkMigrateMessage *m)
+    : Solver(m),
+      matrix_(NULL),
+      iter_max_(0),
+      res_tol_(0.0),
+      count_(0),
+      index_list_(),
+      ib3_list_(),
+      b_(),x_(),r_(),d_(),y_()
+  {
+    for (int i=0; i<3; i++) {
+      nb3_[i] = 0;
+      n3_[i] = 0;
+      g3_[i] = 0;
+      m3_[i] = 0;
+    }
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+
+    p | iter_max_;
+    p | res_tol_;
+
+    // NOTE: gathered arrays are only defined during a solve, so are
+    // not pup'ed
+  }
+
+public: // virtual functions
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "agglomerate"; }
+
+public: // methods
+
+  /// Accumulate a Block's right-hand side on the gathering Block
+  void gather (Block * block, Index index, const int ib3[3],
+	       int order, int n, const char * a) throw();
+
+  /// Copy the solution returned by the gathering Block to X
+  void scatter (Block * block, int n, const char * a) throw();
+
+protected: // methods
+
+  /// Index of the gathering Block of the given level
+  Index index_gather_ (int level) const throw();
+
+  /// Solve the gathered system on the gathering Block
+  void solve_ (Block * block) throw();
+
+  /// Fill ghost zones of the gathered array X
+  void refresh_ (enzo_float * X, const bool periodic[3][2]) const throw();
+
+  /// Send each Block its part of the solution
+  void scatter_send_ (Block * block) throw();
+
+  /// Dot product over the interior of the gathered arrays
+  long double dot_ (const enzo_float * X, const enzo_float * Y) const throw();
+
+  /// Subtract the interior mean from X
+  void project_ (enzo_float * X) const throw();
+
+protected: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Matrix for the gathered level.  Created from the matrix order
+  /// sent with B, since the gathering Block may receive B from other
+  /// Blocks before its own apply()
+  std::shared_ptr<EnzoMatrixLaplace> matrix_;
+
+  /// Maximum number of serial CG iterations
+  int iter_max_;
+
+  /// Convergence tolerance on the residual reduction
+  double res_tol_;
+
+  /// Number of Blocks gathered so far
+  int count_;
+
+  /// Index and position in the level of each gathered Block
+  std::vector<Index> index_list_;
+  std::vector<int> ib3_list_;
+
+  /// Number of Blocks along each axis of the level
+  int nb3_[3];
+
+  /// Block size, and ghost depth and dimensions of the gathered arrays
+  int n3_[3];
+  int g3_[3];
+  int m3_[3];
+
+  /// Gathered right-hand side, solution, and CG vectors
+  std::vector<enzo_float> b_;
+  std::vector<enzo_float> x_;
+  std::vector<enzo_float> r_;
+  std::vector<enzo_float> d_;
+  std::vector<enzo_float> y_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_AGGLOMERATE_HPP */
@@ -171,7 +171,9 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
  int min_level, int max_level,
  int iter_max, double res_tol,
  int index_precon,
- int coarse_level
+ int coarse_level,
+ int precision,
+ double refine_tol
  ) 
   : Solver(name,
 	   field_x,
@@ -189,7 +191,12 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
     iy_(0), iv_(0), iq_(0), iu_(0),
     m_(0), mx_(0), my_(0), mz_(0),
     gx_(0), gy_(0), gz_(0),
-    coarse_level_(coarse_level)
+    coarse_level_(coarse_level),
+    precision_(precision),
+    refine_tol_(refine_tol),
+    ia_(-1),
+    is_rr_refine_(0),
+    is_refine_(0)
 {
 
   //  if (solve_type == solve_tree) {
@@ -220,6 +227,7 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   is_vs_ =     scalar_descr_quad->new_value("solver_bicgstab_vs");
   is_us_ =     scalar_descr_quad->new_value("solver_bicgstab_us");
   is_qs_ =     scalar_descr_quad->new_value("solver_bicgstab_qs");
+  is_rr_refine_ = scalar_descr_quad->new_value("solver_bicgstab_rr_refine");
 
   if (solve_type == solve_tree) {
    
@@ -236,6 +244,7 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   
   ScalarDescr * scalar_descr_int = cello::scalar_descr_int();
   is_iter_ = scalar_descr_int->new_value("solver_bicgstab_iter");
+  is_refine_ = scalar_descr_int->new_value("solver_bicgstab_refine");
 
   FieldDescr * field_descr = cello::field_descr();
 
@@ -246,7 +255,24 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   iv_ = field_descr->insert_temporary();
   iq_ = field_descr->insert_temporary();
   iu_ = field_descr->insert_temporary();
-  
+
+  // Store BiCgStab vectors in single precision if requested, halving
+  // their memory traffic and refresh message sizes
+
+  if (precision_ == precision_single) {
+    field_descr->set_precision(ir_, precision_single);
+    field_descr->set_precision(ir0_,precision_single);
+    field_descr->set_precision(ip_, precision_single);
+    field_descr->set_precision(iy_, precision_single);
+    field_descr->set_precision(iv_, precision_single);
+    field_descr->set_precision(iq_, precision_single);
+    field_descr->set_precision(iu_, precision_single);
+
+    // A*X for the residual B - A*X, in the precision of X
+
+    ia_ = field_descr->insert_temporary();
+  }
+
   /// Initialize default Refresh (called before entry to compute())
 
   const int min_face_rank = cello::rank() - 1;
@@ -312,6 +338,62 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   
   /// initialize BiCgStab iteration counter
   (s_iter_(block)) = 0;
+  (s_refine_(block)) = 0;
+
+  if (use_guess_) {
+
+    // Refresh the initial guess X before computing the initial
+    // residual, so Block boundary stencils use current ghost values
+
+    const int min_face_rank = cello::rank() - 1;
+
+    Refresh refresh
+      (A_->ghost_depth(),min_face_rank,neighbor_type_(),
+       sync_type_(), enzo_sync_id_solver_bicgstab_guess);
+
+    if (solve_type_ == solve_tree)
+      refresh.set_root_level (coarse_level_);
+
+    refresh.set_active(is_finest_(block));
+    refresh.add_field (ix_);
+
+    block->refresh_enter
+      (CkIndex_EnzoBlock::p_solver_bicgstab_guess(),&refresh);
+
+  } else {
+
+    compute_begin(block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_bicgstab_guess() {
+
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverBiCgStab*> (solver())->compute_begin(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::compute_begin(EnzoBlock* block) throw() {
+
+  if (precision_ == precision_single) {
+    compute_begin_<float> (block);
+  } else {
+    compute_begin_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::compute_begin_(EnzoBlock* block) throw() {
 
   /// access field container on this block
 
@@ -323,20 +405,28 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   /// access relevant fields
 
   enzo_float* X   = (enzo_float*) field.values(ix_);
-  enzo_float* R   = (enzo_float*) field.values(ir_);
-  enzo_float* R0  = (enzo_float*) field.values(ir0_);
-  enzo_float* P   = (enzo_float*) field.values(ip_);
-  enzo_float* Y   = (enzo_float*) field.values(iy_);
-  enzo_float* V   = (enzo_float*) field.values(iv_);
-  enzo_float* Q   = (enzo_float*) field.values(iq_);
-  enzo_float* U   = (enzo_float*) field.values(iu_);
+  T* R   = (T*) field.values(ir_);
+  T* R0  = (T*) field.values(ir0_);
+  T* P   = (T*) field.values(ip_);
+  T* Y   = (T*) field.values(iy_);
+  T* V   = (T*) field.values(iv_);
+  T* Q   = (T*) field.values(iq_);
+  T* U   = (T*) field.values(iu_);
 
   COPY_FIELD(block,ib_,"B0_bcg");
   for (int i=0; i<m_; i++) {
-    X[i] = R[i] = R0[i] = P[i] = 0.0;
+    R[i] = R0[i] = P[i] = 0.0;
     Y[i] = V[i] = Q[i] =  U[i] = 0.0;
   }
 
+  /// keep X if it is the initial guess, whose ghost zones were
+  /// refreshed in compute_(); the initial residual is computed from X
+  /// in start_2(), after a uniform shift that keeps ghosts consistent
+
+  if (! (use_guess_ && is_finest_(block))) {
+    for (int i=0; i<m_; i++) X[i] = 0.0;
+  }
+
   if (is_finest_(block)) {
 
     const bool reuse_x = reuse_solution_ (block->cycle());
@@ -347,7 +437,7 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
 
       for (int i=0; i<m_; i++) X[i] = X_copy[i];
 
-      A_->residual (ir_, ib_, ix_, block);
+      residual_ (block,R);
       
     }
   }
@@ -444,7 +534,19 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
   }
 
   delete msg;
-  
+
+  if (precision_ == precision_single) {
+    start_2_<float> (block);
+  } else {
+    start_2_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::start_2_(EnzoBlock* block) throw() {
+
   /// access field container on this block
 
   Field field = block->data()->field();
@@ -460,9 +562,9 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
 
     /// access relevant fields
     enzo_float* B  = (enzo_float*) field.values(ib_);
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* P  = (enzo_float*) field.values(ip_);
-    enzo_float* R  = (enzo_float*) field.values(ir_);
+    T* R0 = (T*) field.values(ir0_);
+    T* P  = (T*) field.values(ip_);
+    T* R  = (T*) field.values(ir_);
     enzo_float* X  = (enzo_float*) field.values(ix_);
 
     /// for singular problems, project B into R(A)
@@ -483,7 +585,7 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
     }
 
     // recompute residual given shifted B and X
-    A_->residual (ir_, ib_, ix_, block);
+    residual_ (block,R);
 
     /// LINE 01:  R0 = B - A * X_0
     /// LINE 02:  P0 = R0
@@ -584,6 +686,18 @@ void EnzoSolverBiCgStab::loop_0b(EnzoBlock* block,
 
 void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
 
+  if (precision_ == precision_single) {
+    loop_0_<float> (block);
+  } else {
+    loop_0_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_0_(EnzoBlock* block) throw() {
+
   /// verify legal floating-point value for preceding reduction result
 
   TRACE_BCG(block,this,"loop_0");
@@ -604,9 +718,9 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
 	
       if (is_finest_(block)) {
 	Field field = block->data()->field();
-	enzo_float* R0 = (enzo_float*) field.values(ir0_);
-	enzo_float* P  = (enzo_float*) field.values(ip_);
-	enzo_float* R  = (enzo_float*) field.values(ir_);
+	T* R0 = (T*) field.values(ir0_);
+	T* P  = (T*) field.values(ip_);
+	T* R  = (T*) field.values(ir_);
 	for (int i=0; i<m_; i++) {
 	  R0[i] -= shift;
 	  R[i]  -= shift;
@@ -636,9 +750,25 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
   TRACE_SCALAR(block,"err_",S(err));
 
 
-  const bool is_converged = (S(err) < res_tol_);
+  bool is_converged = (S(err) < res_tol_);
   const bool is_diverged  = (iter >= iter_max_);
 
+  /// Iterative refinement: the single-precision recursive residual
+  /// drifts from the true residual, so have loop_12() replace it by
+  /// B - A*X whenever dot(R,R) has been reduced by refine_tol, and
+  /// before accepting convergence
+
+  if (refine_tol_ > 0.0) {
+    if (iter == 0 || s_refine_(block) == 2) {
+      S(rr_refine) = (iter == 0) ? S(beta_n) : S(rr);
+      s_refine_(block) = 0;
+    } else if (s_refine_(block) == 0 &&
+	       (is_converged || S(rr) < refine_tol_*S(rr_refine))) {
+      s_refine_(block) = 1;
+      is_converged = false;
+    }
+  }
+
   /// monitor output solution progress (iteration, residual, etc)
 
   int a3[3];
@@ -656,13 +786,15 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
       monitor_output_(block,iter,sqrt(S(bnorm)),
 		      S(err_min)*sqrt(S(bnorm)),
 		      S(err)    *sqrt(S(bnorm)),
-		      S(err_max)*sqrt(S(bnorm)));
+		      S(err_max)*sqrt(S(bnorm)),
+		      is_converged || is_diverged);
     } else {
       monitor_output_(block,iter,
 		      S(err0),
 		      S(err_min),
 		      S(err),
-		      S(err_max));
+		      S(err_max),
+		      is_converged || is_diverged);
     }
   }
 
@@ -709,6 +841,18 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
 
 void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
 
+  if (precision_ == precision_single) {
+    loop_2_<float> (block);
+  } else {
+    loop_2_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_2_(EnzoBlock* block) throw() {
+
   /// access field container on this block
 
   TRACE_BCG(block,this,"loop_2");
@@ -717,7 +861,7 @@ void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
 
   if (index_precon_ >= 0) {
 
-    enzo_float * Y = (enzo_float*) field.values(iy_);
+    T * Y = (T*) field.values(iy_);
 
     for (int i=0; i<m_; i++) Y[i] = 0.0;
 
@@ -759,8 +903,8 @@ void EnzoSolverBiCgStab::loop_2(EnzoBlock* block) throw() {
     
   } else { // no preconditioner
 
-    enzo_float * Y = (enzo_float*) field.values(iy_);
-    enzo_float * P = (enzo_float*) field.values(ip_);
+    T * Y = (T*) field.values(iy_);
+    T * P = (T*) field.values(ip_);
     
     /// LINE 04: Y = M \ P  [ M = I ]
     for (int i=0; i<m_; i++) Y[i] = P[i];
@@ -841,6 +985,18 @@ void EnzoBlock::p_solver_bicgstab_loop_3() {
 
 void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
 
+  if (precision_ == precision_single) {
+    loop_4_<float> (block);
+  } else {
+    loop_4_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_4_(EnzoBlock* block) throw() {
+
   TRACE_BCG(block,this,"loop_4");
   
   /// access field container on this block
@@ -870,8 +1026,8 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   
   if (is_finest_(block)) {
     
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
-    enzo_float* V  = (enzo_float*) field.values(iv_);
+    T* R0 = (T*) field.values(ir0_);
+    T* V  = (T*) field.values(iv_);
 
     /// LINE 07 [part]  vr0_ = V*R0
     
@@ -889,8 +1045,8 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
 
     if (is_singular_()) {
 
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* V = (enzo_float*) field.values(iv_);
+      T* Y = (T*) field.values(iy_);
+      T* V = (T*) field.values(iv_);
 
       /// ys_ = sum (Y[i])
       /// vs_ = sum (V[i])
@@ -960,6 +1116,18 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 
   delete msg;
 
+  if (precision_ == precision_single) {
+    loop_6_<float> (block);
+  } else {
+    loop_6_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_6_(EnzoBlock* block) throw() {
+
   const long double vr0 = S(vr0);
   const long double ys =  S(ys);
   const long double vs =  S(vs);
@@ -978,8 +1146,8 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 
     if (is_singular_()) {
     
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* V = (enzo_float*) field.values(iv_);
+      T* Y = (T*) field.values(iy_);
+      T* V = (T*) field.values(iv_);
 
       enzo_float y_shift = ys / S(c);
       enzo_float v_shift = vs / S(c);
@@ -1004,11 +1172,11 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
     /// update vectors (on leaf blocks only)
 
     /// access relevant fields
-    enzo_float* Q = (enzo_float*) field.values(iq_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* V = (enzo_float*) field.values(iv_);
+    T* Q = (T*) field.values(iq_);
+    T* R = (T*) field.values(ir_);
+    T* V = (T*) field.values(iv_);
     enzo_float* X = (enzo_float*) field.values(ix_);
-    enzo_float* Y = (enzo_float*) field.values(iy_);
+    T* Y = (T*) field.values(iy_);
 
     /// LINE 08: Q = R - alpha * V
     /// LINE 09: X = X + alpha * Y
@@ -1035,6 +1203,18 @@ void EnzoSolverBiCgStab::loop_6(EnzoBlock* block,
 
 void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
 
+  if (precision_ == precision_single) {
+    loop_8_<float> (block);
+  } else {
+    loop_8_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_8_(EnzoBlock* block) throw() {
+
   TRACE_BCG(block,this,"loop_8");
 
   /// access field container on this block
@@ -1043,7 +1223,7 @@ void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
 
   if (index_precon_ >= 0) {
 
-    enzo_float* Y = (enzo_float*) field.values(iy_);
+    T* Y = (T*) field.values(iy_);
 
     for (int i=0; i<m_; i++) Y[i] = 0.0;
 
@@ -1084,8 +1264,8 @@ void EnzoSolverBiCgStab::loop_8(EnzoBlock* block) throw() {
     
   } else {
 
-    enzo_float * Y = (enzo_float*) field.values(iy_);
-    enzo_float * Q = (enzo_float*) field.values(iq_);
+    T * Y = (T*) field.values(iy_);
+    T * Q = (T*) field.values(iq_);
 
     /// LINE 10: Y = M \ Q  [ M = I ]
 
@@ -1156,6 +1336,18 @@ void EnzoBlock::p_solver_bicgstab_loop_9() {
 //----------------------------------------------------------------------
 
 void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
+
+  if (precision_ == precision_single) {
+    loop_10_<float> (block);
+  } else {
+    loop_10_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_10_(EnzoBlock* block) throw() {
   
   TRACE_BCG(block,this,"loop_10");
 
@@ -1183,8 +1375,8 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
   
   if (is_finest_(block)) {
     
-    enzo_float* U  = (enzo_float*) field.values(iu_);
-    enzo_float* Q  = (enzo_float*) field.values(iq_);
+    T* U  = (T*) field.values(iu_);
+    T* Q  = (T*) field.values(iq_);
     
     /// omega_n = DOT(U, Q)
     /// omega_d = DOT(U, U)
@@ -1203,8 +1395,8 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
 
     if (is_singular_()) {
 
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* U = (enzo_float*) field.values(iu_);
+      T* Y = (T*) field.values(iy_);
+      T* U = (T*) field.values(iu_);
 
       /// ys_ = SUM(Y)
       /// us_ = SUM(U)
@@ -1286,6 +1478,18 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
 
   delete msg;
 
+  if (precision_ == precision_single) {
+    loop_12_<float> (block);
+  } else {
+    loop_12_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_12_(EnzoBlock* block) throw() {
+
   const long double ys = S(ys);
   const long double us = S(us);
   const long double qs = S(qs);
@@ -1307,8 +1511,8 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
     S(omega_d) -= us*us/ S(c);
 
     if (is_finest_(block)) {
-      enzo_float* Y = (enzo_float*) field.values(iy_);
-      enzo_float* U = (enzo_float*) field.values(iu_);
+      T* Y = (T*) field.values(iy_);
+      T* U = (T*) field.values(iu_);
       enzo_float y_shift = ys / S(c);
       enzo_float u_shift = us / S(c);
       for (int i=0; i<m_; i++) {
@@ -1352,10 +1556,10 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   if (is_finest_(block)) {
 
     enzo_float* X = (enzo_float*) field.values(ix_);
-    enzo_float* Y = (enzo_float*) field.values(iy_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* Q = (enzo_float*) field.values(iq_);
-    enzo_float* U = (enzo_float*) field.values(iu_);
+    T* Y = (T*) field.values(iy_);
+    T* R = (T*) field.values(ir_);
+    T* Q = (T*) field.values(iq_);
+    T* U = (T*) field.values(iu_);
     
     /// LINE 13:     X = X + omega * Y
     /// LINE 14:     R = Q - omega * U
@@ -1364,8 +1568,16 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
       X[i] = X[i] + S(omega)*Y[i];
       R[i] = Q[i] - S(omega)*U[i];
     }
+
+    /// Iterative refinement: replace R by the true residual B - A*X.
+    /// The ghost zones of X are current, since X and Y were both
+    /// refreshed before the updates of X since loop_4()
+
+    if (s_refine_(block) == 1) residual_ (block,R);
   }
 
+  if (s_refine_(block) == 1) s_refine_(block) = 2;
+
   
   /// Update previous beta value (beta_d_) to current value (beta_n_)
   
@@ -1381,8 +1593,8 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   
   if (is_finest_(block)) {
     
-    enzo_float* R  = (enzo_float*) field.values(ir_);
-    enzo_float* R0 = (enzo_float*) field.values(ir0_);
+    T* R  = (T*) field.values(ir_);
+    T* R0 = (T*) field.values(ir0_);
     
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
@@ -1447,6 +1659,18 @@ void EnzoSolverBiCgStab::loop_14(EnzoBlock* block,
   
   delete msg;
 
+  if (precision_ == precision_single) {
+    loop_14_<float> (block);
+  } else {
+    loop_14_<enzo_float> (block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverBiCgStab::loop_14_(EnzoBlock* block) throw() {
+
   TRACE_SCALAR(block,"rr_",S(rr));
   TRACE_SCALAR(block,"beta_n_",S(beta_n));
 
@@ -1477,9 +1701,9 @@ void EnzoSolverBiCgStab::loop_14(EnzoBlock* block,
   
   if (is_finest_(block)) {
 
-    enzo_float* P = (enzo_float*) field.values(ip_);
-    enzo_float* R = (enzo_float*) field.values(ir_);
-    enzo_float* V = (enzo_float*) field.values(iv_);
+    T* P = (T*) field.values(ip_);
+    T* R = (T*) field.values(ir_);
+    T* V = (T*) field.values(iv_);
 
     /// LINE 16:     P = R + beta * (P - omega * V)
 
@@ -1516,6 +1740,37 @@ void EnzoBlock::r_solver_bicgstab_loop_15(CkReductionMsg* msg) {
 
 //----------------------------------------------------------------------
 
+template <class T>
+void EnzoSolverBiCgStab::residual_ (EnzoBlock * block, T * R) throw()
+{
+  if (ia_ < 0) {
+
+    // R has the same precision as X and B
+
+    A_->residual (ir_, ib_, ix_, block);
+
+  } else {
+
+    Field field = block->data()->field();
+
+    A_->matvec (ia_, ix_, block);
+
+    const enzo_float * B  = (const enzo_float*) field.values(ib_);
+    const enzo_float * AX = (const enzo_float*) field.values(ia_);
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  R[i] = B[i] - AX[i];
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoSolverBiCgStab::end (EnzoBlock* block, int retval) throw () {
 
   TRACE_BCG(block,this,"end");
@@ -38,7 +38,9 @@ public: // interface
 		     int iter_max, 
 		     double res_tol,
 		     int index_precon,
-		     int coarse_level);
+		     int coarse_level,
+		     int precision = precision_default,
+		     double refine_tol = 0.0);
 
   /// default constructor
   EnzoSolverBiCgStab()
@@ -51,7 +53,12 @@ public: // interface
       iy_(-1), iv_(-1), iq_(-1), iu_(-1),
       m_(0), mx_(0), my_(0), mz_(0),
       gx_(0), gy_(0), gz_(0),
-      coarse_level_(0)
+      coarse_level_(0),
+      precision_(precision_default),
+      refine_tol_(0.0),
+      ia_(-1),
+      is_rr_refine_(0),
+      is_refine_(0)
   {};
 
   /// Charm++ PUP::able declarations
@@ -68,7 +75,12 @@ public: // interface
       iy_(-1), iv_(-1), iq_(-1), iu_(-1),
       m_(0), mx_(0), my_(0), mz_(0),
       gx_(0), gy_(0), gz_(0),
-       coarse_level_(0)
+      coarse_level_(0),
+      precision_(precision_default),
+      refine_tol_(0.0),
+      ia_(-1),
+      is_rr_refine_(0),
+      is_refine_(0)
   {}
 
   /// Charm++ Pack / Unpack function
@@ -126,6 +138,11 @@ public: // interface
     p | is_dot_sync_;
     p | is_iter_;
     p | coarse_level_;
+    p | precision_;
+    p | refine_tol_;
+    p | ia_;
+    p | is_rr_refine_;
+    p | is_refine_;
   }
 
   
@@ -135,6 +152,9 @@ public: // interface
   /// Type of this solver
   virtual std::string type() const { return "bicgstab"; }
 
+  /// Continuation after refreshing the initial guess X
+  void compute_begin(EnzoBlock* enzo_block) throw();
+
   /// Projects RHS and sets initial vectors R, R0, and P
   void start_2(EnzoBlock* enzo_block,
 	       CkReductionMsg * msg) throw();
@@ -191,6 +211,22 @@ public: // interface
   /// internal routine to handle actual start to solver
   void compute_(EnzoBlock * enzo_block) throw();
 
+  /// Implementations for vectors R, R0, P, Y, V, Q, and U of type T
+  template <class T> void compute_begin_ (EnzoBlock * enzo_block) throw();
+  template <class T> void start_2_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_0_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_2_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_4_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_6_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_8_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_10_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_12_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_14_ (EnzoBlock * enzo_block) throw();
+
+  /// Compute the residual R = B - A*X in the precision of X
+  template <class T>
+  void residual_ (EnzoBlock * enzo_block, T * R) throw();
+
   /// Allocate temporary Fields
   void allocate_temporary_(Block * block)
   {
@@ -202,6 +238,7 @@ public: // interface
     field.allocate_temporary(iv_);
     field.allocate_temporary(iq_);
     field.allocate_temporary(iu_);
+    if (ia_ >= 0) field.allocate_temporary(ia_);
   }
 
   /// Dellocate temporary Fields
@@ -215,6 +252,7 @@ public: // interface
     field.deallocate_temporary(iv_);
     field.deallocate_temporary(iq_);
     field.deallocate_temporary(iu_);
+    if (ia_ >= 0) field.deallocate_temporary(ia_);
   }
   
   // Inner product methods
@@ -263,6 +301,11 @@ protected:
 
   int & s_iter_(EnzoBlock * block)
   { return *block->data()->scalar_int().value(is_iter_); }
+
+  /// Iterative refinement state: 1 if R is to be replaced by B - A*X
+  /// in the next iteration, 2 if the current R was computed that way
+  int & s_refine_(EnzoBlock * block)
+  { return *block->data()->scalar_int().value(is_refine_); }
   
 protected: // attributes
 
@@ -327,6 +370,22 @@ protected: // attributes
   /// The level of the tree solve if solve_type == solve_tree
   int coarse_level_;
 
+  /// Precision of the BiCgStab vectors: precision_single, or
+  /// precision_default for the precision of X and B
+  int precision_;
+
+  /// Reduction in dot (R,R) between iterative refinement steps, or
+  /// 0.0 for no refinement
+  double refine_tol_;
+
+  /// Temporary field for A*X, in the precision of X
+  int ia_;
+
+  /// ScalarData id's for dot (R,R) at the last refinement step, and
+  /// for the refinement state
+  int is_rr_refine_;
+  int is_refine_;
+
 };
 
 #endif /* ENZO_ENZO_SOLVER_BICGSTAB_HPP */
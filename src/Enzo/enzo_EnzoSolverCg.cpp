@@ -69,7 +69,10 @@ EnzoSolverCg::EnzoSolverCg
  int solve_type,
  int min_level, int max_level,
  int iter_max, double res_tol,
- int index_precon
+ int index_precon,
+ int precision,
+ double refine_tol,
+ bool use_guess
  )
   : Solver(name,
 	   field_x,
@@ -92,7 +95,13 @@ EnzoSolverCg::EnzoSolverCg
     rr_min_(0.0),rr_max_(0.0),
     rr_(0.0), rz_(0.0), rz2_(0.0), dy_(0.0), bs_(0.0), rs_(0.0), xs_(0.0),
     bc_(0.0),
-    local_(solve_type==solve_block)
+    bb_(0.0),
+    local_(solve_type==solve_block),
+    precision_(precision),
+    refine_tol_(refine_tol),
+    ia_(-1),
+    rr_refine_(0.0),
+    is_refined_(false)
 {
   FieldDescr * field_descr = cello::field_descr();
 
@@ -101,6 +110,23 @@ EnzoSolverCg::EnzoSolverCg
   iy_ = field_descr->insert_temporary();
   iz_ = field_descr->insert_temporary();
 
+  // Store CG vectors in single precision if requested, halving their
+  // memory traffic and refresh message sizes
+
+  if (precision_ == precision_single) {
+    field_descr->set_precision(id_,precision_single);
+    field_descr->set_precision(ir_,precision_single);
+    field_descr->set_precision(iy_,precision_single);
+    field_descr->set_precision(iz_,precision_single);
+
+    // A*X for the residual B - A*X, in the precision of X, which is
+    // only needed for an initial guess or iterative refinement
+
+    if (use_guess || refine_tol_ > 0.0) {
+      ia_ = field_descr->insert_temporary();
+    }
+  }
+
   /// Initialize default Refresh
 
   field_descr->ghost_depth    (ib_,&gx_,&gy_,&gz_);
@@ -161,8 +187,14 @@ void EnzoSolverCg::pup (PUP::er &p)
   p | dy_;
   p | bs_;
   p | bc_;
+  p | bb_;
 
   p | local_;
+  p | precision_;
+  p | refine_tol_;
+  p | ia_;
+  p | rr_refine_;
+  p | is_refined_;
 }
 
 //======================================================================
@@ -193,12 +225,6 @@ void EnzoSolverCg::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
 //======================================================================
 
 void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
-//     X = initial guess
-//     B = right-hand side
-//     R = B - A*X
-//     solve(M*Z = R)
-//     D = Z
-//     shift (B)
 {
   COPY_FIELD(enzo_block,ix_,"X_cg");
   COPY_FIELD(enzo_block,ib_,"B_cg");
@@ -209,7 +235,63 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
   }
   
   iter_ = 0;
+  is_refined_ = false;
+
+  if (use_guess_) {
+
+    // Refresh the initial guess X before computing the initial
+    // residual, so Block boundary stencils use current ghost values
+
+    Refresh refresh (4,0,neighbor_type_(), sync_type_(),
+		     enzo_sync_id_solver_cg_guess);
+    refresh.set_active(is_finest_(enzo_block));
+    refresh.add_field (ix_);
+
+    enzo_block->refresh_enter(CkIndex_EnzoBlock::p_solver_cg_guess(),&refresh);
+
+  } else {
+
+    compute_begin(enzo_block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_cg_guess()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
 
+  EnzoSolverCg * solver = 
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->compute_begin(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::compute_begin (EnzoBlock * enzo_block) throw()
+{
+  if (precision_ == precision_single) {
+    compute_begin_<float> (enzo_block);
+  } else {
+    compute_begin_<enzo_float> (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::compute_begin_ (EnzoBlock * enzo_block) throw()
+//     X = initial guess
+//     B = right-hand side
+//     R = B - A*X
+//     solve(M*Z = R)
+//     D = Z
+//     shift (B)
+{
   Field field = enzo_block->data()->field();
 
   enzo_float * X = (enzo_float*) field.values(ix_);
@@ -217,17 +299,30 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
   //  std::fill_n(X,mx_*my_*mz_,0.0);
 
   enzo_float * B = (enzo_float*) field.values(ib_);
-  enzo_float * R = (enzo_float*) field.values(ir_);
-  enzo_float * D = (enzo_float*) field.values(id_);
-  enzo_float * Z = (enzo_float*) field.values(iz_);
+  T * R = (T*) field.values(ir_);
+  T * D = (T*) field.values(id_);
+  T * Z = (T*) field.values(iz_);
 
   if (is_finest_(enzo_block)) {
 
-    for (int i=0; i<mx_*my_*mz_; i++) {
-      X[i] = 0.0;
-      R[i] = B[i];
-      D[i] = R[i];
-      Z[i] = R[i];
+    if (use_guess_) {
+
+      // R = B - A*X for initial guess X
+      residual_ (enzo_block,R);
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	D[i] = R[i];
+	Z[i] = R[i];
+      }
+
+    } else {
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	X[i] = 0.0;
+	R[i] = B[i];
+	D[i] = R[i];
+	Z[i] = R[i];
+      }
     }
   }
 
@@ -235,9 +330,6 @@ void EnzoSolverCg::compute_ (EnzoBlock * enzo_block) throw()
 
   if (is_finest_(enzo_block)) {
 
-    enzo_float * B = (enzo_float*) field.values(ib_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
@@ -323,9 +415,15 @@ void EnzoSolverCg::loop_0b
 (EnzoBlock * enzo_block, CkReductionMsg * msg) throw ()
 {
 
-  set_iter ( ((int*)msg->getData())[0] );
+  const int iter = ((int*)msg->getData())[0];
 
   delete msg;
+
+  // iter is negative after iterative refinement (see refine_())
+
+  is_refined_ = (iter < 0);
+
+  set_iter ( is_refined_ ? -(iter + 1) : iter );
   
   // Refresh field faces then call solver_matvec
 
@@ -365,6 +463,18 @@ void EnzoBlock::r_solver_cg_matvec()
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
+{
+  if (precision_ == precision_single) {
+    shift_1_<float> (enzo_block);
+  } else {
+    shift_1_<enzo_float> (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::shift_1_ (EnzoBlock * enzo_block) throw()
 {
   Data * data = enzo_block->data();
   Field field = data->field();
@@ -372,7 +482,7 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
   if (is_finest_(enzo_block)) {
 
     enzo_float * B  = (enzo_float*) field.values(ib_);
-    enzo_float * R  = (enzo_float*) field.values(ir_);
+    T * R  = (T*) field.values(ir_);
 
     if (iter_ == 0 && A_->is_singular())  {
 
@@ -384,8 +494,8 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
       // shift_ (B,shift,B);
   
       long double shift = -bs_ / bc_;
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Z = (enzo_float*) field.values(iz_);
+      T * D = (T*) field.values(id_);
+      T * Z = (T*) field.values(iz_);
       for (int i=0; i<mx_*my_*mz_; i++) {
 	R[i] += shift;
 	B[i] += shift;
@@ -402,18 +512,33 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
     } 
   }
 
-  long double reduce = 0;
+  // dot (B,B) is only needed for the initial residual norm
+
+  const bool reduce_bb = (iter_ == 0);
+
+  long double reduce[2] = {0.0, 0.0};
 
   if (is_finest_(enzo_block)) {
 
-    enzo_float * R  = (enzo_float*) field.values(ir_);
+    T * R  = (T*) field.values(ir_);
+    enzo_float * B  = (enzo_float*) field.values(ib_);
     // reduce = field.dot(ir_,ir_);
 
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
 	  int i = ix + mx_*(iy + my_*iz);
-	  reduce += R[i]*R[i];
+	  reduce[0] += R[i]*R[i];
+	}
+      }
+    }
+    if (reduce_bb) {
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    reduce[1] += B[i]*B[i];
+	  }
 	}
       }
     }
@@ -422,9 +547,15 @@ void EnzoSolverCg::shift_1 (EnzoBlock * enzo_block) throw()
   CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_shift_1(NULL), 
 		      enzo_block->proxy_array());
 
-  enzo_block->contribute (sizeof(long double), &reduce, 
-			  sum_long_double_type, 
-			  callback);
+  if (reduce_bb) {
+    enzo_block->contribute (2*sizeof(long double), &reduce, 
+			    sum_long_double_2_type, 
+			    callback);
+  } else {
+    enzo_block->contribute (sizeof(long double), &reduce, 
+			    sum_long_double_type, 
+			    callback);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -437,6 +568,9 @@ void EnzoBlock::r_solver_cg_shift_1 (CkReductionMsg * msg)
     static_cast<EnzoSolverCg*> (this->solver());
 
   solver->set_rr( ((long double*)msg->getData())[0] );
+  if (msg->getSize() == 2*sizeof(long double)) {
+    solver->set_bb( ((long double*)msg->getData())[1] );
+  }
 
   delete msg;
 
@@ -480,16 +614,47 @@ void EnzoBlock::p_solver_cg_loop_2 ()
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
+{
+  if (precision_ == precision_single) {
+    loop_2b_<float> (enzo_block);
+  } else {
+    loop_2b_<enzo_float> (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::loop_2b_ (EnzoBlock * enzo_block) throw()
 {
   if (iter_ == 0) {
-    rr0_ = rr_;
+    // dot (B,B) equals the initial rr_ when X = 0, and keeps the
+    // convergence criterion independent of any initial guess
+    rr0_ = (bb_ > 0.0) ? bb_ : rr_;
     rr_min_ = rr_;
     rr_max_ = rr_;
+    rr_refine_ = rr_;
   } else {
     rr_min_ = std::min(rr_min_,rr_);
     rr_max_ = std::max(rr_max_,rr_);
   }
 
+  // Iterative refinement: the single-precision recursive residual
+  // drifts from the true residual, so replace it by B - A*X whenever
+  // it has been reduced by refine_tol, and before accepting
+  // convergence.  rr_ is then the true residual on the next pass
+
+  if (is_refined_) {
+
+    rr_refine_ = rr_;
+
+  } else if (refine_tol_ > 0.0 && iter_ > 0 &&
+	     (rr_ / rr_refine_ < refine_tol_ || rr_ / rr0_ < res_tol_)) {
+
+    refine_<T> (enzo_block);
+    return;
+  }
+
   if (enzo_block->index().is_root()) monitor_output_(enzo_block);
 
   const bool is_converged = (rr_ / rr0_ < res_tol_);
@@ -519,10 +684,10 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 
     if (is_finest_(enzo_block)) {
 
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * Y = (enzo_float*) field.values(iy_);
-      enzo_float * R = (enzo_float*) field.values(ir_);
-      enzo_float * Z = (enzo_float*) field.values(iz_);
+      T * D = (T*) field.values(id_);
+      T * Y = (T*) field.values(iy_);
+      T * R = (T*) field.values(ir_);
+      T * Z = (T*) field.values(iz_);
 
       for (int iz=gz_; iz<mz_-gz_; iz++) {
 	for (int iy=gy_; iy<my_-gy_; iy++) {
@@ -571,6 +736,18 @@ void EnzoBlock::r_solver_cg_loop_3 (CkReductionMsg * msg)
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
+{
+  if (precision_ == precision_single) {
+    loop_4_<float> (enzo_block);
+  } else {
+    loop_4_<enzo_float> (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::loop_4_ (EnzoBlock * enzo_block) throw ()
 //  a = rz / dy;
 //  X = X + a*D;
 //  R = R - a*Y;
@@ -591,9 +768,9 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
   if (is_finest_(enzo_block)) {
 
     enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * D = (enzo_float*) field.values(id_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * Y = (enzo_float*) field.values(iy_);
+    T * D = (T*) field.values(id_);
+    T * R = (T*) field.values(ir_);
+    T * Y = (T*) field.values(iy_);
 
     enzo_float a = rz_ / dy_;
 
@@ -606,7 +783,7 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
       R[i] -= a * Y[i];
     }
 
-    enzo_float * Z = (enzo_float*) field.values(iz_);
+    T * Z = (T*) field.values(iz_);
     
     // M_->matvec(iz_,ir_,enzo_block);
     for (int i=0; i<mx_*my_*mz_; i++) {
@@ -635,8 +812,8 @@ void EnzoSolverCg::loop_4 (EnzoBlock * enzo_block) throw ()
   if (is_finest_(enzo_block)) {
 
     enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * Z = (enzo_float*) field.values(iz_);
+    T * R = (T*) field.values(ir_);
+    T * Z = (T*) field.values(iz_);
 
     //    reduce[0] = field.dot(ir_,iz_);
     //    reduce[1] = sum_(R);
@@ -688,6 +865,18 @@ void EnzoBlock::r_solver_cg_loop_5 (CkReductionMsg * msg)
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
+{
+  if (precision_ == precision_single) {
+    loop_6_<float> (enzo_block);
+  } else {
+    loop_6_<enzo_float> (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::loop_6_ (EnzoBlock * enzo_block) throw ()
 //  rz2 = dot(R,Z)
 //  b = rz2 / rz;
 //  D = Z + b*D;
@@ -709,20 +898,20 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
       // eT*b == sum_i=1,n B[i]
 
       enzo_float * X  = (enzo_float*) field.values(ix_);
-      enzo_float * R  = (enzo_float*) field.values(ir_);
+      T * R  = (T*) field.values(ir_);
 
       // shift_ (X,T(-xs_/bc_),X);
       // shift_ (R,T(-rs_/bc_),R);
 
       for (int i=0; i<mx_*my_*mz_; i++) {
 	X[i] -= enzo_float(xs_/bc_);
-	R[i] -= enzo_float(rs_/bc_);
+	R[i] -= T(rs_/bc_);
       }
       
     }
 
-    enzo_float * D  = (enzo_float*) field.values(id_);
-    enzo_float * Z  = (enzo_float*) field.values(iz_);
+    T * D  = (T*) field.values(id_);
+    T * Z  = (T*) field.values(iz_);
 
     enzo_float b = rz2_ / rz_;
 
@@ -761,15 +950,27 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
 //----------------------------------------------------------------------
 
 void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
+{
+  if (precision_ == precision_single) {
+    local_cg_solve_<float> (enzo_block);
+  } else {
+    local_cg_solve_<enzo_float> (enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::local_cg_solve_(EnzoBlock * enzo_block)
 {
   Field field = enzo_block->data()->field();
 
   enzo_float * B = (enzo_float*) field.values(ib_);
-  enzo_float * D = (enzo_float*) field.values(id_);
-  enzo_float * R = (enzo_float*) field.values(ir_);
+  T * D = (T*) field.values(id_);
+  T * R = (T*) field.values(ir_);
   enzo_float * X = (enzo_float*) field.values(ix_);
-  enzo_float * Y = (enzo_float*) field.values(iy_);
-  enzo_float * Z = (enzo_float*) field.values(iz_);
+  T * Y = (T*) field.values(iy_);
+  T * Z = (T*) field.values(iz_);
 
   if ( ! is_finest_(enzo_block)) {
     
@@ -833,6 +1034,7 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
   }
 
   rr0_ = rr_;
+  rr_refine_ = rr_;
   
   bool is_converged = (rr_ / rr0_ < res_tol_);
   bool is_diverged = iter_ >= iter_max_;
@@ -895,7 +1097,7 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
     if (A_->is_singular()) {
       for (int i=0; i<mx_*my_*mz_; i++) {
 	X[i] -= enzo_float(xs_/bc_);
-	R[i] -= enzo_float(rs_/bc_);
+	R[i] -= T(rs_/bc_);
       }
     }
 
@@ -924,6 +1126,33 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
     is_converged = (rr_ / rr0_ < res_tol_);
     is_diverged = iter_ >= iter_max_;
+
+    if (refine_tol_ > 0.0 && ! is_diverged &&
+	(is_converged || rr_ / rr_refine_ < refine_tol_)) {
+
+      // Iterative refinement: restart from the true residual, as in
+      // loop_2b_()
+
+      refresh_local_(ix_,enzo_block);
+      residual_(enzo_block,R);
+
+      rr_ = 0.0;
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    rr_ += R[i]*R[i];
+	  }
+	}
+      }
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	D[i] = R[i];
+	Z[i] = R[i];
+      }
+      rr_refine_ = rr_;
+
+      is_converged = (rr_ / rr0_ < res_tol_);
+    }
   }
 
   if (is_converged) {
@@ -942,15 +1171,26 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
 void EnzoSolverCg::refresh_local_(int ix,EnzoBlock * enzo_block)
 {
+  Field field = enzo_block->data()->field();
 
-  enzo_float * X = (enzo_float*) enzo_block->data()->field().values(ix);
+  if (field.precision(ix) == precision_single) {
+    refresh_local_ ((float *) field.values(ix));
+  } else {
+    refresh_local_ ((enzo_float *) field.values(ix));
+  }
+}
+
+//----------------------------------------------------------------------
 
+template <class T>
+void EnzoSolverCg::refresh_local_(T * X)
+{
   // ASSUMES SINGULAR MATRIX IMPLIES PERIODIC DOMAIN.
 
   if (A_->is_singular()) {
 
     // shift first
-    shift_local_(ix, enzo_block);
+    shift_local_(X);
     
     // XM ghost <- XP face (y)(z)
     for (int iz=gz_; iz<nz_+gz_; iz++) {
@@ -1030,10 +1270,10 @@ void EnzoSolverCg::refresh_local_(int ix,EnzoBlock * enzo_block)
 
 //----------------------------------------------------------------------
 
-void EnzoSolverCg::shift_local_(int i_x,EnzoBlock * enzo_block)
+template <class T>
+void EnzoSolverCg::shift_local_(T * X)
 {
   if (A_->is_singular()) {
-    enzo_float * X = (enzo_float*) enzo_block->data()->field().values(i_x);
     long double xs = 0.0;
     long double xc = 0.0;
     for (int iz=gz_; iz<mz_-gz_; iz++) {
@@ -1053,6 +1293,79 @@ void EnzoSolverCg::shift_local_(int i_x,EnzoBlock * enzo_block)
 
 //----------------------------------------------------------------------
 
+template <class T>
+void EnzoSolverCg::residual_ (EnzoBlock * enzo_block, T * R) throw()
+{
+  if (ia_ < 0) {
+
+    // R has the same precision as X and B
+
+    ASSERT1 ("EnzoSolverCg::residual_()",
+	     "Solver %s has no A*X field for single-precision R",
+	     name_.c_str(),
+	     precision_ != precision_single);
+
+    A_->residual (ir_, ib_, ix_, enzo_block);
+
+  } else {
+
+    Field field = enzo_block->data()->field();
+
+    A_->matvec (ia_, ix_, enzo_block);
+
+    const enzo_float * B  = (const enzo_float*) field.values(ib_);
+    const enzo_float * AX = (const enzo_float*) field.values(ia_);
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  R[i] = B[i] - AX[i];
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoSolverCg::refine_ (EnzoBlock * enzo_block) throw()
+/// R = B - A*X
+/// D = R
+/// Z = R
+/// ==> loop_0b
+{
+  if (is_finest_(enzo_block)) {
+
+    Field field = enzo_block->data()->field();
+
+    T * R = (T*) field.values(ir_);
+    T * D = (T*) field.values(id_);
+    T * Z = (T*) field.values(iz_);
+
+    residual_ (enzo_block,R);
+
+    for (int i=0; i<mx_*my_*mz_; i++) {
+      D[i] = R[i];
+      Z[i] = R[i];
+    }
+  }
+
+  // Restart from loop_0b(), flagged by a negative iteration count so
+  // that the next loop_2b() accepts the updated residual
+
+  int iter = -(iter_ + 1);
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_loop_0b(NULL), 
+		      enzo_block->proxy_array());
+
+  enzo_block->contribute (sizeof(int), &iter, 
+			  CkReduction::max_int, callback);
+}
+
+//----------------------------------------------------------------------
+
 void EnzoSolverCg::end (EnzoBlock * enzo_block,int retval) throw ()
 ///    if (return == return_converged) {
 ///       ==> exit()
@@ -1083,7 +1396,8 @@ void EnzoSolverCg::monitor_output_(EnzoBlock * enzo_block)
   const bool l_output = l_first_iter || l_max_iter || l_monitor || l_converged;
       
   if (l_output) {
-    Solver::monitor_output_ (enzo_block,iter_,rr0_,rr_min_,rr_,rr_max_);
+    Solver::monitor_output_ (enzo_block,iter_,rr0_,rr_min_,rr_,rr_max_,
+			     l_converged || l_max_iter);
   }
 
 }
@@ -26,7 +26,10 @@ public: // interface
 		int max_level,
 		int iter_max, 
 		double res_tol,
-		int index_precon);
+		int index_precon,
+		int precision = precision_default,
+		double refine_tol = 0.0,
+		bool use_guess = false);
 
   /// Constructor
   EnzoSolverCg() throw()
@@ -44,7 +47,13 @@ public: // interface
     rr_min_(0),rr_max_(0),
     rr_(0.0), rz_(0.0), rz2_(0.0), dy_(0.0), bs_(0.0), rs_(0.0), xs_(0.0),
     bc_(0.0),
-    local_(false)
+    bb_(0.0),
+    local_(false),
+    precision_(precision_default),
+    refine_tol_(0.0),
+    ia_(-1),
+    rr_refine_(0.0),
+    is_refined_(false)
   {};
 
   /// Charm++ PUP::able declarations
@@ -66,7 +75,13 @@ public: // interface
       rr_min_(0),rr_max_(0),
       rr_(0.0), rz_(0.0), rz2_(0.0), dy_(0.0), bs_(0.0), rs_(0.0), xs_(0.0),
       bc_(0.0),
-      local_(false)
+      bb_(0.0),
+      local_(false),
+      precision_(precision_default),
+      refine_tol_(0.0),
+      ia_(-1),
+      rr_refine_(0.0),
+      is_refined_(false)
   {}
 
   /// Assignment operator
@@ -89,6 +104,9 @@ public: // virtual functions
   
 public: // virtual functions
 
+  /// Continuation after refreshing the initial guess
+  void compute_begin(EnzoBlock * enzo_block) throw();
+
   /// Continuation after global reduction
   void shift_1(EnzoBlock * enzo_block) throw();
 
@@ -134,6 +152,9 @@ public: // virtual functions
   /// Set bc_ (B count) by EnzoBlock after reduction
   void set_bc(double bc) throw()    { bc_ = bc;  }
 
+  /// Set bb_ (dot (B,B)) by EnzoBlock after reduction
+  void set_bb(double bb) throw()    { bb_ = bb;  }
+
   /// Set iter_ by EnzoBlock after reduction
   void set_iter(int iter) throw()        { iter_ = iter; }
 
@@ -141,6 +162,21 @@ protected: // methods
 
   void compute_ (EnzoBlock * enzo_block) throw();
 
+  /// Precision-specific continuations, where T is the type of the
+  /// CG vectors D, R, Y, and Z
+  template <class T> void compute_begin_ (EnzoBlock * enzo_block) throw();
+  template <class T> void shift_1_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_2b_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_4_ (EnzoBlock * enzo_block) throw();
+  template <class T> void loop_6_ (EnzoBlock * enzo_block) throw();
+
+  /// Compute the residual R = B - A*X in the precision of X
+  template <class T>
+  void residual_ (EnzoBlock * enzo_block, T * R) throw();
+
+  /// Replace R by the true residual and restart the search direction
+  template <class T> void refine_ (EnzoBlock * enzo_block) throw();
+
   void begin_1_() throw();
 
   /// Allocate temporary Fields
@@ -150,6 +186,7 @@ protected: // methods
     field.allocate_temporary(ir_);
     field.allocate_temporary(iy_);
     field.allocate_temporary(iz_);
+    if (ia_ >= 0) field.allocate_temporary(ia_);
   }
 
   /// Dellocate temporary Fields
@@ -159,16 +196,19 @@ protected: // methods
     field.deallocate_temporary(ir_);
     field.deallocate_temporary(iy_);
     field.deallocate_temporary(iz_);
+    if (ia_ >= 0) field.deallocate_temporary(ia_);
   }
 
   /// Serial CG solver if local_ == true
   void local_cg_ (EnzoBlock * enzo_block);
+  template <class T> void local_cg_solve_ (EnzoBlock * enzo_block);
 
   /// Apply boundary conditions for the Field on the local block
   void refresh_local_(int ix, EnzoBlock * enzo_block);
+  template <class T> void refresh_local_(T * X);
 
   /// Shift Field so that sum(x) == 0
-  void shift_local_(int ix, EnzoBlock * enzo_block);
+  template <class T> void shift_local_(T * X);
   
   void monitor_output_(EnzoBlock *);
   
@@ -233,8 +273,29 @@ protected: // attributes
   /// count of elements B(i) for singular systems
   double bc_;
 
+  /// dot (B,B), used as the initial residual rr0_ so that the
+  /// convergence criterion does not depend on the initial guess
+  double bb_;
+
   /// Whether to solve on a standalone Block, e.g. for MG coarse solver
   bool local_;
+
+  /// Precision of the CG vectors D, R, Y, and Z: precision_single,
+  /// or precision_default for the precision of X and B
+  int precision_;
+
+  /// Reduction in dot (R,R) between iterative refinement steps, or
+  /// 0.0 for no refinement
+  double refine_tol_;
+
+  /// Temporary field for A*X, in the precision of X
+  int ia_;
+
+  /// dot (R,R) at the last iterative refinement step
+  double rr_refine_;
+
+  /// Whether R was just replaced by the true residual
+  bool is_refined_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_CG_HPP */
@@ -63,7 +63,7 @@ EnzoSolverJacobi::EnzoSolverJacobi
   int monitor_iter,
   int restart_cycle,
   int solve_type,
-  double weight, int iter_max) throw()
+  double weight, int iter_max, int num_sweeps) throw()
   : Solver(name,
 	   field_x,
 	   field_b,
@@ -74,7 +74,8 @@ EnzoSolverJacobi::EnzoSolverJacobi
     ir_ (-1),
     id_ (-1),
     w_(weight),
-    n_(iter_max)
+    n_(iter_max),
+    num_sweeps_(num_sweeps)
 {
   // Reserve temporary fields
   FieldDescr * field_descr = cello::field_descr();
@@ -159,73 +160,88 @@ void EnzoSolverJacobi::apply_(Block * block)
 
   int mx,my,mz;
   field.dimensions(ix_,&mx,&my,&mz);
-  // int gx,gy,gz;
-  // field.ghost_depth(ix_,&gx,&gy,&gz);
+  int gx,gy,gz;
+  field.ghost_depth(ix_,&gx,&gy,&gz);
 
   const int ng = A_->ghost_depth();
-  const int gx = (mx > 1) ? ng : 0;
-  const int gy = (my > 1) ? ng : 0;
-  const int gz = (mz > 1) ? ng : 0;
+
+  // Number of sweeps before the next refresh
+
+  const int ns = std::min(sweeps_(block), n_ - (*piter_(block)));
 
   if (is_finest_(block)) {
 
-    A_->diagonal (id_, block,ng);
-    A_->residual (ir_, ib_, ix_, block,ng);
-
-#ifdef DEBUG_COPY
-    {
-      enzo_float * R = (enzo_float*) field.values(ir_);
-      enzo_float * R_J = (enzo_float*) field.values("R_J");
-      enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * D_J = (enzo_float*) field.values("D_J");
-      enzo_float * X = (enzo_float*) field.values(ix_);
-      enzo_float * X_J = (enzo_float*) field.values("X_J");
-      enzo_float * B = (enzo_float*) field.values(ib_);
-      enzo_float * B_J = (enzo_float*) field.values("B_J");
-      double rsum=0.0;
-      double dsum=0.0;
-      double xsum=0.0;
-      double bsum=0.0;
-      for (int i=0; i<mx*my*mz; i++) {
-	R_J[i]=R[i];
-	D_J[i]=D[i];
-	X_J[i]=X[i];
-	B_J[i]=B[i];
-	rsum+=std::abs(R[i]);
-	dsum+=std::abs(D[i]);
-	xsum+=X[i];
-	bsum+=std::abs(B[i]);
-      }
-      CkPrintf ("DEBUG_COPY rsum dsum xsum bsum %g %g %g %g\n",rsum,dsum,xsum,bsum);
-    }
-#endif    
+    EnzoMatrixLaplace * laplace =
+      dynamic_cast<EnzoMatrixLaplace *>(A_.get());
+
     enzo_float * X = (enzo_float*) field.values(ix_);
     enzo_float * R = (enzo_float*) field.values(ir_);
     enzo_float * D = (enzo_float*) field.values(id_);
 
-    if (w_ == 1.0) {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] += R[i] / D[i];
+    // Each sweep also updates (ns - 1 - is)*ng layers of ghost zones,
+    // so that the last sweep updates the interior using only values
+    // computed locally since the refresh
+
+    for (int is=0; is<ns; is++) {
+
+      const int gs = (ns - 1 - is)*ng;
+      const int g3[3] = { (mx > 1) ? gx - gs : 0,
+			  (my > 1) ? gy - gs : 0,
+			  (mz > 1) ? gz - gs : 0 };
+
+      if (laplace) {
+
+	// Fused update, alternating between X and R
+
+	if (is % 2 == 0) laplace->jacobi (ir_, ix_, ib_, w_, block, g3);
+	else             laplace->jacobi (ix_, ir_, ib_, w_, block, g3);
+
+      } else {
+
+	// Minimum ghost depth over active axes only, since inactive
+	// axes have depth 0
+
+	int g0 = g3[0];
+	if (my > 1) g0 = std::min(g0,g3[1]);
+	if (mz > 1) g0 = std::min(g0,g3[2]);
+
+	A_->diagonal (id_, block,g0);
+	A_->residual (ir_, ib_, ix_, block,g0);
+
+	// Damped Jacobi X += w*R/D, whose fixed point is A*X = B for
+	// any weight w
+
+	for (int iz=g3[2]; iz<mz-g3[2]; iz++) {
+	  for (int iy=g3[1]; iy<my-g3[1]; iy++) {
+	    for (int ix=g3[0]; ix<mx-g3[0]; ix++) {
+	      int i = ix + mx*(iy + my*iz);
+	      X[i] += w_*(R[i] / D[i]);
+	    }
 	  }
 	}
       }
-    } else {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
+    }
+
+    // Copy the fused result back to X if it ended in R
+
+    if (laplace && (ns % 2 == 1)) {
+      const int g3[3] = { (mx > 1) ? gx : 0,
+			  (my > 1) ? gy : 0,
+			  (mz > 1) ? gz : 0 };
+      for (int iz=g3[2]; iz<mz-g3[2]; iz++) {
+	for (int iy=g3[1]; iy<my-g3[1]; iy++) {
+	  for (int ix=g3[0]; ix<mx-g3[0]; ix++) {
 	    int i = ix + mx*(iy + my*iz);
-	    X[i] = w_*(R[i] / D[i]) + (1.0-w_)*X[i];
+	    X[i] = R[i];
 	  }
 	}
       }
     }
   }
+
   // Next iteration
 
-  (*piter_(block))++;
+  (*piter_(block)) += ns;
   
   // Refresh X
 
@@ -237,10 +253,17 @@ void EnzoSolverJacobi::apply_(Block * block)
 
 void EnzoSolverJacobi::do_refresh_(Block * block)
 {
-  const int ghost_depth   = A_->ghost_depth();
-  const int min_face_rank = cello::rank() - 1;
+  // Refresh enough ghost zones for sweeps_() sweeps.  Edges and
+  // corners are needed when sweeps extend into the ghost zones
+
+  const int ns = sweeps_(block);
+  const int ghost_depth   = ns*A_->ghost_depth();
+  const int min_face_rank = (ns > 1) ? 0 : cello::rank() - 1;
+
+  // alternate sync id's between consecutive refreshes
 
-  const int id_sync = 2*sync_id_()+(*piter_(block))%2;
+  const int i_refresh = ((*piter_(block)) + ns - 1) / ns;
+  const int id_sync = 2*sync_id_()+i_refresh%2;
   
   Refresh refresh
     (ghost_depth,min_face_rank,neighbor_type_(),
@@ -248,9 +271,32 @@ void EnzoSolverJacobi::do_refresh_(Block * block)
 
   refresh.set_active(is_finest_(block));
   refresh.add_field (ix_);
+
+  // Sweeps into the ghost zones also read B there, which is constant
+  // during the smoother so only needs refreshing once
+
+  if (ns > 1 && (*piter_(block)) == 0) refresh.add_field (ib_);
     
   block->refresh_enter
     (CkIndex_EnzoBlock::p_solver_jacobi_continue(),&refresh);
 }
 
 //----------------------------------------------------------------------
+
+int EnzoSolverJacobi::sweeps_(Block * block) const
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(ix_,&mx,&my,&mz);
+  int gx,gy,gz;
+  field.ghost_depth(ix_,&gx,&gy,&gz);
+
+  int g = gx;
+  if (my > 1) g = std::min(g,gy);
+  if (mz > 1) g = std::min(g,gz);
+
+  return std::max(1,std::min(num_sweeps_, g / A_->ghost_depth()));
+}
+
+//----------------------------------------------------------------------
@@ -24,7 +24,8 @@ public: // interface
 		   int restart_cycle,
 		   int solve_type,
 		   double weight=1.0,
-		   int iter_max = 1) throw();
+		   int iter_max = 1,
+		   int num_sweeps = 1) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoSolverJacobi);
@@ -37,7 +38,8 @@ public: // interface
       id_(-1),
       w_(0),
       i_iter_(-1),
-      n_(0)
+      n_(0),
+      num_sweeps_(1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -52,6 +54,7 @@ public: // interface
     p | w_;
     p | i_iter_;
     p | n_;
+    p | num_sweeps_;
   }
 
 public: // virtual methods
@@ -75,6 +78,9 @@ protected: // methods
   /// Refresh after computing
   void do_refresh_(Block * block);
 
+  /// Number of sweeps between refreshes, limited by the ghost depth
+  int sweeps_(Block * block) const;
+
   /// Allocate temporary Fields
   void allocate_temporary_(Field field, Block * block = NULL)
   {
@@ -117,6 +123,10 @@ protected: // attributes
   
   /// Number of iterations
   int n_;
+
+  /// Number of sweeps performed locally on shrinking regions after
+  /// each refresh of num_sweeps_ * A_->ghost_depth() ghost layers
+  int num_sweeps_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_JACOBI_HPP */
@@ -8,6 +8,10 @@
 /// Multigrid solver on a non-adaptive mesh.  Can be any mesh level, but
 /// typically the root-grid (level = 0).
 ///
+/// When used as a preconditioner, a fixed number of V-cycles may be
+/// applied instead ("cycles" parameter), in which case residual norms
+/// are not computed and no convergence reduction is performed.
+///
 ///======================================================================
 ///
 ///  "Coarse" view of MG0 multigrid solver
@@ -295,7 +299,8 @@ EnzoSolverMg0::EnzoSolverMg0
  int index_smooth_last,
  Restrict * restrict,
  Prolong * prolong,
- int coarse_level) 
+ int coarse_level,
+ int cycles) 
   : Solver(name,
 	   field_x,
 	   field_b,
@@ -305,7 +310,7 @@ EnzoSolverMg0::EnzoSolverMg0
 	   min_level,
 	   max_level),
     bs_(0), bc_(0),
-    rr_(0), rr_local_(0), rr0_(0),
+    rr_(0), rr_local_(0), rr0_(0), bb_local_(0),
     res_tol_(res_tol),
     A_(NULL),
     index_smooth_pre_(index_smooth_pre),
@@ -318,7 +323,8 @@ EnzoSolverMg0::EnzoSolverMg0
     ic_(-1), ir_(-1),
     mx_(0),my_(0),mz_(0),
     gx_(0),gy_(0),gz_(0),
-    coarse_level_(coarse_level)
+    coarse_level_(coarse_level),
+    cycles_(cycles)
 {
   // Initialize temporary fields
 
@@ -380,6 +386,7 @@ void EnzoSolverMg0::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
   rr_ = 0.0;
   rr_local_ = 0.0;
   rr0_ = 0.0;
+  bb_local_ = 0.0;
   *piter(block) = 0.0;
   *pmsg(block) = NULL;
 
@@ -412,7 +419,35 @@ void EnzoSolverMg0::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
 	      __FILE__,block->name().c_str(),name_.c_str());
 #endif  
 
-  enter_solver_ (enzo_block);
+  if (use_guess_ && ! is_fixed_cycles()) {
+
+    // Refresh the initial guess X before the first residual B - A*X,
+    // so Block boundary stencils use current ghost values
+
+    Refresh refresh (4,0,neighbor_level,sync_barrier,
+		     enzo_sync_id_solver_mg0_guess);
+    refresh.set_active(is_finest_(enzo_block));
+    refresh.add_field (ix_);
+
+    enzo_block->refresh_enter
+      (CkIndex_EnzoBlock::p_solver_mg0_guess(),&refresh);
+
+  } else {
+
+    enter_solver_ (enzo_block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_mg0_guess()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverMg0*> (solver())->enter_solver(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
 //----------------------------------------------------------------------
@@ -435,11 +470,14 @@ void EnzoSolverMg0::enter_solver_ (EnzoBlock * enzo_block) throw()
   enzo_float * R = (enzo_float*) field.values(ir_);
   enzo_float * C = (enzo_float*) field.values(ic_);
 
-  // X = 0
+  // X = 0 (unless X is the initial guess, which is ignored for a
+  //        fixed number of cycles so the preconditioner is linear)
   // R = B ( residual with X = 0 )
   // C = 0
 
-  std::fill_n(X,mx_*my_*mz_,0.0);
+  if (! (use_guess_ && is_finest_(enzo_block)) || is_fixed_cycles()) {
+    std::fill_n(X,mx_*my_*mz_,0.0);
+  }
   std::fill_n(R,mx_*my_*mz_,0.0);
   std::fill_n(C,mx_*my_*mz_,0.0);
 
@@ -662,7 +700,7 @@ void EnzoSolverMg0::monitor_output_(EnzoBlock * enzo_block)
   const int level = enzo_block->level();
 
   const bool l_output =
-    ( ( enzo_block->index().is_root()) &&
+    ( ( enzo_block->index().is_root()) && ! is_fixed_cycles() &&
       ( (iter == 0))); // ||
 
   if (l_output) {
@@ -690,11 +728,19 @@ void EnzoBlock::p_solver_mg0_solve_coarse()
 	      name().c_str(),solver->name().c_str(),solver->rr_local());
 #endif
 
+  if (solver->is_fixed_cycles()) {
+    // No residual norms are needed to end the cycle, so skip the
+    // reduction and continue with prolongation directly
+    solver->prolong(this);
+    performance_stop_(perf_compute,__FILE__,__LINE__);
+    return;
+  }
+
   CkCallback callback(CkIndex_EnzoBlock::r_solver_mg0_barrier(NULL), 
 		      enzo::block_array());
-  long double data[1] = {solver->rr_local()};
+  long double data[2] = {solver->rr_local(), solver->bb_local()};
   TRACE_BARRIER(this,solver,"barrier");
-  contribute(sizeof(long double), data,  sum_long_double_type, callback);
+  contribute(2*sizeof(long double), data,  sum_long_double_2_type, callback);
   performance_stop_(perf_compute,__FILE__,__LINE__);
 }
 
@@ -714,9 +760,13 @@ void EnzoBlock::r_solver_mg0_barrier(CkReductionMsg* msg)
   performance_start_(perf_compute,__FILE__,__LINE__);
 
   long double rr = ((long double*) msg->getData())[0];
+  long double bb = ((long double*) msg->getData())[1];
   solver->set_rr(rr);
   solver->set_rr_local(0.0);
-  if (*solver->piter(this)==0) solver->set_rr0(rr);
+  solver->set_bb_local(0.0);
+  // B'*B equals the initial R'*R when X = 0, and keeps the
+  // convergence criterion independent of any initial guess
+  if (*solver->piter(this)==0) solver->set_rr0(bb);
   
   delete msg;
 
@@ -901,13 +951,15 @@ void EnzoSolverMg0::compute_residual_(EnzoBlock * enzo_block) throw()
 
   DEBUG_FIELD (enzo_block,ir_,"R residual");
 
-  if ( is_finest_(enzo_block) ) {
+  if ( is_finest_(enzo_block) && ! is_fixed_cycles() ) {
     enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * B = (enzo_float*) field.values(ib_);
     for (int iz=gz_; iz<mz_-gz_; iz++) {
       for (int iy=gy_; iy<my_-gy_; iy++) {
 	for (int ix=gx_; ix<mx_-gx_; ix++) {
 	  int i = ix + mx_*(iy + my_*iz);
 	  rr_local_ += R[i]*R[i];
+	  bb_local_ += B[i]*B[i];
 	}
       }
     }
@@ -1238,12 +1290,13 @@ void EnzoSolverMg0::end_cycle(EnzoBlock * enzo_block) throw()
   const int level = enzo_block->level();
 
   const bool l_output =
-    ( ( enzo_block->index().is_root()) &&
+    ( ( enzo_block->index().is_root()) && ! is_fixed_cycles() &&
       ( (is_converged) || (is_diverged) ||
 	(monitor_iter_ && (iter % monitor_iter_) == 0 )) );
 
   if (l_output) {
-    Solver::monitor_output_(enzo_block,iter,rr0_,0.0,rr_,0.0);
+    Solver::monitor_output_(enzo_block,iter,rr0_,0.0,rr_,0.0,
+			    is_converged || is_diverged);
   }
 
   if (is_converged || is_diverged) {
@@ -1503,6 +1556,10 @@ void EnzoSolverMg0::unpack_correction_
 bool EnzoSolverMg0::is_converged_(EnzoBlock * enzo_block) const
 {
   TRACE_MG(enzo_block,"EnzoSolverMg0::is_converged");
+  if (is_fixed_cycles()) {
+    const int iter = *(((EnzoSolverMg0 *)this)->piter(enzo_block));
+    return (iter >= cycles_);
+  }
   return (rr0_ != 0.0 && rr_/rr0_ < res_tol_);
 }
 
@@ -1512,6 +1569,7 @@ bool EnzoSolverMg0::is_diverged_(EnzoBlock * enzo_block) const
 /// [*]
 {
   TRACE_MG(enzo_block,"EnzoSolverMg0::is_diverged");
+  if (is_fixed_cycles()) return false;
   const int iter = *(((EnzoSolverMg0 *)this)->piter(enzo_block));
   return (iter >= iter_max_);
 }
@@ -18,6 +18,8 @@ class EnzoSolverMg0 : public Solver {
   /// @brief [\ref Enzo] Multigrid on the root-level grid.  For use either
   /// as a Gravity solver on non-adaptive problems, or as a preconditioner
   /// for a Krylov subspace solver, as in Dan Reynold's HG solver.
+  /// As a preconditioner it may apply a fixed number of V-cycles,
+  /// skipping the residual norm reduction at the end of each cycle.
 
 public: // interface
 
@@ -39,7 +41,8 @@ public: // interface
    int index_smooth_last,
    Restrict * restrict,
    Prolong * prolong,
-   int coarse_level);
+   int coarse_level,
+   int cycles = 0);
 
   EnzoSolverMg0() {};
 
@@ -49,7 +52,7 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoSolverMg0 (CkMigrateMessage *m)
     :  Solver(m),
-       bs_(0), bc_(0), rr_(0), rr_local_(0), rr0_(0),
+       bs_(0), bc_(0), rr_(0), rr_local_(0), rr0_(0), bb_local_(0),
        res_tol_(0),
        A_(NULL),
        index_smooth_pre_(-1),
@@ -66,7 +69,8 @@ public: // interface
        ic_(-1), ir_(-1),
        mx_(0),my_(0),mz_(0),
        gx_(0),gy_(0),gz_(0),
-       coarse_level_(0)
+       coarse_level_(0),
+       cycles_(0)
   {}
 
   /// Destructor
@@ -88,6 +92,7 @@ public: // interface
     p | rr_;
     p | rr_local_;
     p | rr0_;
+    p | bb_local_;
 
     p | res_tol_;
 
@@ -117,6 +122,7 @@ public: // interface
     p | gz_;
 
     p | coarse_level_;
+    p | cycles_;
 
   }
 
@@ -172,10 +178,20 @@ public: // interface
   void set_rr_local(double rr) throw() { rr_local_ = rr; }
   void set_rr(double rr) throw() { rr_ = rr; }
   void set_rr0(double rr0) throw() { rr0_ = rr0; }
+  void set_bb_local(double bb) throw() { bb_local_ = bb; }
 
   double rr_local() throw() { return rr_local_; }
+  double bb_local() throw() { return bb_local_; }
   double rr() throw() { return rr_; }
 
+  /// Whether a fixed number of V-cycles are applied, without
+  /// computing residual norms
+  bool is_fixed_cycles() const throw() { return cycles_ > 0; }
+
+  /// Continuation after refreshing the initial guess X
+  void enter_solver(EnzoBlock * enzo_block) throw()
+  { enter_solver_(enzo_block); }
+
   void begin_solve(EnzoBlock * enzo_block,
 		   CkReductionMsg *msg) throw();
 
@@ -192,6 +208,7 @@ public: // interface
     CkPrintf (" prolong_ = %p\n",prolong_);
     CkPrintf (" iter_max_ = %d\n",iter_max_);
     CkPrintf (" res_tol_ = %g\n",res_tol_);
+    CkPrintf (" cycles_ = %d\n",cycles_);
     CkPrintf (" i_sync_restrict_ = %g\n",i_sync_restrict_);
     CkPrintf (" i_sync_prolong_ = %g\n",i_sync_prolong_);
     CkPrintf (" i_iter_ = %g\n",i_iter_);
@@ -291,6 +308,10 @@ protected: // attributes
   double rr_local_;
   double rr0_;
 
+  /// Local B'*B, used for rr0_ so that the convergence criterion
+  /// does not depend on the initial guess
+  double bb_local_;
+
   /// Convergence tolerance on the residual reduction rr_ / rr0_
   double res_tol_;
 
@@ -334,6 +355,10 @@ protected: // attributes
 
   /// The level of the coarse grid solve
   int coarse_level_;
+
+  /// Number of V-cycles when used as a preconditioner, or 0 to
+  /// iterate until res_tol is reached
+  int cycles_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_GRAVITY_MG0_HPP */
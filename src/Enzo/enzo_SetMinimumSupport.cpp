@@ -14,7 +14,9 @@
 int EnzoBlock::SetMinimumSupport(enzo_float &MinimumSupportEnergyCoefficient,
 				 bool comoving_coordinates)
 {
-  if (NumberOfBaryonFields > 0) {
+  const EnzoBlockParams & params = EnzoBlock::params();
+
+  if (params.NumberOfBaryonFields > 0) {
  
     const enzo_float pi = 3.14159;
  
@@ -36,10 +38,8 @@ int EnzoBlock::SetMinimumSupport(enzo_float &MinimumSupportEnergyCoefficient,
  
     /* Determine the size of the grids. */
  
-    const int in = cello::index_static();
-
     int dim, size = 1, i;
-    for (dim = 0; dim < GridRank[in]; dim++)
+    for (dim = 0; dim < params.GridRank; dim++)
       size *= GridDimension[dim];
  
     Field field = data()->field();
@@ -54,18 +54,18 @@ int EnzoBlock::SetMinimumSupport(enzo_float &MinimumSupportEnergyCoefficient,
     /* Set minimum GE. */
  
     MinimumSupportEnergyCoefficient =
-      GravitationalConstant[in]/(4.0*pi) / (pi * (Gamma[in]*(Gamma[in]-1.0))) *
-      CosmoFactor * MinimumPressureSupportParameter[in] *
+      params.GravitationalConstant/(4.0*pi) / (pi * (params.Gamma*(params.Gamma-1.0))) *
+      CosmoFactor * params.MinimumPressureSupportParameter *
       CellWidth[0] * CellWidth[0];
  
  
     /* PPM: set GE. */
  
-    if (DualEnergyFormalism[in] == TRUE) {
+    if (params.DualEnergyFormalism == TRUE) {
       for (i = 0; i < size; i++)
 	internal_energy[i] = MAX(internal_energy[i],
 				 MinimumSupportEnergyCoefficient*density[i]);
-      if (GridRank[in] != 3) return ENZO_FAIL;
+      if (params.GridRank != 3) return ENZO_FAIL;
       for (i = 0; i < size; i++)
 	total_energy[i] = 
 	  MAX((enzo_float)
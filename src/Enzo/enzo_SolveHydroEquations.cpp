@@ -8,6 +8,9 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 #include <stdio.h>
+#ifdef CONFIG_USE_OPENMP
+#  include <omp.h>
+#endif
 // #define DEBUG_TRACE_PPM
 // #define DEBUG_READ_FIELDS
 // #define DEBUG_WRITE_FIELDS
@@ -86,6 +89,54 @@
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  // Work arrays reused between calls on each process: zeroes for
+  // velocity components not defined for lower-rank problems, and
+  // solver work space for all threads.  Aligned to a cache line so
+  // that work arrays for different PEs in an SMP process do not
+  // share one
+
+  struct alignas(64) HydroWork {
+    std::vector<enzo_float> velocity_zero;
+    std::vector<enzo_float> ppm_temp;
+  };
+
+  HydroWork hydro_work[CONFIG_NODE_SIZE];
+
+  typedef void (*sweep_function)
+  (int *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   int *, int *, int *,
+   int *, enzo_float *, int *,
+   enzo_float *, enzo_float *,
+   int *, int *, int *, int *, int *, int *,
+   enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *,
+   int *, int *, int *,
+   int *, int *, int *,
+   int *, int *, int *,
+   int *, int *, int *, int *,
+   int *, int *, int *,
+   int *, int *, int *, enzo_float *,
+   int *, enzo_float *, int *, int *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *,
+   enzo_float *, enzo_float *,
+#ifdef NEW_PPM
+   enzo_float *,
+#endif
+   enzo_float *, enzo_float *, enzo_float *, enzo_float *);
+
+}
+
+//----------------------------------------------------------------------
+
 int EnzoBlock::SolveHydroEquations 
 (
  enzo_float time,
@@ -148,20 +199,29 @@ int EnzoBlock::SolveHydroEquations
 
   velocity_x = (enzo_float *) field.values("velocity_x");
 
-  if (rank >= 2) {
-    velocity_y = (enzo_float *) field.values("velocity_y");
-  } else {
-    velocity_y = new enzo_float[size];
-    for (int i=0; i<size; i++) velocity_y[i] = 0.0;
-  }
+  // Velocity components not used for lower-rank problems point into
+  // a zero array reused between calls, instead of being allocated
 
-    if (rank >= 3) {
-    velocity_z = (enzo_float *) field.values("velocity_z");
-  } else {
-    velocity_z = new enzo_float[size];
-    for (int i=0; i<size; i++) velocity_z[i] = 0.0;
+  HydroWork & work = hydro_work[cello::index_static()];
+
+  // Copy of the EnzoBlock parameters for this call, passed by
+  // reference to the Fortran solvers
+
+  EnzoBlockParams params = EnzoBlock::params();
+
+  // Allocated and zeroed only when the size changes: the solvers
+  // advect these components but leave them zero, since they start
+  // zero and have no pressure gradient or acceleration
+
+  if (rank < 3 && (int)work.velocity_zero.size() != (3-rank)*size) {
+    work.velocity_zero.assign((3-rank)*size,0.0);
   }
 
+  velocity_y = (rank >= 2) ?
+    (enzo_float *) field.values("velocity_y") : &work.velocity_zero[0];
+  velocity_z = (rank >= 3) ?
+    (enzo_float *) field.values("velocity_z") : &work.velocity_zero[(2-rank)*size];
+
   enzo_float * acceleration_x  = field.is_field("acceleration_x") ? 
     (enzo_float *) field.values("acceleration_x") : NULL;
   enzo_float * acceleration_y  = field.is_field("acceleration_y") ? 
@@ -172,12 +232,10 @@ int EnzoBlock::SolveHydroEquations
 
   /* Determine if Gamma should be a scalar or a field. */
 
-  const int in = cello::index_static();
-
   /* Set minimum support. */
 
   enzo_float MinimumSupportEnergyCoefficient = 0;
-  if (UseMinimumPressureSupport[in] == TRUE) {
+  if (params.UseMinimumPressureSupport == TRUE) {
     if (SetMinimumSupport(MinimumSupportEnergyCoefficient,
 			  comoving_coordinates) == ENZO_FAIL) {
       ERROR("EnzoBlock::SolveHydroEquations()",
@@ -214,7 +272,7 @@ int EnzoBlock::SolveHydroEquations
 
   //     /* Allocate space (if necessary). */
 
-  //     for (int field = 0; field < NumberOfBaryonFields[in]; field++) {
+  //     for (int field = 0; field < params.NumberOfBaryonFields; field++) {
   // 	if (SubgridFluxes[i]->LeftFluxes[field][dim] == NULL)
   // 	  SubgridFluxes[i]->LeftFluxes[field][dim]  = new enzo_float[size];
   // 	if (SubgridFluxes[i]->RightFluxes[field][dim] == NULL)
@@ -225,7 +283,7 @@ int EnzoBlock::SolveHydroEquations
   // 	}
   //     }
 
-  //     for (int field = NumberOfBaryonFields[in]; 
+  //     for (int field = params.NumberOfBaryonFields; 
   // 	   field < MAX_NUMBER_OF_BARYON_FIELDS;
   // 	   field++) {
   // 	SubgridFluxes[i]->LeftFluxes[field][dim] = NULL;
@@ -260,7 +318,19 @@ int EnzoBlock::SolveHydroEquations
 			 GridDimension[1]*GridDimension[2]),
 		     GridDimension[2]*GridDimension[0]);
 
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolour*4)];
+  const int num_threads = enzo::config()->ppm_threads;
+
+#ifdef CONFIG_USE_OPENMP
+  const int num_temp = std::max(num_threads,1);
+#else
+  const int num_temp = 1;
+#endif
+
+  const int ntemp = tempsize*(32+ncolour*4);
+  if ((int)work.ppm_temp.size() < ntemp*num_temp) {
+    work.ppm_temp.resize(ntemp*num_temp);
+  }
+  enzo_float *temp = &work.ppm_temp[0];
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
@@ -391,30 +461,124 @@ int EnzoBlock::SolveHydroEquations
   int iconsrec = 0;
   int iposrec = 0;
 
-  FORTRAN_NAME(ppm_de)
-    (
-     density, total_energy, velocity_x, velocity_y, velocity_z,
-     internal_energy,
-     &gravity_on, 
-     acceleration_x,
-     acceleration_y,
-     acceleration_z,
-     &Gamma[in], &dt, &cycle_,
-     CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
-     &rank, &GridDimension[0], &GridDimension[1],
-     &GridDimension[2], GridStartIndex, GridEndIndex,
-     &PPMFlatteningParameter[in],
-     &PressureFree[in],
-     &iconsrec, &iposrec,
-     &PPMDiffusionParameter[in], &PPMSteepeningParameter[in],
-     &DualEnergyFormalism[in], &DualEnergyFormalismEta1[in],
-     &DualEnergyFormalismEta2[in],
-     &NumberOfSubgrids, leftface, rightface,
-     istart, iend, jstart, jend,
-     standard, dindex, Eindex, uindex, vindex, windex,
-     geindex, temp,
-     &ncolour, colourpt, coloff, colindex
-     );
+  if (num_threads > 0) {
+
+    /* Call the x, y, and z sweeps directly, in the same order as
+       ppm_de, distributing the independent slices of each sweep
+       over threads each with its own work space */
+
+    ASSERT4 ("EnzoBlock::SolveHydroEquations()",
+	     "Grid dimension %d %d %d exceeds MAX_ANY_SINGLE_DIRECTION %d",
+	     GridDimension[0],GridDimension[1],GridDimension[2],
+	     MAX_ANY_SINGLE_DIRECTION,
+	     (std::max(std::max(GridDimension[0],GridDimension[1]),
+		       GridDimension[2]) <= MAX_ANY_SINGLE_DIRECTION));
+
+    int is = GridStartIndex[0] + 1;
+    int js = GridStartIndex[1] + 1;
+    int ks = GridStartIndex[2] + 1;
+    int ie = GridEndIndex[0] + 1;
+    int je = GridEndIndex[1] + 1;
+    int ke = GridEndIndex[2] + 1;
+    const int n_active[3] = { ie-is+1, je-js+1, ke-ks+1 };
+    const int ms = tempsize;
+    enzo_float pmin = tiny;
+
+    // Slice index and count for the sweep along each axis
+    const int n_slice[3] = { GridDimension[2], GridDimension[0], GridDimension[1] };
+    sweep_function sweep[3] = { FORTRAN_NAME(xeuler_sweep),
+				FORTRAN_NAME(yeuler_sweep),
+				FORTRAN_NAME(zeuler_sweep) };
+    enzo_float * acceleration[3] = { acceleration_x,
+				     acceleration_y,
+				     acceleration_z };
+    const int ixyz = cycle_ % rank;
+
+    for (int n=ixyz; n<ixyz+rank; n++) {
+
+      const int axis = n % rank;
+
+      if (n_active[axis] <= 1) continue;
+
+      const int ns = n_slice[axis];
+
+#ifdef CONFIG_USE_OPENMP
+#     pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+      for (int islice=1; islice<=ns; islice++) {
+
+#ifdef CONFIG_USE_OPENMP
+	enzo_float * t = temp + ntemp*omp_get_thread_num();
+#else
+	enzo_float * t = temp;
+#endif
+	std::fill_n (t, ntemp, 0.0);
+
+#ifdef NEW_PPM
+	const int ic = 31;
+#else
+	const int ic = 30;
+#endif
+	int slice = islice;
+
+	(*sweep[axis])
+	  (&slice, density, total_energy,
+	   velocity_x, velocity_y, velocity_z, internal_energy,
+	   &GridDimension[0], &GridDimension[1], &GridDimension[2],
+	   &gravity_on, acceleration[axis], &params.DualEnergyFormalism,
+	   &params.DualEnergyFormalismEta1, &params.DualEnergyFormalismEta2,
+	   &is, &ie, &js, &je, &ks, &ke,
+	   &params.Gamma, &pmin, &dt,
+	   CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
+	   &params.PPMDiffusionParameter, &params.PPMFlatteningParameter,
+	   &params.PPMSteepeningParameter,
+	   &iconsrec, &iposrec, &params.PressureFree,
+	   &NumberOfSubgrids, leftface, rightface,
+	   istart, iend, jstart, jend,
+	   dindex, Eindex, geindex,
+	   uindex, vindex, windex, standard,
+	   &ncolour, colourpt, coloff, colindex,
+	   t+ms*0,  t+ms*1,  t+ms*2,  t+ms*3,  t+ms*4,  t+ms*5,
+	   t+ms*6,  t+ms*7,  t+ms*8,  t+ms*9,  t+ms*10, t+ms*11,
+	   t+ms*12, t+ms*13, t+ms*14, t+ms*15, t+ms*16, t+ms*17,
+	   t+ms*18, t+ms*19, t+ms*20, t+ms*21, t+ms*22, t+ms*23,
+	   t+ms*24, t+ms*25, t+ms*26, t+ms*27, t+ms*28, t+ms*29,
+#ifdef NEW_PPM
+	   t+ms*30,
+#endif
+	   t+ms*(ic+0*ncolour), t+ms*(ic+1*ncolour),
+	   t+ms*(ic+2*ncolour), t+ms*(ic+3*ncolour));
+      }
+    }
+
+  } else {
+
+    FORTRAN_NAME(ppm_de)
+      (
+       density, total_energy, velocity_x, velocity_y, velocity_z,
+       internal_energy,
+       &gravity_on, 
+       acceleration_x,
+       acceleration_y,
+       acceleration_z,
+       &params.Gamma, &dt, &cycle_,
+       CellWidthTemp[0], CellWidthTemp[1], CellWidthTemp[2],
+       &rank, &GridDimension[0], &GridDimension[1],
+       &GridDimension[2], GridStartIndex, GridEndIndex,
+       &params.PPMFlatteningParameter,
+       &params.PressureFree,
+       &iconsrec, &iposrec,
+       &params.PPMDiffusionParameter, &params.PPMSteepeningParameter,
+       &params.DualEnergyFormalism, &params.DualEnergyFormalismEta1,
+       &params.DualEnergyFormalismEta2,
+       &NumberOfSubgrids, leftface, rightface,
+       istart, iend, jstart, jend,
+       standard, dindex, Eindex, uindex, vindex, windex,
+       geindex, temp,
+       &ncolour, colourpt, coloff, colindex
+       );
+
+  }
 
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
     delete [] CellWidthTemp[dim];
@@ -483,10 +647,6 @@ int EnzoBlock::SolveHydroEquations
   
   /* deallocate temporary space for solver */
 
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
-
   delete [] array;
 
   if (SubgridFluxes != NULL) {    
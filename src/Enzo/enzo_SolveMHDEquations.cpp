@@ -30,7 +30,9 @@ int EnzoBlock::SolveMHDEquations( enzo_float dt )
   //  if (GridRank != 3) 
   //    my_exit(EXIT_ENZO_FAILURE);
 
-  if (NumberOfBaryonFields > 0) {
+  const EnzoBlockParams & params = EnzoBlock::params();
+
+  if (params.NumberOfBaryonFields > 0) {
  
     /* initialize */
  
@@ -39,10 +41,8 @@ int EnzoBlock::SolveMHDEquations( enzo_float dt )
  
     /* Compute size (in floats) of the current grid. */
  
-    const int in = cello::index_static();
-
     size = 1;
-    for (dim = 0; dim < GridRank[in]; dim++)
+    for (dim = 0; dim < params.GridRank; dim++)
       size *= GridDimension[dim];
  
     /* Get easy to handle pointers for each variable. */
@@ -136,14 +136,14 @@ int EnzoBlock::SolveMHDEquations( enzo_float dt )
     /* compute global start index for left edge of entire grid
        (including boundary zones) */
  
-     for (dim = 0; dim < GridRank[in]; dim++)
+     for (dim = 0; dim < params.GridRank; dim++)
        GridGlobalStart[dim] =
-     	NINT((GridLeftEdge[dim] - DomainLeftEdge[in*3+dim])/CellWidth[dim]) -
+     	NINT((GridLeftEdge[dim] - params.DomainLeftEdge[dim])/CellWidth[dim]) -
      	GridStartIndex[dim];
  
     /* fix grid quantities so they are defined to at least 3 dims */
  
-    for (i = GridRank[in]; i < 3; i++) {
+    for (i = params.GridRank; i < 3; i++) {
       GridDimension[i]   = 1;
       GridStartIndex[i]  = 0;
       GridEndIndex[i]    = 0;
@@ -228,7 +228,7 @@ int EnzoBlock::SolveMHDEquations( enzo_float dt )
     //    if (NumberOfSubgrids > 0) standard = SubgridFluxes[0]->LeftFluxes[0][0];
  
     // for (subgrid = 0; subgrid < NumberOfSubgrids; subgrid++)
-    //   for (dim = 0; dim < GridRank[in]; dim++) {
+    //   for (dim = 0; dim < params.GridRank; dim++) {
  
         /* Set i,j dimensions of 2d flux slice (this works even if we
            are in 1 or 2d) the correspond to the dimensions of the global
@@ -314,7 +314,7 @@ int EnzoBlock::SolveMHDEquations( enzo_float dt )
     enzo_float a = 1.0;
     enzo_float CellWidthTemp[MAX_DIMENSION];
     for (dim = 0; dim < MAX_DIMENSION; dim++) {
-      if (dim < GridRank[in])
+      if (dim < params.GridRank)
 	CellWidthTemp[dim] = enzo_float(a*CellWidth[dim]);
       else
 	CellWidthTemp[dim] = 1.0;
@@ -87,6 +87,98 @@ extern "C" void FORTRAN_NAME(ppm_de)
    int *ncolour, enzo_float *colourpt, int *coloff,
    int colindex[]);
 
+// Single-slice PPM sweeps called by ppm_de
+
+extern "C" void FORTRAN_NAME(xeuler_sweep)
+  (int *slice, enzo_float *d, enzo_float *E,
+   enzo_float *u, enzo_float *v, enzo_float *w, enzo_float *ge,
+   int *in, int *jn, int *kn,
+   int *grav, enzo_float *gr_acc, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *is, int *ie, int *js, int *je, int *ks, int *ke,
+   enzo_float *gamma, enzo_float *pmin, enzo_float *dt,
+   enzo_float dx[], enzo_float dy[], enzo_float dz[],
+   int *diff, int *flatten, int *steepen,
+   int *iconsrec, int *iposrec, int *ipresfree,
+   int *num_subgrids, int leftface[], int rightface[],
+   int istart[], int iend[], int jstart[], int jend[],
+   int dindex[], int Eindex[], int geindex[],
+   int uindex[], int vindex[], int windex[], enzo_float *standard,
+   int *ncolour, enzo_float *colourpt, int *coloff, int colindex[],
+   enzo_float *t0,  enzo_float *t1,  enzo_float *t2,  enzo_float *t3,
+   enzo_float *t4,  enzo_float *t5,  enzo_float *t6,  enzo_float *t7,
+   enzo_float *t8,  enzo_float *t9,  enzo_float *t10, enzo_float *t11,
+   enzo_float *t12, enzo_float *t13, enzo_float *t14, enzo_float *t15,
+   enzo_float *t16, enzo_float *t17, enzo_float *t18, enzo_float *t19,
+   enzo_float *t20, enzo_float *t21, enzo_float *t22, enzo_float *t23,
+   enzo_float *t24, enzo_float *t25, enzo_float *t26, enzo_float *t27,
+   enzo_float *t28, enzo_float *t29,
+#ifdef NEW_PPM
+   enzo_float *t30,
+#endif
+   enzo_float *colslice, enzo_float *colf,
+   enzo_float *colls, enzo_float *colrs);
+
+extern "C" void FORTRAN_NAME(yeuler_sweep)
+  (int *slice, enzo_float *d, enzo_float *E,
+   enzo_float *u, enzo_float *v, enzo_float *w, enzo_float *ge,
+   int *in, int *jn, int *kn,
+   int *grav, enzo_float *gr_acc, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *is, int *ie, int *js, int *je, int *ks, int *ke,
+   enzo_float *gamma, enzo_float *pmin, enzo_float *dt,
+   enzo_float dx[], enzo_float dy[], enzo_float dz[],
+   int *diff, int *flatten, int *steepen,
+   int *iconsrec, int *iposrec, int *ipresfree,
+   int *num_subgrids, int leftface[], int rightface[],
+   int istart[], int iend[], int jstart[], int jend[],
+   int dindex[], int Eindex[], int geindex[],
+   int uindex[], int vindex[], int windex[], enzo_float *standard,
+   int *ncolour, enzo_float *colourpt, int *coloff, int colindex[],
+   enzo_float *t0,  enzo_float *t1,  enzo_float *t2,  enzo_float *t3,
+   enzo_float *t4,  enzo_float *t5,  enzo_float *t6,  enzo_float *t7,
+   enzo_float *t8,  enzo_float *t9,  enzo_float *t10, enzo_float *t11,
+   enzo_float *t12, enzo_float *t13, enzo_float *t14, enzo_float *t15,
+   enzo_float *t16, enzo_float *t17, enzo_float *t18, enzo_float *t19,
+   enzo_float *t20, enzo_float *t21, enzo_float *t22, enzo_float *t23,
+   enzo_float *t24, enzo_float *t25, enzo_float *t26, enzo_float *t27,
+   enzo_float *t28, enzo_float *t29,
+#ifdef NEW_PPM
+   enzo_float *t30,
+#endif
+   enzo_float *colslice, enzo_float *colf,
+   enzo_float *colls, enzo_float *colrs);
+
+extern "C" void FORTRAN_NAME(zeuler_sweep)
+  (int *slice, enzo_float *d, enzo_float *E,
+   enzo_float *u, enzo_float *v, enzo_float *w, enzo_float *ge,
+   int *in, int *jn, int *kn,
+   int *grav, enzo_float *gr_acc, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *is, int *ie, int *js, int *je, int *ks, int *ke,
+   enzo_float *gamma, enzo_float *pmin, enzo_float *dt,
+   enzo_float dx[], enzo_float dy[], enzo_float dz[],
+   int *diff, int *flatten, int *steepen,
+   int *iconsrec, int *iposrec, int *ipresfree,
+   int *num_subgrids, int leftface[], int rightface[],
+   int istart[], int iend[], int jstart[], int jend[],
+   int dindex[], int Eindex[], int geindex[],
+   int uindex[], int vindex[], int windex[], enzo_float *standard,
+   int *ncolour, enzo_float *colourpt, int *coloff, int colindex[],
+   enzo_float *t0,  enzo_float *t1,  enzo_float *t2,  enzo_float *t3,
+   enzo_float *t4,  enzo_float *t5,  enzo_float *t6,  enzo_float *t7,
+   enzo_float *t8,  enzo_float *t9,  enzo_float *t10, enzo_float *t11,
+   enzo_float *t12, enzo_float *t13, enzo_float *t14, enzo_float *t15,
+   enzo_float *t16, enzo_float *t17, enzo_float *t18, enzo_float *t19,
+   enzo_float *t20, enzo_float *t21, enzo_float *t22, enzo_float *t23,
+   enzo_float *t24, enzo_float *t25, enzo_float *t26, enzo_float *t27,
+   enzo_float *t28, enzo_float *t29,
+#ifdef NEW_PPM
+   enzo_float *t30,
+#endif
+   enzo_float *colslice, enzo_float *colf,
+   enzo_float *colls, enzo_float *colrs);
+
 extern "C" void FORTRAN_NAME(ppml)
   (enzo_float *dn,   enzo_float *vx,   enzo_float *vy,   enzo_float *vz,
    enzo_float *bx,   enzo_float *by,   enzo_float *bz,
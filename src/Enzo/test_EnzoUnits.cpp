@@ -52,6 +52,46 @@ PARALLEL_MAIN_BEGIN
   unit_assert (cello::err_rel(t0,(enzo_float)0.81650250388244) <= 1e-15);
   cosmology->set_current_time(0.0);
 
+  // Cached expansion factors must match the solver exactly, including
+  // after more distinct times than the cache holds
+
+  unit_func ("compute_expansion_factor()");
+
+  const int num_times = 20;
+  bool match = true;
+  for (int pass=0; pass<2; pass++) {
+    for (int i=0; i<num_times; i++) {
+      enzo_float time = t0*(1.0 + 0.25*i);
+      enzo_float a_cache,dadt_cache;
+      enzo_float a_solve,dadt_solve;
+      // call twice so the second is read from the cache
+      cosmology->compute_expansion_factor (&a_cache,&dadt_cache,time);
+      cosmology->compute_expansion_factor (&a_cache,&dadt_cache,time);
+      cosmology->solve_expansion_factor   (&a_solve,&dadt_solve,time);
+      if (a_cache != a_solve || dadt_cache != dadt_solve) match = false;
+    }
+  }
+  unit_assert (match);
+
+  // a(t0) is one in code units
+
+  enzo_float a0,dadt0;
+  cosmology->compute_expansion_factor (&a0,&dadt0,t0);
+  unit_assert (cello::err_rel(a0,(enzo_float)1.0) <= 1e-5);
+
+  // Changing parameters must discard cached values
+
+  enzo_float a1,dadt1,a2,dadt2;
+  cosmology->compute_expansion_factor (&a1,&dadt1,2.0*t0);
+  cosmology->set_omega_matter_now  ( 0.25);
+  cosmology->set_omega_lambda_now  ( 0.75);
+  cosmology->compute_expansion_factor (&a2,&dadt2,2.0*t0);
+  cosmology->solve_expansion_factor   (&a1,&dadt1,2.0*t0);
+  unit_assert (a1 == a2 && dadt1 == dadt2);
+
+  cosmology->set_omega_matter_now  ( 0.3);
+  cosmology->set_omega_lambda_now  ( 0.7);
+
   cosmology->print();
 
   CkPrintf ("length = %g\n",units->length());
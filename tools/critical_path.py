@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+
+# See LICENSE_CELLO file for license and copyright information
+
+"""Reconstruct the critical path of cycles from Performance:trace files
+
+Usage: critical_path.py [--cycle N] [--top N] trace-0000.data trace-0001.data ...
+
+Reads the per-process event trace files written when the
+Performance:trace:size parameter is non-zero, and for each cycle walks
+backwards from the last event of the cycle.  At each event the
+predecessor is either the previous event of the same Block or, for a
+message receive, the matching send on the sending Block, whichever
+happened later.  The resulting chain of Blocks, regions and messages is
+the critical path of the cycle.
+
+Time spent on the path is summarized by region, by process, and by
+message latency, and the longest segments are listed.  Timestamps are
+wall-clock times from each process, so clocks on different nodes are
+assumed to be synchronized.  Dependencies through reductions and
+quiescence detection are not traced, so time spent waiting on them
+appears under the corresponding "_sync" region."""
+
+import sys
+from collections import defaultdict
+
+class Event:
+    __slots__ = ('time','cycle','type','region','block','message','pe',
+                 'prev','active')
+    def __init__(self, time, cycle, type, region, block, message, pe):
+        self.time    = time
+        self.cycle   = cycle
+        self.type    = type
+        self.region  = region
+        self.block   = block
+        self.message = message
+        self.pe      = pe
+        self.prev    = None   # previous event of the same Block
+        self.active  = None   # region active in the Block after the event
+
+#----------------------------------------------------------------------
+
+def read_trace(file_name, events, region_name):
+    pe = -1
+    with open(file_name) as fp:
+        for line in fp:
+            if line.startswith('#'):
+                words = line.split()
+                if len(words) >= 3 and words[1] == 'pe':
+                    pe = int(words[2])
+                elif len(words) >= 4 and words[1] == 'region':
+                    region_name[int(words[2])] = words[3]
+                elif len(words) >= 3 and words[1] == 'dropped':
+                    sys.stderr.write('%s: %s events dropped; '
+                                     'increase Performance:trace:size\n'
+                                     % (file_name, words[2]))
+                continue
+            words = line.split()
+            if len(words) != 8: continue
+            events.append(Event(int(words[0]), int(words[1]), words[2],
+                                int(words[3]), ' '.join(words[4:7]),
+                                int(words[7],16), pe))
+
+#----------------------------------------------------------------------
+
+def link_blocks(events):
+    """Link each event to the previous event of its Block, and record
+    the region active in the Block after each event"""
+    by_block = defaultdict(list)
+    for e in events:
+        by_block[e.block].append(e)
+    for block_events in by_block.values():
+        block_events.sort(key=lambda e: e.time)
+        stack = []
+        prev = None
+        for e in block_events:
+            if e.type == 'start':
+                stack.append(e.region)
+            elif e.type == 'stop' and e.region in stack:
+                stack.remove(e.region)
+            e.prev   = prev
+            e.active = stack[-1] if stack else None
+            prev     = e
+
+#----------------------------------------------------------------------
+
+def critical_path(events, send, cycle):
+    """Return the list of segments (kind, t0, t1, e0, e1) on the
+    critical path of the given cycle, in chronological order"""
+    cycle_events = [e for e in events if e.cycle == cycle]
+    if not cycle_events: return []
+    e = max(cycle_events, key=lambda e: e.time)
+    path = []
+    while True:
+        p_block = e.prev if (e.prev and e.prev.cycle == cycle) else None
+        p_msg = None
+        if e.type == 'recv' and e.message in send:
+            s = send[e.message]
+            if s.cycle == cycle and s.time <= e.time:
+                p_msg = s
+        if p_msg and (p_block is None or p_msg.time >= p_block.time):
+            path.append(('message', p_msg.time, e.time, p_msg, e))
+            e = p_msg
+        elif p_block:
+            path.append(('block', p_block.time, e.time, p_block, e))
+            e = p_block
+        else:
+            break
+    path.reverse()
+    return path
+
+#----------------------------------------------------------------------
+
+def report(cycle, path, region_name, top):
+    if not path: return
+    t0 = path[0][1]
+    t1 = path[-1][2]
+    total = t1 - t0
+    print('cycle %d critical path %.6f s  %d segments'
+          % (cycle, 1e-6*total, len(path)))
+
+    by_region = defaultdict(int)
+    by_pe     = defaultdict(int)
+    latency   = 0
+    blocks    = set()
+
+    # merge consecutive segments of the same Block and region
+
+    merged = []
+    for kind, a, b, e0, e1 in path:
+        if kind == 'message':
+            latency += b - a
+            key = ('message', '%s -> %s' % (e0.block, e1.block),
+                   'pe %d -> %d' % (e0.pe, e1.pe))
+        else:
+            name = region_name.get(e0.active, 'idle') \
+                   if e0.active is not None else 'idle'
+            by_region[name] += b - a
+            by_pe[e0.pe]    += b - a
+            blocks.add(e0.block)
+            key = ('block', e0.block, name)
+        if merged and merged[-1][0] == key:
+            merged[-1][2] = b
+        else:
+            merged.append([key, a, b, e0.pe])
+
+    def percent(t):
+        return 100.0*t/total if total > 0 else 0.0
+
+    print('  blocks on path %d' % len(blocks))
+    print('  message latency %.6f s (%.1f%%)'
+          % (1e-6*latency, percent(latency)))
+    for name, t in sorted(by_region.items(), key=lambda x: -x[1]):
+        print('  region %-24s %.6f s (%.1f%%)' % (name, 1e-6*t, percent(t)))
+    for pe, t in sorted(by_pe.items(), key=lambda x: -x[1])[:top]:
+        print('  pe     %-24d %.6f s (%.1f%%)' % (pe, 1e-6*t, percent(t)))
+    print('  longest segments:')
+    for key, a, b, pe in sorted(merged, key=lambda m: m[1]-m[2])[:top]:
+        print('    %.6f s  +%.6f  pe %-4d %s %s'
+              % (1e-6*(b-a), 1e-6*(a-t0), pe, key[1], key[2]))
+
+#----------------------------------------------------------------------
+
+def main(argv):
+    cycle = None
+    top   = 10
+    files = []
+    i = 1
+    while i < len(argv):
+        if argv[i] == '--cycle':
+            cycle = int(argv[i+1]); i += 2
+        elif argv[i] == '--top':
+            top = int(argv[i+1]); i += 2
+        else:
+            files.append(argv[i]); i += 1
+
+    if not files:
+        print(__doc__)
+        return 1
+
+    events = []
+    region_name = {}
+    for f in files:
+        read_trace(f, events, region_name)
+
+    link_blocks(events)
+
+    send = {}
+    for e in events:
+        if e.type == 'send': send[e.message] = e
+
+    cycles = sorted(set(e.cycle for e in events))
+    if cycle is not None: cycles = [cycle]
+
+    for c in cycles:
+        report(c, critical_path(events, send, c), region_name, top)
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))